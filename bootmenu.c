@@ -249,28 +249,97 @@ static void ui_finish(void) {
   ui_final();
 }
 
+// the other keys of a chord may come a little after the first one
+#define BOOT_CHORD_SETTLE_MS  150
+#define BOOT_CHORD_BLINK_MS   300
+
 /**
- * wait_key()
+ * match_chord()
  *
+ * The chord with the most keys, all held, else the one of the key
+ * pressed alone (released already)
  */
-static int wait_key(int key) {
-  int i;
-  int result = 0;
-
-  evt_init();
-  //ui_clear_key_queue();
-  for(i=0; i < 100; i++) {
-    if(ui_key_pressed(key)) {
-      led_alert("blue", DISABLE);
-      result = 1;
-      break;
-    }
-    else {
-      usleep(15000); //15ms * 100
+static struct boot_chord *match_chord(struct bootkey_config *conf, int key) {
+  struct boot_chord *best = NULL;
+  int i, k;
+
+  for (i = 0; i < conf->chord_count; i++) {
+    struct boot_chord *chord = &conf->chords[i];
+    for (k = 0; k < chord->count && ev_key_held(chord->keys[k]); k++)
+      ;
+    if (k == chord->count && (best == NULL || chord->count > best->count))
+      best = chord;
+  }
+
+  for (i = 0; best == NULL && i < conf->chord_count; i++) {
+    if (conf->chords[i].count == 1 && conf->chords[i].keys[0] == key)
+      best = &conf->chords[i];
+  }
+  return best;
+}
+
+/**
+ * wait_chord()
+ *
+ * Decide at once on the keys held, else wait for the first key of a chord
+ * during the time set in bootkey.conf (0 to never wait).
+ */
+static struct boot_chord *wait_chord(struct bootkey_config *conf) {
+  int keys[BOOT_CHORD_MAX * BOOT_CHORD_KEYS];
+  int count = 0, settle = 0;
+  int i, k, key;
+  struct boot_chord *chord = NULL;
+  uint64_t start = gr_stats_now();
+
+  for (i = 0; i < conf->chord_count; i++) {
+    for (k = 0; k < conf->chords[i].count; k++)
+      keys[count++] = conf->chords[i].keys[k];
+    if (conf->chords[i].count > 1)
+      settle = 1;
+  }
+
+  key = ev_wait_key(keys, count, conf->wait_ms);
+  if (key > 0) {
+    if (settle)
+      usleep(BOOT_CHORD_SETTLE_MS * 1000);
+    chord = match_chord(conf, key);
+  }
+
+  LOGI("Boot chord %s after %u ms\n", chord ? chord->target : "none",
+       (unsigned) ((gr_stats_now() - start) / 1000000));
+
+  if (chord) {
+    led_alert("blue", DISABLE);
+    if (chord->led[0]) {
+      led_alert(chord->led, ENABLE);
+      usleep(BOOT_CHORD_BLINK_MS * 1000);
+      led_alert(chord->led, DISABLE);
     }
   }
-  evt_exit();
-  return result;
+  return chord;
+}
+
+/**
+ * hold_shell()
+ *
+ * The "shell" chord: adbd runs before anything else is started, and the
+ * boot waits for a key, or for the usb cable unplugged after the shell.
+ */
+static void hold_shell(void) {
+  int usb_seen = 0, key = 0;
+
+  exec_script(FILE_ADBD, DISABLE);
+  LOGI("Shell held, a key or the usb unplugged to boot\n");
+
+  while (key == 0) {
+    if (usb_connected())
+      usb_seen = 1;
+    else if (usb_seen)
+      break;
+    key = ev_wait_key(NULL, 0, 1000);
+  }
+
+  LOGI("Shell released by %s\n", key > 0 ? "a key" : key < 0 ? "an input error" : "usb");
 }
 
 /**
@@ -282,6 +351,7 @@ static int run_bootmenu_ui(int mode) {
 
   // initialize ui
   ui_init();
+  load_idle_config();
   //ui_set_background(BACKGROUND_DEFAULT);
   ui_show_text(ENABLE);
   LOGI("Start Android BootMenu....\n");
@@ -333,6 +403,8 @@ static int run_bootmenu_ui(int mode) {
 static int run_bootmenu(void) {
   int defmode, mode, status = BUTTON_ERROR;
   int adb_started = 0;
+  struct bootkey_config bootkey;
+  struct boot_chord *chord;
   time_t start = time(NULL);
 
   LOGI("Starting bootmenu on %s", ctime(&start));
@@ -353,7 +425,21 @@ static int run_bootmenu(void) {
      || mode == int_mode("recovery")) {
         // dont wait if these modes are asked
     } else {
-        status = (wait_key(KEY_VOLUMEDOWN) ? BUTTON_PRESSED : BUTTON_TIMEOUT);
+        load_bootkey_config(&bootkey);
+        chord = wait_chord(&bootkey);
+
+        if (chord == NULL) {
+            status = BUTTON_TIMEOUT;
+        } else if (!strcmp(chord->target, "bootmenu")) {
+            status = BUTTON_PRESSED;
+        } else {
+            // straight to the target, the menu is never started
+            status = BUTTON_TIMEOUT;
+            if (!strcmp(chord->target, "shell"))
+                hold_shell();   // then the boot mode set, as usual
+            else
+                mode = int_mode(chord->target);
+        }
     }
 
     // on timeout
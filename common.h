@@ -132,6 +132,23 @@ void ui_show_indeterminate_progress();
 // Hide and reset the progress bar.
 void ui_reset_progress();
 
+// Frame time percentiles and fps in the status bar, and a dump of the
+// render statistics histograms to a file.
+void ui_show_render_stats(int visible);
+int ui_render_stats_visible(void);
+int ui_dump_render_stats(const char *path);
+
+// Dim the backlight to dim_brightness after dim seconds without input, and
+// blank the screen after blank seconds (0: never). The dump of the render
+// stats includes the time spent in each state.
+void ui_set_idle_timeouts(int dim, int blank, int dim_brightness);
+
+// Png of the screen as shown. On demand, the screen is also streamed to
+// the client of GR_CAPTURE_SOCKET, for the host viewer over adb forward.
+int ui_save_screenshot(const char *path);
+int ui_stream_screen(int on);
+int ui_screen_streamed(void);
+
 #define LOGE(...) ui_print("E:" __VA_ARGS__)
 #define LOGW(...) fprintf(stdout, "W:" __VA_ARGS__)
 #define LOGI(...) fprintf(stdout, "I:" __VA_ARGS__)
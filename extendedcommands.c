@@ -15,6 +15,7 @@
  */
 
 #include <errno.h>
+#include <linux/input.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,6 +49,14 @@ const char* modes[] = {
 #define LABEL_2NDBOOT_UART    "2nd-boot-uart"
 #define LABEL_2NDSYSTEM  "2nd-system"
 
+// idle display, without idle.conf (seconds, 0 to disable)
+#define IDLE_DIM_TIMEOUT     60
+#define IDLE_BLANK_TIMEOUT   300
+#define IDLE_DIM_BRIGHTNESS  10
+
+// time given to the menu key at boot, without bootkey.conf (ms)
+#define BOOT_KEY_WAIT_MS     1500
+
 static int adbd_ready = 0;
 
 /**
@@ -434,6 +443,9 @@ int show_menu_tools(void) {
 #define TOOL_ADB     0
 #define USB_TOOLS    1
 #define FS_TOOLS     2
+#define RENDER_STATS 3
+#define SCREENSHOT   4
+#define SCREEN_STREAM 5
 
 #ifndef BOARD_MMC_DEVICE
 #define BOARD_MMC_DEVICE "/dev/block/mmcblk1"
@@ -453,7 +465,9 @@ int show_menu_tools(void) {
     {MENUITEM_SMALL, "ADB Daemon", NULL},
     {MENUITEM_SMALL, "USB Mount tools", NULL},
     {MENUITEM_SMALL, "File System Tools", NULL},
-    {MENUITEM_SMALL, "", NULL},
+    {MENUITEM_SMALL, "Render stats", NULL},
+    {MENUITEM_SMALL, "Screenshot", NULL},
+    {MENUITEM_SMALL, "Screen stream", NULL},
     {MENUITEM_SMALL, "<--Go Back", NULL},
     {MENUITEM_NULL, NULL, NULL},
   };
@@ -475,6 +489,26 @@ int show_menu_tools(void) {
         show_menu_fs_tools();
         break;
 
+      case RENDER_STATS:
+        ui_show_render_stats(!ui_render_stats_visible());
+        if (ui_dump_render_stats(FILE_RENDER_STATS) == 0)
+          ui_print("Render stats saved to %s\n", FILE_RENDER_STATS);
+        break;
+
+      case SCREENSHOT:
+        if (ui_save_screenshot(FILE_SCREENSHOT) == 0)
+          ui_print("Screenshot saved to %s\n", FILE_SCREENSHOT);
+        break;
+
+      case SCREEN_STREAM:
+        if (ui_screen_streamed()) {
+          ui_stream_screen(DISABLE);
+          ui_print("Screen stream stopped\n");
+        } else if (ui_stream_screen(ENABLE) == 0) {
+          ui_print("Screen stream on %s\n", GR_CAPTURE_SOCKET);
+        }
+        break;
+
     default:
       break;
   }
@@ -681,6 +715,135 @@ int led_alert(const char* color, int value) {
   return 1;
 }
 
+/**
+ * load_idle_config()
+ *
+ * Idle timeouts of the display, see idle.conf
+ */
+int load_idle_config(void) {
+  int dim = IDLE_DIM_TIMEOUT, blank = IDLE_BLANK_TIMEOUT;
+  int brightness = IDLE_DIM_BRIGHTNESS;
+  char name[64];
+  int value;
+  FILE *fp = fopen(FILE_IDLE_CONF, "r");
+
+  if (fp != NULL) {
+    while (fscanf(fp, "%63s %d", name, &value) == 2) {
+      if (!strcmp(name, "dim_timeout"))
+        dim = value;
+      else if (!strcmp(name, "blank_timeout"))
+        blank = value;
+      else if (!strcmp(name, "dim_brightness"))
+        brightness = value;
+    }
+    fclose(fp);
+  }
+
+  ui_set_idle_timeouts(dim, blank, brightness);
+  return fp != NULL ? 0 : 1;
+}
+
+// key names of bootkey.conf, a code in decimal or hex works too
+static const struct {
+  const char *name;
+  int code;
+} key_names[] = {
+  { "VOLUMEUP",   KEY_VOLUMEUP },
+  { "VOLUMEDOWN", KEY_VOLUMEDOWN },
+  { "CAMERA",     KEY_CAMERA },
+  { "POWER",      KEY_POWER },
+  { "MENU",       KEY_MENU },
+  { "HOME",       KEY_HOME },
+  { "BACK",       KEY_BACK },
+  { "SEARCH",     KEY_SEARCH },
+};
+
+static int parse_key(const char *name) {
+  unsigned i;
+  char *end;
+  long code;
+
+  for (i = 0; i < sizeof(key_names) / sizeof(key_names[0]); i++) {
+    if (!strcmp(name, key_names[i].name))
+      return key_names[i].code;
+  }
+  code = strtol(name, &end, 0);
+  if (*end != '\0' || code <= 0 || code > KEY_MAX)
+    return -1;
+  return code;
+}
+
+// "KEY+KEY..." and a target, returns -1 if invalid
+static int parse_chord(struct boot_chord *chord, char *keys, const char *target) {
+  char *key, *save;
+  int code;
+
+  if (strcmp(target, "shell") && strcmp(str_mode(int_mode((char*) target)), target))
+    return -1;
+
+  chord->count = 0;
+  for (key = strtok_r(keys, "+", &save); key; key = strtok_r(NULL, "+", &save)) {
+    code = parse_key(key);
+    if (code < 0 || chord->count == BOOT_CHORD_KEYS)
+      return -1;
+    chord->keys[chord->count++] = code;
+  }
+  if (chord->count == 0)
+    return -1;
+
+  snprintf(chord->target, sizeof(chord->target), "%s", target);
+  return 0;
+}
+
+/**
+ * load_bootkey_config()
+ *
+ * Time to wait for the boot keys in ms and their chords, see bootkey.conf
+ */
+int load_bootkey_config(struct bootkey_config *conf) {
+  char line[128], name[16], keys[64], target[16], led[16];
+  struct boot_chord *chord;
+  int n;
+  FILE *fp = fopen(FILE_BOOTKEY_CONF, "r");
+
+  memset(conf, 0, sizeof(*conf));
+  conf->wait_ms = BOOT_KEY_WAIT_MS;
+
+  if (fp != NULL) {
+    while (fgets(line, sizeof(line), fp) != NULL) {
+      n = sscanf(line, "%15s %63s %15s %15s", name, keys, target, led);
+      if (n < 2 || name[0] == '#')
+        continue;
+
+      if (!strcmp(name, "wait_ms")) {
+        conf->wait_ms = atoi(keys);
+      } else if (!strcmp(name, "chord") && n >= 3 && conf->chord_count < BOOT_CHORD_MAX) {
+        chord = &conf->chords[conf->chord_count];
+        if (parse_chord(chord, keys, target) < 0) {
+          LOGE("Invalid boot chord: %s", line);
+          continue;
+        }
+        snprintf(chord->led, sizeof(chord->led), "%s", n == 4 ? led : "");
+        conf->chord_count++;
+      }
+    }
+    fclose(fp);
+  }
+
+  if (conf->wait_ms < 0)
+    conf->wait_ms = 0;
+
+  // without chords, the menu key
+  if (conf->chord_count == 0) {
+    chord = &conf->chords[conf->chord_count++];
+    chord->keys[0] = KEY_VOLUMEDOWN;
+    chord->count = 1;
+    strcpy(chord->target, "bootmenu");
+  }
+
+  return fp != NULL ? 0 : 1;
+}
+
 /**
  * bypass_sign()
  *
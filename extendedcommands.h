@@ -48,9 +48,14 @@ static const char *FILE_BOOTMODE_CLEAN  = BM_ROOTDIR "/script/bootmode_clean.sh"
 static const char *FILE_DEFAULTBOOTMODE = BM_ROOTDIR "/config/default_bootmode.conf";
 static const char *FILE_BOOTMODE        = BOOTMODE_CONFIG_FILE;
 static const char *FILE_BYPASS          = "/data/.bootmenu_bypass";
+static const char *FILE_RENDER_STATS    = "/cache/bootmenu/render_stats";
+static const char *FILE_SCREENSHOT      = "/cache/bootmenu/screenshot.png";
+static const char *FILE_IDLE_CONF       = BM_ROOTDIR "/config/idle.conf";
+static const char *FILE_BOOTKEY_CONF    = BM_ROOTDIR "/config/bootkey.conf";
 
 static const char *SYS_POWER_CONNECTED  = "/sys/class/power_supply/ac/online";
 static const char *SYS_USB_CONNECTED    = "/sys/class/power_supply/usb/online";
+static const char *SYS_LCD_BACKLIGHT    = "/sys/class/leds/lcd-backlight/brightness";
 static const char *SYS_BATTERY_LEVEL    = "/sys/class/power_supply/battery/charge_counter"; // content: 0 to 100
 
 int int_mode(char* mode);
@@ -78,6 +83,24 @@ int get_bootmode(int clean, int log);
 int bootmode_write(const char* str);
 int next_bootmode_write(const char* str);
 
+int load_idle_config(void);
+// boot key chords of bootkey.conf
+#define BOOT_CHORD_MAX   8
+#define BOOT_CHORD_KEYS  4
+struct boot_chord {
+  int keys[BOOT_CHORD_KEYS];
+  int count;
+  char target[16];  // a boot mode, or "shell"
+  char led[16];     // blinked once recognized, none if empty
+};
+struct bootkey_config {
+  int wait_ms;
+  struct boot_chord chords[BOOT_CHORD_MAX];
+  int chord_count;
+};
+
+int load_bootkey_config(struct bootkey_config *conf);
+
 int bypass_sign(const char* mode);
 int bypass_check(void);
 
@@ -4,7 +4,7 @@ LOCAL_PATH := $(call my-dir)
 
 include $(CLEAR_VARS)
 
-LOCAL_SRC_FILES := events.c resources.c
+LOCAL_SRC_FILES := events.c resources.c displaylist.c spans.c render_stats.c capture.c raster.c
 
 ifneq ($(BOARD_CUSTOM_BOOTMENU_GRAPHICS),)
   LOCAL_SRC_FILES += $(BOARD_CUSTOM_BOOTMENU_GRAPHICS)
@@ -19,6 +19,10 @@ LOCAL_C_INCLUDES +=\
 LOCAL_MODULE := libminui_bm
 LOCAL_MODULE_TAGS := eng debug
 
+ifeq ($(ARCH_ARM_HAVE_NEON),true)
+    LOCAL_ARM_NEON := true
+endif
+
 # Defy use this :
 ifeq ($(TARGET_RECOVERY_PIXEL_FORMAT),"BGRA_8888")
     LOCAL_CFLAGS += -DPIXELS_BGRA
@@ -39,8 +43,65 @@ endif
 # Reversed 16bits RGB (ics software gralloc)
 #LOCAL_CFLAGS += -DPIXELS_BGR_16BPP
 
+# large damage rasterized in bands by all the cores
+ifeq ($(TARGET_CPU_SMP),true)
+    LOCAL_CFLAGS += -DGR_PARALLEL_RASTER
+endif
+
 include $(BUILD_STATIC_LIBRARY)
 
+# span kernels against pixelflinger, pixels/second
+include $(CLEAR_VARS)
+LOCAL_MODULE := bm_bench_spans
+LOCAL_MODULE_STEM := bench_spans
+LOCAL_MODULE_TAGS := optional
+LOCAL_SRC_FILES := bench_spans.c spans.c
+ifeq ($(ARCH_ARM_HAVE_NEON),true)
+    LOCAL_ARM_NEON := true
+endif
+LOCAL_STATIC_LIBRARIES := libpixelflinger_static libc libcutils liblog
+LOCAL_FORCE_STATIC_EXECUTABLE := true
+include $(BUILD_EXECUTABLE)
+
+# ui.c rendering over the headless backend, on the host: frames/second,
+# ns/frame and bytes touched of a few scenes
+include $(CLEAR_VARS)
+LOCAL_MODULE := bm_bench_render
+LOCAL_MODULE_STEM := bench_render
+LOCAL_MODULE_TAGS := optional
+LOCAL_SRC_FILES := bench_render.c graphics_mem.c displaylist.c events.c spans.c render_stats.c \
+    capture.c raster.c ../default_bootmenu_ui.c
+LOCAL_CFLAGS += -DBOOTMENU_VERSION="\"bench\"" -DMAX_ROWS=44 -DMAX_COLS=96
+LOCAL_C_INCLUDES += external/zlib
+LOCAL_STATIC_LIBRARIES := libz
+LOCAL_LDLIBS += -lpthread
+include $(BUILD_HOST_EXECUTABLE)
+
+# images packed in the pixel format of the board, mapped at startup
+include $(CLEAR_VARS)
+LOCAL_MODULE := bm_mkassets
+LOCAL_MODULE_STEM := mkassets
+LOCAL_MODULE_TAGS := optional
+LOCAL_SRC_FILES := mkassets.c
+LOCAL_C_INCLUDES += external/libpng external/zlib
+LOCAL_STATIC_LIBRARIES := libpng libz
+include $(BUILD_HOST_EXECUTABLE)
+
+bootmenu_mkassets := $(LOCAL_INSTALLED_MODULE)
+bootmenu_assets := $(TARGET_OUT)/bootmenu/images/assets.bin
+bootmenu_assets_format := $(TARGET_RECOVERY_PIXEL_FORMAT)
+ifeq ($(bootmenu_assets_format),)
+    bootmenu_assets_format := RGB_565
+endif
+
+$(bootmenu_assets): PRIVATE_MKASSETS := $(bootmenu_mkassets)
+$(bootmenu_assets): PRIVATE_FORMAT := $(bootmenu_assets_format)
+$(bootmenu_assets): $(wildcard $(LOCAL_PATH)/../images/*.png) $(bootmenu_mkassets)
+	@mkdir -p $(dir $@)
+	$(PRIVATE_MKASSETS) -f $(PRIVATE_FORMAT) -o $@ $(filter %.png,$^)
+
+ALL_DEFAULT_INSTALLED_MODULES += $(bootmenu_assets)
+
 #include $(CLEAR_VARS)
 #LOCAL_MODULE := bm_mkfont
 #LOCAL_MODULE_STEM := mkfont
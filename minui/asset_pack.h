@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _MINUI_ASSET_PACK_H_
+#define _MINUI_ASSET_PACK_H_
+
+#include <stdint.h>
+
+/*
+ * Asset pack, written at build time by mkassets from the png files of
+ * images/, and mapped read-only by res_create_surface().
+ *
+ * A header, an index of count entries, then the pixels of each image at
+ * a 16 bytes aligned offset from the start of the file. The pixels are
+ * already in the format the image is blitted from: the board's pixel
+ * format for opaque images, RGBA_8888 (BGRA_8888) for the others.
+ * Everything is little endian, as the devices.
+ */
+
+#define ASSET_PACK_MAGIC   0x504d4221 /* "!BMP" */
+#define ASSET_PACK_VERSION 1
+#define ASSET_NAME_MAX     32
+#define ASSET_ALIGN        16
+
+struct asset_pack_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+};
+
+struct asset_pack_entry {
+    char name[ASSET_NAME_MAX];  // file name without .png, nul terminated
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;            // in pixels
+    uint32_t format;            // GGL_PIXEL_FORMAT_*
+    uint32_t offset;            // of the first row, from the start of the file
+    uint32_t size;              // of the pixels, in bytes
+};
+
+#endif /* _MINUI_ASSET_PACK_H_ */
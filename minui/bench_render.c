@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Render benchmark of the bootmenu ui, on the host or on a device, over
+ * the headless backend (graphics_mem.c).
+ *
+ * ui.c is built into this file so that update_screen() can be driven
+ * directly through a few scenes, without input devices nor loop thread.
+ * Each scene is drawn with a small change on every frame, once as a full
+ * repaint and once through the display list (only the damage redrawn).
+ *
+ *   bench_render [-s WIDTHxHEIGHT] [-f RGB_565|RGBA_8888|RGBX_8888|BGRA_8888]
+ *                [-n frames] [-j threads]
+ *
+ * -j rasterizes the large damage with the raster pool, as on SMP boards.
+ */
+
+#include "../ui.c"
+
+#include <pixelflinger/pixelflinger.h>
+
+#include "graphics_internal.h"
+#include "spans.h"
+
+/* the parts of bootmenu that ui.c needs */
+
+int usb_connected(void) { return 1; }
+int adb_started(void) { return 0; }
+int battery_level(void) { return 85; }
+
+int res_create_surface(const char* name, gr_surface* pSurface) {
+  *pSurface = NULL;
+  return -1;
+}
+
+void res_free_surface(gr_surface* pSurface) {
+}
+
+static const struct {
+  int format;
+  const char *name;
+} formats[] = {
+  { GGL_PIXEL_FORMAT_RGB_565,   "RGB_565" },
+  { GGL_PIXEL_FORMAT_RGBA_8888, "RGBA_8888" },
+  { GGL_PIXEL_FORMAT_RGBX_8888, "RGBX_8888" },
+  { GGL_PIXEL_FORMAT_BGRA_8888, "BGRA_8888" },
+};
+
+static struct UiMenuItem main_items[] = {
+  {MENUITEM_SMALL, "Boot", NULL},
+  {MENUITEM_SMALL, "CPU Settings", ""},
+  {MENUITEM_SMALL, "Recovery", ""},
+  {MENUITEM_SMALL, "Tools", ""},
+  {MENUITEM_SMALL, "----------------------", ""},
+  {MENUITEM_SMALL, "Reboot", NULL},
+  {MENUITEM_SMALL, "Shutdown", ""},
+  {MENUITEM_NULL, NULL, NULL},
+};
+
+static struct UiMenuItem overclock_items[] = {
+  {MENUITEM_SMALL, "+Status: [Enable]", NULL},
+  {MENUITEM_SMALL, "----------------------", NULL},
+  {MENUITEM_SMALL, "+Scaling: [Interactive]", NULL},
+  {MENUITEM_SMALL, "+Sched: [Deadline]", NULL},
+  {MENUITEM_SMALL, "+Clk1: [300]", NULL},
+  {MENUITEM_SMALL, "+Clk2: [600]", NULL},
+  {MENUITEM_SMALL, "+Clk3: [800]", NULL},
+  {MENUITEM_SMALL, "+Clk4: [1000]", NULL},
+  {MENUITEM_SMALL, "+Vsel1: [33]", NULL},
+  {MENUITEM_SMALL, "+Vsel2: [48]", NULL},
+  {MENUITEM_SMALL, "+Vsel3: [58]", NULL},
+  {MENUITEM_SMALL, "+Vsel4: [62]", NULL},
+  {MENUITEM_SMALL, "Set defaults", NULL},
+  {MENUITEM_SMALL, "Save", NULL},
+  {MENUITEM_SMALL, "Load", NULL},
+  {MENUITEM_SMALL, "<--Go Back", NULL},
+  {MENUITEM_NULL, NULL, NULL},
+};
+
+static char *bench_headers[] = { "", NULL };
+
+/* scenes: set up once, then changed a little before each frame */
+
+static void log_line(int n)
+{
+  char line[MAX_COLS];
+  int len;
+
+  // same as ui_print_str(), without the copy to stdout
+  len = snprintf(line, sizeof(line), "I:mounting /dev/block/mmcblk1p%d on /sdcard-%d (vfat) ...", n % 25, n);
+  if (len > text_cols) len = text_cols;
+  memcpy(text[text_row], line, len);
+  text[text_row][len] = '\0';
+  text_row = (text_row + 1) % text_rows;
+  text_lines++;
+  if (text_row == text_top) text_top = (text_top + 1) % text_rows;
+}
+
+static void scene_menu(struct UiMenuItem *items)
+{
+  ui_start_menu(bench_headers, TABS, items, 0);
+  show_text = 1;
+  activeTab = 0;
+  menutop_diff = 0;
+  show_menu_selection = 0;
+}
+
+// the highlight moving down the list, as with the volume keys
+static void main_setup(void) { scene_menu(main_items); show_menu_selection = 1; }
+static void main_step(int frame) { menu_sel = frame % menu_items; }
+
+static void overclock_setup(void) { scene_menu(overclock_items); show_menu_selection = 1; }
+static void overclock_step(int frame) { menu_sel = frame % menu_items; }
+
+static void logs_setup(void)
+{
+  int i;
+
+  scene_menu(main_items);
+  activeTab = TAB_LOG;
+  for (i = 0; i < MAX_ROWS; i++)
+    log_line(i);
+}
+
+static void logs_step(int frame) { log_line(frame); }
+
+// back and forth between the menu and the logs, as with KEY_SEARCH
+static void tabs_setup(void) { logs_setup(); }
+static void tabs_step(int frame) { activeTab = frame % 2 ? 0 : TAB_LOG; }
+
+// the list released 300 pixels below its top, sliding back in 20 frames
+static void bounceback_setup(void) { scene_menu(overclock_items); }
+static void bounceback_step(int frame)
+{
+  int t = 20 - frame % 20;
+  menutop_diff = 300 * t * t / 400;
+}
+
+static const struct scene {
+  const char *name;
+  void (*setup)(void);
+  void (*step)(int frame);
+} scenes[] = {
+  { "main menu",  main_setup,       main_step },
+  { "overclock",  overclock_setup,  overclock_step },
+  { "logs",       logs_setup,       logs_step },
+  { "bounceback", bounceback_setup, bounceback_step },
+  { "tabs",       tabs_setup,       tabs_step },
+};
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// an opaque disc in a transparent square, as the background png
+static gr_surface make_icon(int size)
+{
+  GGLSurface *s = calloc(1, sizeof(GGLSurface) + size * size * 4);
+  unsigned char *p;
+  int x, y, r = size / 2;
+
+  if (s == NULL)
+    return NULL;
+  s->version = sizeof(*s);
+  s->width = s->height = s->stride = size;
+  s->format = GGL_PIXEL_FORMAT_RGBA_8888;
+  s->data = (unsigned char*) (s + 1);
+
+  for (p = s->data, y = 0; y < size; y++) {
+    for (x = 0; x < size; x++, p += 4) {
+      int d = (x - r) * (x - r) + (y - r) * (y - r);
+      p[0] = 20 + x / 4;
+      p[1] = 120;
+      p[2] = 200 - y / 4;
+      p[3] = d < (r - 2) * (r - 2) ? 255 : d < r * r ? 128 : 0;
+    }
+  }
+  return (gr_surface) s;
+}
+
+static void run_scene(const struct scene *sc, int frames, int full)
+{
+  struct gr_mem_stats st;
+  double t = 0, t0;
+  int i;
+
+  sc->setup();
+
+  // first frame draws the layers and the whole screen
+  sc->step(0);
+  gr_frame_invalidate();
+  update_screen();
+  gr_mem_get_stats(NULL, 1);
+
+  for (i = 1; i <= frames; i++) {
+    sc->step(i);
+    if (full)
+      gr_frame_invalidate();
+
+    t0 = now();
+    update_screen();
+    t += now() - t0;
+  }
+
+  gr_mem_get_stats(&st, 1);
+  printf("%-11s %-7s %9.1f %12.0f %14.0f\n", sc->name, full ? "full" : "damage",
+         frames / t, t * 1e9 / frames, (double) (st.written + st.read) / frames);
+}
+
+int main(int argc, char **argv)
+{
+  int width = 480, height = 854, frames = 500, threads = 1;
+  const char *format_name = "RGB_565";
+  int format = -1;
+  unsigned f;
+  int i;
+
+  for (i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%dx%d", &width, &height) != 2)
+        width = 0;
+    } else if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+      format_name = argv[++i];
+    } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      frames = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-j") && i + 1 < argc) {
+      threads = atoi(argv[++i]);
+    } else {
+      width = 0;
+      break;
+    }
+  }
+
+  for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+    if (!strcmp(format_name, formats[f].name))
+      format = formats[f].format;
+  }
+
+  if (width <= 0 || height <= 0 || frames <= 0 || format < 0 || threads <= 0
+   || gr_mem_set_mode(width, height, format) < 0) {
+    fprintf(stderr, "usage: %s [-s WIDTHxHEIGHT] [-f RGB_565|RGBA_8888|RGBX_8888|BGRA_8888]"
+                    " [-n frames] [-j threads]\n", argv[0]);
+    return 1;
+  }
+
+  // as ui_init(), without input nor loop thread
+  if (gr_init() < 0)
+    return 1;
+  threads = gr_raster_start(threads);
+  create_layers();
+  recalcSquare();
+
+  text_rows = gr_fb_height() / ROW_HEIGHT;
+  if (text_rows > MAX_ROWS) text_rows = MAX_ROWS;
+  text_top = 1;
+  text_cols = gr_fb_width() / gr_getfont_cwidth();
+  if (text_cols > MAX_COLS - 1) text_cols = MAX_COLS - 1;
+
+  gBackgroundIcon[BACKGROUND_DEFAULT] = make_icon(width / 2);
+  gCurrentIcon = gBackgroundIcon[BACKGROUND_DEFAULT];
+
+  printf("%dx%d %s, %d frames, spans: %s, %d raster threads\n", width, height, format_name, frames,
+         span_impl_name(), threads);
+  printf("%-11s %-7s %9s %12s %14s\n", "scene", "redraw", "fps", "ns/frame", "bytes/frame");
+
+  for (i = 0; i < (int) (sizeof(scenes) / sizeof(scenes[0])); i++) {
+    run_scene(&scenes[i], frames, 1);
+    run_scene(&scenes[i], frames, 0);
+  }
+
+  free_layers();
+  gr_exit();
+  free(gCurrentIcon);
+  return 0;
+}
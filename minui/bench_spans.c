@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Micro-benchmark of the span kernels against pixelflinger, for each
+ * framebuffer format, in the blending state used by graphics.c.
+ *
+ *   bench_spans [width height [iterations]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <pixelflinger/pixelflinger.h>
+
+#include "spans.h"
+
+enum {
+    OP_FILL,
+    OP_FILL_ALPHA,
+    OP_HLINE,
+    OP_GLYPHS,
+    OP_BLIT_RGBX,
+    OP_BLIT_RGBA,
+    OP_COUNT
+};
+
+static const char *op_names[OP_COUNT] = {
+    "fill", "fill alpha", "hline 4px", "glyphs", "blit rgbx", "blit rgba",
+};
+
+static const struct {
+    int format;
+    int bpp;
+    const char *name;
+} formats[] = {
+    { GGL_PIXEL_FORMAT_RGB_565,   2, "RGB_565" },
+    { GGL_PIXEL_FORMAT_RGBA_8888, 4, "RGBA_8888" },
+    { GGL_PIXEL_FORMAT_RGBX_8888, 4, "RGBX_8888" },
+    { GGL_PIXEL_FORMAT_BGRA_8888, 4, "BGRA_8888" },
+};
+
+#define GLYPH_W 10
+#define GLYPH_H 18
+
+static GGLSurface image_rgbx, image_rgba, glyphs;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void make_surface(GGLSurface *s, int w, int h, int format, int bpp)
+{
+    unsigned char *p;
+    int i;
+
+    memset(s, 0, sizeof(*s));
+    s->version = sizeof(*s);
+    s->width = w;
+    s->height = h;
+    s->stride = w;
+    s->format = format;
+    s->data = malloc(w * h * bpp);
+    for (p = s->data, i = 0; i < w * h * bpp; i++)
+        p[i] = rand();
+}
+
+static void make_sources(int w, int h)
+{
+    unsigned char *p;
+    int i;
+
+    make_surface(&image_rgbx, w, h, GGL_PIXEL_FORMAT_RGBX_8888, 4);
+    make_surface(&image_rgba, w, h, GGL_PIXEL_FORMAT_RGBA_8888, 4);
+
+    // mostly opaque or transparent, as icons are
+    for (p = image_rgba.data, i = 0; i < w * h; i++) {
+        int r = rand() % 4;
+        p[i * 4 + 3] = r == 0 ? 0 : r == 1 ? rand() : 255;
+    }
+
+    // binary coverage, as the fonts
+    make_surface(&glyphs, GLYPH_W * 96, GLYPH_H, GGL_PIXEL_FORMAT_A_8, 1);
+    for (p = glyphs.data, i = 0; i < GLYPH_W * 96 * GLYPH_H; i++)
+        p[i] = (rand() % 3) ? 0 : 255;
+}
+
+// returns the pixels drawn by one pass
+static long run_ggl(GGLContext *gl, GGLSurface *fb, int op)
+{
+    GGLint color[4] = { 0x8000, 0x4000, 0xc000, 0x10000 };
+    long pixels = 0;
+    int x, y;
+
+    if (op == OP_FILL_ALPHA)
+        color[3] = 0x8000;
+    gl->color4xv(gl, color);
+
+    switch (op) {
+    case OP_FILL:
+    case OP_FILL_ALPHA:
+        gl->disable(gl, GGL_TEXTURE_2D);
+        gl->recti(gl, 0, 0, fb->width, fb->height);
+        return (long) fb->width * fb->height;
+    case OP_HLINE:
+        gl->disable(gl, GGL_TEXTURE_2D);
+        for (y = 4; y + 4 <= (int) fb->height; y += 8) {
+            int v0[] = { 0, y * 16 };
+            int v1[] = { fb->width * 16, y * 16 };
+            gl->linex(gl, v0, v1, 4 * 16);
+            pixels += fb->width * 4;
+        }
+        return pixels;
+    case OP_GLYPHS:
+        gl->bindTexture(gl, &glyphs);
+        break;
+    case OP_BLIT_RGBX:
+        gl->bindTexture(gl, &image_rgbx);
+        break;
+    case OP_BLIT_RGBA:
+        gl->bindTexture(gl, &image_rgba);
+        break;
+    }
+
+    gl->texEnvi(gl, GGL_TEXTURE_ENV, GGL_TEXTURE_ENV_MODE, GGL_REPLACE);
+    gl->texGeni(gl, GGL_S, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
+    gl->texGeni(gl, GGL_T, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
+    gl->enable(gl, GGL_TEXTURE_2D);
+
+    if (op == OP_GLYPHS) {
+        for (y = 0; y + GLYPH_H <= (int) fb->height; y += GLYPH_H) {
+            for (x = 0; x + GLYPH_W <= (int) fb->width; x += GLYPH_W) {
+                int off = (x / GLYPH_W) % 96;
+                gl->texCoord2i(gl, off * GLYPH_W - x, -y);
+                gl->recti(gl, x, y, x + GLYPH_W, y + GLYPH_H);
+                pixels += GLYPH_W * GLYPH_H;
+            }
+        }
+        return pixels;
+    }
+
+    gl->texCoord2i(gl, 0, 0);
+    gl->recti(gl, 0, 0, fb->width, fb->height);
+    return (long) fb->width * fb->height;
+}
+
+static long run_spans(GGLSurface *fb, int op)
+{
+    struct span_color c;
+    long pixels = 0;
+    int x, y;
+
+    span_set_color(&c, fb->format, 0x80, 0x40, 0xc0, op == OP_FILL_ALPHA ? 0x80 : 0xff);
+
+    switch (op) {
+    case OP_FILL:
+    case OP_FILL_ALPHA:
+        span_fill_rect(fb, 0, 0, fb->width, fb->height, &c);
+        return (long) fb->width * fb->height;
+    case OP_HLINE:
+        for (y = 4; y + 4 <= (int) fb->height; y += 8) {
+            span_fill_rect(fb, 0, y - 2, fb->width, 4, &c);
+            pixels += fb->width * 4;
+        }
+        return pixels;
+    case OP_GLYPHS:
+        for (y = 0; y + GLYPH_H <= (int) fb->height; y += GLYPH_H) {
+            for (x = 0; x + GLYPH_W <= (int) fb->width; x += GLYPH_W) {
+                int off = (x / GLYPH_W) % 96;
+                span_blit_rect(fb, x, y, &glyphs, off * GLYPH_W, 0, GLYPH_W, GLYPH_H, &c);
+                pixels += GLYPH_W * GLYPH_H;
+            }
+        }
+        return pixels;
+    case OP_BLIT_RGBX:
+        span_blit_rect(fb, 0, 0, &image_rgbx, 0, 0, fb->width, fb->height, &c);
+        return (long) fb->width * fb->height;
+    case OP_BLIT_RGBA:
+        span_blit_rect(fb, 0, 0, &image_rgba, 0, 0, fb->width, fb->height, &c);
+        return (long) fb->width * fb->height;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int width = 480, height = 854, iterations = 50;
+    GGLContext *gl = NULL;
+    unsigned f;
+    int op, i;
+
+    if (argc >= 3) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+    }
+    if (argc >= 4)
+        iterations = atoi(argv[3]);
+    if (width <= 0 || height <= 0 || iterations <= 0) {
+        fprintf(stderr, "usage: %s [width height [iterations]]\n", argv[0]);
+        return 1;
+    }
+
+    make_sources(width, height);
+
+    gglInit(&gl);
+    gl->activeTexture(gl, 0);
+    gl->enable(gl, GGL_BLEND);
+    gl->blendFunc(gl, GGL_SRC_ALPHA, GGL_ONE_MINUS_SRC_ALPHA);
+
+    printf("%dx%d, %d iterations, spans: %s\n", width, height, iterations, span_impl_name());
+    printf("%-10s %-11s %14s %14s %8s\n", "format", "op", "pixelflinger", "spans", "speedup");
+
+    for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        GGLSurface fb;
+
+        make_surface(&fb, width, height, formats[f].format, formats[f].bpp);
+        gl->colorBuffer(gl, &fb);
+
+        for (op = 0; op < OP_COUNT; op++) {
+            double t, t_ggl, t_spans;
+            long px_ggl = 0, px_spans = 0;
+
+            t = now();
+            for (i = 0; i < iterations; i++)
+                px_ggl += run_ggl(gl, &fb, op);
+            t_ggl = now() - t;
+
+            t = now();
+            for (i = 0; i < iterations; i++)
+                px_spans += run_spans(&fb, op);
+            t_spans = now() - t;
+
+            printf("%-10s %-11s %9.1f Mp/s %9.1f Mp/s %7.1fx\n",
+                   formats[f].name, op_names[op],
+                   px_ggl / t_ggl / 1e6, px_spans / t_spans / 1e6,
+                   (px_spans / t_spans) / (px_ggl / t_ggl));
+        }
+
+        free(fb.data);
+    }
+
+    gglUninit(gl);
+    return 0;
+}
@@ -0,0 +1,629 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Screen capture
+ *
+ * A png snapshot of the screen, and a stream of its changes to a client
+ * of a unix socket, e.g. through "adb forward tcp:5039
+ * localfilesystem:/tmp/bootmenu-capture". The socket only exists between
+ * gr_capture_start() and gr_capture_stop(), asked for from the Tools menu,
+ * and only root can connect to it. Its thread sleeps until a client comes.
+ *
+ * Nothing is copied while drawing: the backend brackets each flip with
+ * gr_capture_changing() and gr_capture_changed(), which bump a sequence
+ * number and mark the rows changed. The capture reads the page on screen
+ * from its own thread, and reads it again if a flip happened meanwhile.
+ * The page on screen is not drawn into until the next flip, so a flip
+ * only waits for a capture after CAPTURE_TRIES reads in a row were
+ * spoiled by flips (a steady animation): the next flip is then held off
+ * for the time of one copy.
+ *
+ * Stream, little endian:
+ *
+ *   header  "BMCS", u16 width, u16 height, u16 format (GGL_PIXEL_FORMAT_*),
+ *           u16 bytes per pixel
+ *   frame   u32 milliseconds since the connection, u32 count of rects
+ *   rect    u16 left, u16 top, u16 width, u16 height, u32 size, then size
+ *           bytes of pixels, row after row, as packets of a byte n:
+ *           n < 128: n + 1 pixels follow, n >= 128: one pixel follows,
+ *           repeated n - 127 times. Packets don't span rows.
+ *
+ * The first frame is the whole screen, the next ones only the rectangles
+ * which changed, at most CAPTURE_FPS frames and CAPTURE_MAX_RATE bytes
+ * per second.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include <zlib.h>
+#include <pixelflinger/pixelflinger.h>
+
+#include "minui.h"
+#include "graphics_internal.h"
+
+#define CAPTURE_FPS      30
+#define CAPTURE_MAX_RATE (4 * 1024 * 1024)
+#define CAPTURE_TRIES    3
+
+// odd while the page on screen changes, only written by the drawing thread
+static volatile unsigned capture_seq = 0;
+// held by the drawing thread during a flip
+static pthread_mutex_t capture_flip_mutex = PTHREAD_MUTEX_INITIALIZER;
+// rows changed since the last frame streamed, while a client is connected
+static unsigned char *capture_dirty = NULL;
+static volatile int capture_streaming = 0;
+
+static pthread_t capture_thread;
+static volatile int capture_running = 0;
+static int capture_fd = -1;
+static int capture_wake_fd = -1;    // eventfd, written by gr_capture_stop()
+
+void gr_capture_changing(void)
+{
+    pthread_mutex_lock(&capture_flip_mutex);
+    capture_seq++;
+    __sync_synchronize();
+}
+
+void gr_capture_changed(const struct gr_rect *rects, int count)
+{
+    int i, height = gr_fb_height();
+
+    __sync_synchronize();
+    if (capture_streaming) {
+        if (rects == NULL) {
+            memset(capture_dirty, 1, height);
+        } else {
+            for (i = 0; i < count; i++) {
+                int top = rects[i].top < 0 ? 0 : rects[i].top;
+                int bottom = rects[i].bottom > height ? height : rects[i].bottom;
+                if (top < bottom)
+                    memset(capture_dirty + top, 1, bottom - top);
+            }
+        }
+        __sync_synchronize();
+    }
+    capture_seq++;
+    pthread_mutex_unlock(&capture_flip_mutex);
+}
+
+static int capture_bpp(int format)
+{
+    return format == GGL_PIXEL_FORMAT_RGB_565 ? 2 : 4;
+}
+
+// Copy the rows of the screen set in rows (all if NULL) to dst, packed.
+static void copy_screen(unsigned char *dst, const unsigned char *rows)
+{
+    const GGLSurface *src = (const GGLSurface *) gr_capture_surface();
+    int bpp = capture_bpp(src->format);
+    int len = src->width * bpp;
+    int y;
+
+    for (y = 0; y < (int) src->height; y++) {
+        if (rows == NULL || rows[y])
+            memcpy(dst + y * len, src->data + y * src->stride * bpp, len);
+    }
+}
+
+// The same from a single frame: again while a flip happened during the
+// copy, with the flips held off after CAPTURE_TRIES times.
+static void read_screen(unsigned char *dst, const unsigned char *rows)
+{
+    unsigned seq;
+    int tries;
+
+    for (tries = 0; tries < CAPTURE_TRIES; tries++) {
+        seq = capture_seq;
+        if (seq & 1) {
+            usleep(1000);
+            continue;
+        }
+        __sync_synchronize();
+
+        copy_screen(dst, rows);
+
+        __sync_synchronize();
+        if (capture_seq == seq)
+            return;
+    }
+
+    pthread_mutex_lock(&capture_flip_mutex);
+    copy_screen(dst, rows);
+    pthread_mutex_unlock(&capture_flip_mutex);
+}
+
+static void put16(unsigned char *p, unsigned v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(unsigned char *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static void put32be(unsigned char *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+/* png snapshot */
+
+static int png_chunk(FILE *f, const char *type, const unsigned char *data, unsigned len)
+{
+    unsigned char buf[4];
+    uLong crc;
+
+    put32be(buf, len);
+    crc = crc32(crc32(0, NULL, 0), (const Bytef *) type, 4);
+    if (len)
+        crc = crc32(crc, data, len);
+    if (fwrite(buf, 1, 4, f) != 4 || fwrite(type, 1, 4, f) != 4
+     || (len && fwrite(data, 1, len, f) != len))
+        return -1;
+    put32be(buf, crc);
+    return fwrite(buf, 1, 4, f) == 4 ? 0 : -1;
+}
+
+// a row of pixels to 8 bits rgb
+static void row_to_rgb(unsigned char *out, const unsigned char *p, int width, int format)
+{
+    int x;
+
+    for (x = 0; x < width; x++, out += 3) {
+        switch (format) {
+        case GGL_PIXEL_FORMAT_RGB_565: {
+            unsigned v = p[0] | (p[1] << 8);
+            unsigned r = (v >> 11) & 0x1f, g = (v >> 5) & 0x3f, b = v & 0x1f;
+#ifdef PIXELS_BGR_16BPP
+            unsigned t = r;
+            r = b;
+            b = t;
+#endif
+            out[0] = (r << 3) | (r >> 2);
+            out[1] = (g << 2) | (g >> 4);
+            out[2] = (b << 3) | (b >> 2);
+            p += 2;
+            break;
+        }
+        case GGL_PIXEL_FORMAT_BGRA_8888:
+            out[0] = p[2];
+            out[1] = p[1];
+            out[2] = p[0];
+            p += 4;
+            break;
+        default:
+            memcpy(out, p, 3);
+            p += 4;
+            break;
+        }
+    }
+}
+
+static int write_png(FILE *f, const unsigned char *pixels, int width, int height, int format)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    unsigned char ihdr[13], out[16384];
+    unsigned char *row;
+    int bpp = capture_bpp(format);
+    int y, ret = -1, flush;
+    z_stream zs;
+
+    row = malloc(1 + width * 3);
+    if (row == NULL)
+        return -1;
+    memset(&zs, 0, sizeof(zs));
+    if (deflateInit(&zs, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        free(row);
+        return -1;
+    }
+
+    put32be(ihdr, width);
+    put32be(ihdr + 4, height);
+    ihdr[8] = 8;    // bits per channel
+    ihdr[9] = 2;    // rgb
+    ihdr[10] = ihdr[11] = ihdr[12] = 0;
+    if (fwrite(signature, 1, sizeof(signature), f) != sizeof(signature)
+     || png_chunk(f, "IHDR", ihdr, sizeof(ihdr)) < 0)
+        goto exit;
+
+    // one IDAT per output buffer filled
+    zs.next_out = out;
+    zs.avail_out = sizeof(out);
+    for (y = 0; y <= height; y++) {
+        if (y < height) {
+            row[0] = 0; // no filter
+            row_to_rgb(row + 1, pixels + y * width * bpp, width, format);
+            zs.next_in = row;
+            zs.avail_in = 1 + width * 3;
+            flush = Z_NO_FLUSH;
+        } else {
+            zs.avail_in = 0;
+            flush = Z_FINISH;
+        }
+        for (;;) {
+            int err = deflate(&zs, flush);
+            if (err == Z_STREAM_ERROR)
+                goto exit;
+            if (zs.avail_out == 0 || (err == Z_STREAM_END && zs.avail_out < sizeof(out))) {
+                if (png_chunk(f, "IDAT", out, sizeof(out) - zs.avail_out) < 0)
+                    goto exit;
+                zs.next_out = out;
+                zs.avail_out = sizeof(out);
+            }
+            if (err == Z_STREAM_END || (flush == Z_NO_FLUSH && zs.avail_in == 0))
+                break;
+        }
+    }
+
+    ret = png_chunk(f, "IEND", NULL, 0);
+
+exit:
+    deflateEnd(&zs);
+    free(row);
+    return ret;
+}
+
+int gr_capture_snapshot(const char *path)
+{
+    const GGLSurface *screen = (const GGLSurface *) gr_capture_surface();
+    int width = screen->width, height = screen->height, format = screen->format;
+    unsigned char *pixels;
+    FILE *f;
+    int ret;
+
+    pixels = malloc(width * height * capture_bpp(format));
+    if (pixels == NULL)
+        return -1;
+    read_screen(pixels, NULL);
+
+    gr_make_parent_dir(path);
+    f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        free(pixels);
+        return -1;
+    }
+    ret = write_png(f, pixels, width, height, format);
+    if (fclose(f) != 0)
+        ret = -1;
+    if (ret < 0) {
+        fprintf(stderr, "%s: write failed\n", path);
+        unlink(path);
+    }
+    free(pixels);
+    return ret;
+}
+
+/* stream */
+
+static uint64_t now_ms(void)
+{
+    return gr_stats_now() / 1000000;
+}
+
+static int send_all(int fd, const unsigned char *p, size_t len)
+{
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+// the client closed the connection (it sends nothing)
+static int client_gone(int fd)
+{
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    unsigned char buf[64];
+
+    if (poll(&pfd, 1, 0) <= 0)
+        return 0;
+    return recv(fd, buf, sizeof(buf), MSG_DONTWAIT) <= 0;
+}
+
+// columns [*x1, *x2) where the rows of a and b differ, 0 if equal
+static int row_diff(const unsigned char *a, const unsigned char *b, int width, int bpp,
+                    int *x1, int *x2)
+{
+    int l = 0, r = width * bpp;
+
+    while (l < r && a[l] == b[l])
+        l++;
+    if (l == r)
+        return 0;
+    while (a[r - 1] == b[r - 1])
+        r--;
+    *x1 = l / bpp;
+    *x2 = (r + bpp - 1) / bpp;
+    return 1;
+}
+
+static unsigned char *rle_row(unsigned char *out, const unsigned char *p, int n, int bpp)
+{
+    int i = 0, run, lit;
+
+    while (i < n) {
+        for (run = 1; i + run < n && run < 128
+                      && !memcmp(p + (i + run) * bpp, p + i * bpp, bpp); run++) {}
+        if (run > 1) {
+            *out++ = 127 + run;
+            memcpy(out, p + i * bpp, bpp);
+            out += bpp;
+            i += run;
+            continue;
+        }
+
+        // up to the next pair of equal pixels
+        for (lit = 1; i + lit < n && lit < 128; lit++) {
+            if (i + lit + 1 < n && !memcmp(p + (i + lit) * bpp, p + (i + lit + 1) * bpp, bpp))
+                break;
+        }
+        *out++ = lit - 1;
+        memcpy(out, p + i * bpp, lit * bpp);
+        out += lit * bpp;
+        i += lit;
+    }
+    return out;
+}
+
+// encode the rectangle of image in out, after its header
+static unsigned char *put_rect(unsigned char *out, const unsigned char *image, int width,
+                               int bpp, int x1, int y1, int x2, int y2)
+{
+    unsigned char *p = out + 12;
+    int y;
+
+    for (y = y1; y < y2; y++)
+        p = rle_row(p, image + (y * width + x1) * bpp, x2 - x1, bpp);
+
+    put16(out, x1);
+    put16(out + 2, y1);
+    put16(out + 4, x2 - x1);
+    put16(out + 6, y2 - y1);
+    put32(out + 8, p - out - 12);
+    return p;
+}
+
+static void stream_to(int fd)
+{
+    const GGLSurface *screen = (const GGLSurface *) gr_capture_surface();
+    int width = screen->width, height = screen->height, format = screen->format;
+    int bpp = capture_bpp(format), len = width * bpp;
+    size_t size = height * len;
+    unsigned char *image, *next, *rows, *out, *p;
+    struct pollfd stop = { capture_wake_fd, POLLIN, 0 };
+    uint64_t start, frame, wait;
+    int y, top, x1, x2, rx1, rx2, count, first = 1;
+
+    image = malloc(size);
+    next = malloc(size);
+    rows = malloc(height);
+    // worst case: a packet per 128 pixels and a header per row
+    out = malloc(size + height * (width / 128 + 1 + 12) + 8);
+    if (!image || !next || !rows || !out)
+        goto exit;
+
+    memcpy(out, "BMCS", 4);
+    put16(out + 4, width);
+    put16(out + 6, height);
+    put16(out + 8, format);
+    put16(out + 10, bpp);
+    if (send_all(fd, out, 12) < 0)
+        goto exit;
+
+    memset(capture_dirty, 1, height);
+    __sync_synchronize();
+    capture_streaming = 1;
+    start = now_ms();
+
+    while (capture_running && !client_gone(fd)) {
+        frame = now_ms();
+
+        // take the rows changed since the last frame
+        for (count = 0, y = 0; y < height; y++)
+            count += rows[y] = __sync_lock_test_and_set(&capture_dirty[y], 0);
+
+        p = out + 8;
+        if (count > 0) {
+            read_screen(next, rows);
+
+            // a rectangle per run of rows which changed, the whole
+            // screen for the first frame
+            for (count = 0, y = 0; y < height; ) {
+                if (first) {
+                    x1 = 0;
+                    x2 = width;
+                    top = 0;
+                    y = height;
+                } else {
+                    if (!rows[y] || !row_diff(image + y * len, next + y * len, width, bpp, &x1, &x2)) {
+                        y++;
+                        continue;
+                    }
+                    for (top = y++; y < height && rows[y]
+                                    && row_diff(image + y * len, next + y * len, width, bpp, &rx1, &rx2); y++) {
+                        if (rx1 < x1) x1 = rx1;
+                        if (rx2 > x2) x2 = rx2;
+                    }
+                }
+                p = put_rect(p, next, width, bpp, x1, top, x2, y);
+                memcpy(image + top * len, next + top * len, (y - top) * len);
+                count++;
+            }
+            first = 0;
+        }
+
+        if (count > 0) {
+            put32(out, frame - start);
+            put32(out + 4, count);
+            if (send_all(fd, out, p - out) < 0)
+                break;
+        }
+
+        // the next frame after the bytes sent drained at the max rate
+        wait = 1000 / CAPTURE_FPS;
+        if ((uint64_t) (p - out) * 1000 / CAPTURE_MAX_RATE > wait)
+            wait = (uint64_t) (p - out) * 1000 / CAPTURE_MAX_RATE;
+        frame = now_ms() - frame;
+        if (frame < wait)
+            poll(&stop, 1, wait - frame);
+    }
+
+exit:
+    capture_streaming = 0;
+    free(image);
+    free(next);
+    free(rows);
+    free(out);
+}
+
+static void *capture_loop(void *cookie)
+{
+    struct pollfd pfd[2] = {
+        { capture_fd, POLLIN, 0 },
+        { capture_wake_fd, POLLIN, 0 },
+    };
+    struct timeval tv = { 1, 0 };
+    int fd;
+
+    while (capture_running) {
+        // until a client connects or gr_capture_stop()
+        if (poll(pfd, 2, -1) <= 0 || !(pfd[0].revents & POLLIN))
+            continue;
+        fd = accept(capture_fd, NULL, NULL);
+        if (fd < 0)
+            continue;
+        // a stuck client doesn't keep the thread from stopping
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        stream_to(fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+int gr_capture_start(const char *socket_path)
+{
+    struct sockaddr_un addr;
+
+    if (capture_running)
+        return 0;
+
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+        return -1;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+
+    capture_dirty = calloc(1, gr_fb_height());
+    if (capture_dirty == NULL)
+        return -1;
+
+    capture_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (capture_fd < 0) {
+        perror("capture socket");
+        goto fail;
+    }
+    fcntl(capture_fd, F_SETFD, FD_CLOEXEC);
+    unlink(socket_path);
+    // the screen may show what root only can read
+    if (bind(capture_fd, (struct sockaddr *) &addr, sizeof(addr)) < 0
+     || chmod(socket_path, 0600) < 0
+     || listen(capture_fd, 1) < 0) {
+        perror(socket_path);
+        unlink(socket_path);
+        goto fail;
+    }
+
+    capture_wake_fd = eventfd(0, EFD_CLOEXEC);
+    if (capture_wake_fd < 0) {
+        perror("capture eventfd");
+        unlink(socket_path);
+        goto fail;
+    }
+
+    capture_running = 1;
+    if (pthread_create(&capture_thread, NULL, capture_loop, NULL)) {
+        capture_running = 0;
+        unlink(socket_path);
+        goto fail;
+    }
+    return 0;
+
+fail:
+    if (capture_fd >= 0)
+        close(capture_fd);
+    capture_fd = -1;
+    if (capture_wake_fd >= 0)
+        close(capture_wake_fd);
+    capture_wake_fd = -1;
+    free(capture_dirty);
+    capture_dirty = NULL;
+    return -1;
+}
+
+void gr_capture_stop(void)
+{
+    struct sockaddr_un addr;
+    socklen_t len = sizeof(addr);
+    uint64_t one = 1;
+
+    if (!capture_running)
+        return;
+
+    capture_running = 0;
+    write(capture_wake_fd, &one, sizeof(one));
+    pthread_join(capture_thread, NULL);
+
+    if (getsockname(capture_fd, (struct sockaddr *) &addr, &len) == 0)
+        unlink(addr.sun_path);
+    close(capture_fd);
+    capture_fd = -1;
+    close(capture_wake_fd);
+    capture_wake_fd = -1;
+    free(capture_dirty);
+    capture_dirty = NULL;
+}
+
+int gr_capture_started(void)
+{
+    return capture_running;
+}
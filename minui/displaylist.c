@@ -0,0 +1,831 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Retained display list
+ *
+ * Between gr_frame_begin() and gr_frame_end() the drawing primitives only
+ * record themselves. At the end of the frame the list is compared op by op
+ * with the previous one, and only the screen rectangles covered by ops
+ * which changed (in the old or in the new frame) are rasterized again and
+ * flipped. A frame identical to the previous one costs the recording only.
+ *
+ * With the raster pool of SMP boards (raster.c), a large damage is cut in
+ * bands of rows replayed by all the cores at once.
+ *
+ * Page cache: a frame can belong to a page (a tab of the ui). When the
+ * page shown changes, the screen and the list of the page left are kept
+ * in an offscreen surface. When that page is shown again, the list is
+ * compared with the kept one instead of the previous frame: the kept
+ * pixels are copied back and only what changed meanwhile is drawn.
+ * A page is only kept when drawing it again was measured to cost more
+ * than the copies of the screen, out and back.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "minui.h"
+#include "graphics_internal.h"
+
+/* above this count, damaged rects are merged together */
+#define DL_MAX_DAMAGE 8
+
+/* smaller damage is not worth waking the raster pool: 1/8 of the screen */
+#define DL_PARALLEL_MIN_SHARE 8
+/* bands per thread, the ones with more text or blending are evened out */
+#define DL_BANDS_PER_THREAD 4
+#define DL_MIN_BAND_ROWS 16
+
+/* memory of the kept pages, the least recently shown ones are dropped */
+#ifndef DL_PAGE_CACHE_BYTES
+#define DL_PAGE_CACHE_BYTES (4 << 20)
+#endif
+
+enum {
+    DL_OP_FILL,
+    DL_OP_LINE,
+    DL_OP_TEXT,
+    DL_OP_BLIT,
+};
+
+struct dl_op {
+    int type;
+    int font;
+    struct UiColor color;
+    /* fill: x1,y1,x2,y2 / line: ax,ay,bx,by,width
+     * text: x,y,minx,maxx,miny,maxy / blit: sx,sy,w,h,dx,dy */
+    int arg[6];
+    gr_surface source;
+    /* blit ops, contents of an offscreen source */
+    unsigned generation;
+    /* text ops, offset and length in the frame text buffer */
+    unsigned text;
+    unsigned text_len;
+    struct gr_rect bounds;
+};
+
+struct dl_frame {
+    struct dl_op *ops;
+    unsigned count;
+    unsigned size;
+    char *text;
+    unsigned text_len;
+    unsigned text_size;
+    /* ops of the scrollable list, list_end is 0 without one */
+    unsigned list_begin;
+    unsigned list_end;
+};
+
+static struct dl_frame frames[2];
+static struct dl_frame *prev_frame = &frames[0];
+static struct dl_frame *cur_frame = &frames[1];
+
+struct dl_page {
+    gr_surface surface;     /* the screen when the page was left */
+    struct dl_frame frame;  /* and its list */
+    int valid;
+    unsigned bytes;
+    unsigned shown;         /* frame_serial when last shown */
+};
+
+static struct dl_page pages[GR_FRAME_PAGES];
+static int cur_page = -1;   /* of the frame recorded */
+static int prev_page = -1;  /* of the frame on screen */
+static unsigned frame_serial = 0;
+static unsigned page_hits = 0;
+static unsigned page_misses = 0;
+/* drawing each page when it was shown again, kept while it is dropped */
+static uint64_t page_redraw_ns[GR_FRAME_PAGES];
+/* copy of the whole screen, 0 until measured */
+static uint64_t copy_ns = 0;
+
+static int recording = 0;
+static int invalid = 1;
+static uint64_t frame_start;
+
+static struct gr_rect damage[DL_MAX_DAMAGE];
+static int damage_count = 0;
+
+/* bands replayed by the raster pool */
+static int band_top;
+static int band_rows;
+
+/* set by gr_frame_list_scroll() for the current frame */
+static int scrolling = 0;
+static struct gr_rect scroll_area;
+static int scroll_dy;
+
+static inline int rect_empty(const struct gr_rect *r) {
+    return r->left >= r->right || r->top >= r->bottom;
+}
+
+static inline int rect_touch(const struct gr_rect *a, const struct gr_rect *b) {
+    return a->left <= b->right && b->left <= a->right
+        && a->top <= b->bottom && b->top <= a->bottom;
+}
+
+static inline int rect_intersect(const struct gr_rect *a, const struct gr_rect *b) {
+    return a->left < b->right && b->left < a->right
+        && a->top < b->bottom && b->top < a->bottom;
+}
+
+static inline int rect_area(const struct gr_rect *r) {
+    return (r->right - r->left) * (r->bottom - r->top);
+}
+
+static void rect_union(struct gr_rect *a, const struct gr_rect *b) {
+    if (b->left < a->left) a->left = b->left;
+    if (b->top < a->top) a->top = b->top;
+    if (b->right > a->right) a->right = b->right;
+    if (b->bottom > a->bottom) a->bottom = b->bottom;
+}
+
+static void rect_set(struct gr_rect *r, int left, int top, int right, int bottom) {
+    // clamp to the screen
+    r->left = left < 0 ? 0 : left;
+    r->top = top < 0 ? 0 : top;
+    r->right = right > gr_fb_width() ? gr_fb_width() : right;
+    r->bottom = bottom > gr_fb_height() ? gr_fb_height() : bottom;
+    if (rect_empty(r))
+        r->left = r->top = r->right = r->bottom = 0;
+}
+
+static void damage_add(const struct gr_rect *r) {
+    struct gr_rect merged;
+    int i, best = 0, best_growth = -1;
+
+    if (rect_empty(r))
+        return;
+
+    for (i = 0; i < damage_count; i++) {
+        if (rect_touch(&damage[i], r)) {
+            rect_union(&damage[i], r);
+            return;
+        }
+    }
+
+    if (damage_count < DL_MAX_DAMAGE) {
+        damage[damage_count++] = *r;
+        return;
+    }
+
+    // no slot left, grow the rect which gets the least bigger
+    for (i = 0; i < damage_count; i++) {
+        int growth;
+        merged = damage[i];
+        rect_union(&merged, r);
+        growth = rect_area(&merged) - rect_area(&damage[i]);
+        if (best_growth < 0 || growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    rect_union(&damage[best], r);
+}
+
+// merged rects can overlap others, the same pixels must not be drawn twice
+static void damage_coalesce(void) {
+    int i, j, again;
+
+    do {
+        again = 0;
+        for (i = 0; i < damage_count; i++) {
+            for (j = i + 1; j < damage_count; j++) {
+                if (rect_touch(&damage[i], &damage[j])) {
+                    rect_union(&damage[i], &damage[j]);
+                    damage[j] = damage[--damage_count];
+                    again = 1;
+                }
+            }
+        }
+    } while (again);
+}
+
+static struct dl_op *dl_new_op(int type) {
+    struct dl_frame *f = cur_frame;
+    struct dl_op *op;
+
+    if (f->count == f->size) {
+        unsigned size = f->size ? f->size * 2 : 128;
+        struct dl_op *ops = realloc(f->ops, size * sizeof(*ops));
+        if (ops == NULL) {
+            // lost op, repaint everything on next frame
+            invalid = 1;
+            return NULL;
+        }
+        f->ops = ops;
+        f->size = size;
+    }
+
+    op = &f->ops[f->count++];
+    memset(op, 0, sizeof(*op));
+    op->type = type;
+    op->font = gr_getfont();
+    op->color = gr_get_color();
+    return op;
+}
+
+static int dl_add_text(struct dl_op *op, const char *s) {
+    struct dl_frame *f = cur_frame;
+    unsigned len = strlen(s);
+
+    if (f->text_len + len + 1 > f->text_size) {
+        unsigned size = f->text_size ? f->text_size : 4096;
+        char *text;
+        while (size < f->text_len + len + 1)
+            size *= 2;
+        text = realloc(f->text, size);
+        if (text == NULL) {
+            invalid = 1;
+            return -1;
+        }
+        f->text = text;
+        f->text_size = size;
+    }
+
+    op->text = f->text_len;
+    op->text_len = len;
+    memcpy(f->text + f->text_len, s, len + 1);
+    f->text_len += len + 1;
+    return 0;
+}
+
+int gr_dl_recording(void) {
+    return recording;
+}
+
+void gr_dl_fill(int x1, int y1, int x2, int y2) {
+    struct dl_op *op = dl_new_op(DL_OP_FILL);
+    if (op == NULL) return;
+
+    op->arg[0] = x1;
+    op->arg[1] = y1;
+    op->arg[2] = x2;
+    op->arg[3] = y2;
+    rect_set(&op->bounds, x1, y1, x2, y2);
+}
+
+void gr_dl_line(int ax, int ay, int bx, int by, int width) {
+    struct dl_op *op = dl_new_op(DL_OP_LINE);
+    int w = abs(width) + 1;
+    if (op == NULL) return;
+
+    op->arg[0] = ax;
+    op->arg[1] = ay;
+    op->arg[2] = bx;
+    op->arg[3] = by;
+    op->arg[4] = width;
+    rect_set(&op->bounds, (ax < bx ? ax : bx) - w, (ay < by ? ay : by) - w,
+             (ax > bx ? ax : bx) + w, (ay > by ? ay : by) + w);
+}
+
+void gr_dl_text(int x, int y, const char *s, int minx, int maxx, int miny, int maxy) {
+    struct dl_op *op = dl_new_op(DL_OP_TEXT);
+    int left, top, right, bottom;
+    if (op == NULL) return;
+
+    if (dl_add_text(op, s) < 0) {
+        cur_frame->count--;
+        return;
+    }
+
+    op->arg[0] = x;
+    op->arg[1] = y;
+    op->arg[2] = minx;
+    op->arg[3] = maxx;
+    op->arg[4] = miny;
+    op->arg[5] = maxy;
+
+    // same clipping rules as gr_text_cut()
+    left = x;
+    right = x + (int) op->text_len * gr_getfont_cwidth();
+    top = y - (gr_getfont_cheight() - 2);
+    bottom = top + gr_getfont_cheight();
+    if (minx >= 0 && left < minx) left = minx;
+    if (maxx >= 0 && right > maxx) right = maxx;
+    if (miny >= 0 && top < miny) top = miny;
+    if (maxy >= 0 && bottom > maxy) bottom = maxy;
+    rect_set(&op->bounds, left, top, right, bottom);
+}
+
+void gr_dl_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
+    struct dl_op *op = dl_new_op(DL_OP_BLIT);
+    if (op == NULL) return;
+
+    op->source = source;
+    op->generation = gr_surface_generation(source);
+    op->arg[0] = sx;
+    op->arg[1] = sy;
+    op->arg[2] = w;
+    op->arg[3] = h;
+    op->arg[4] = dx;
+    op->arg[5] = dy;
+    rect_set(&op->bounds, dx, dy, dx + w, dy + h);
+}
+
+static int op_equal(const struct dl_frame *fa, const struct dl_op *a,
+                    const struct dl_frame *fb, const struct dl_op *b) {
+    if (a->type != b->type || a->source != b->source)
+        return 0;
+    // only text depends on the font
+    if (a->type == DL_OP_TEXT && a->font != b->font)
+        return 0;
+    if (a->generation != b->generation)
+        return 0;
+    // layers are copied, whatever the color left by the previous draws
+    if ((a->type != DL_OP_BLIT || a->generation == 0)
+     && memcmp(&a->color, &b->color, sizeof(a->color)))
+        return 0;
+    if (memcmp(a->arg, b->arg, sizeof(a->arg)))
+        return 0;
+    if (a->type == DL_OP_TEXT) {
+        if (a->text_len != b->text_len)
+            return 0;
+        if (memcmp(fa->text + a->text, fb->text + b->text, a->text_len))
+            return 0;
+    }
+    return 1;
+}
+
+static void op_replay(const struct dl_frame *f, const struct dl_op *op) {
+    gr_set_uicolor(op->color);
+    gr_setfont(op->font);
+
+    switch (op->type) {
+    case DL_OP_FILL:
+        gr_fill(op->arg[0], op->arg[1], op->arg[2], op->arg[3]);
+        break;
+    case DL_OP_LINE:
+        gr_drawLine(op->arg[0], op->arg[1], op->arg[2], op->arg[3], op->arg[4]);
+        break;
+    case DL_OP_TEXT:
+        gr_text_cut(op->arg[0], op->arg[1], f->text + op->text,
+                    op->arg[2], op->arg[3], op->arg[4], op->arg[5]);
+        break;
+    case DL_OP_BLIT:
+        gr_blit(op->source, op->arg[0], op->arg[1], op->arg[2], op->arg[3],
+                op->arg[4], op->arg[5]);
+        break;
+    }
+}
+
+static void replay_rect(const struct gr_rect *clip) {
+    unsigned i;
+
+    gr_set_clip(clip);
+    for (i = 0; i < cur_frame->count; i++) {
+        if (rect_intersect(&cur_frame->ops[i].bounds, clip))
+            op_replay(cur_frame, &cur_frame->ops[i]);
+    }
+}
+
+// the damage in rows [top, top + band_rows) of the band, from any thread
+// of the pool: the bands do not overlap
+static void replay_band(int band, void *data) {
+    int top = band_top + band * band_rows;
+    int bottom = top + band_rows;
+    struct gr_rect r;
+    int d;
+
+    for (d = 0; d < damage_count; d++) {
+        r = damage[d];
+        if (r.top < top) r.top = top;
+        if (r.bottom > bottom) r.bottom = bottom;
+        if (!rect_empty(&r))
+            replay_rect(&r);
+    }
+    gr_set_clip(NULL);
+}
+
+static void replay_damage(void) {
+    int threads = gr_raster_threads();
+    int top = gr_fb_height(), bottom = 0, area = 0;
+    int d, bands;
+
+    for (d = 0; d < damage_count; d++) {
+        area += rect_area(&damage[d]);
+        if (damage[d].top < top) top = damage[d].top;
+        if (damage[d].bottom > bottom) bottom = damage[d].bottom;
+    }
+
+    if (threads > 1 && area >= gr_fb_width() * gr_fb_height() / DL_PARALLEL_MIN_SHARE
+     && gr_raster_ready()) {
+        bands = threads * DL_BANDS_PER_THREAD;
+        band_top = top;
+        band_rows = (bottom - top + bands - 1) / bands;
+        if (band_rows < DL_MIN_BAND_ROWS)
+            band_rows = DL_MIN_BAND_ROWS;
+        gr_raster_run((bottom - top + band_rows - 1) / band_rows, replay_band, NULL);
+        return;
+    }
+
+    for (d = 0; d < damage_count; d++)
+        replay_rect(&damage[d]);
+    gr_set_clip(NULL);
+}
+
+void gr_frame_begin(void) {
+    frame_start = gr_stats_now();
+    cur_page = -1;
+    cur_frame->count = 0;
+    cur_frame->text_len = 0;
+    cur_frame->list_begin = cur_frame->list_end = 0;
+    scrolling = 0;
+    recording = 1;
+}
+
+void gr_frame_page(int page) {
+    if (recording)
+        cur_page = page >= 0 && page < GR_FRAME_PAGES ? page : -1;
+}
+
+void gr_frame_list_begin(void) {
+    if (recording)
+        cur_frame->list_begin = cur_frame->count;
+}
+
+void gr_frame_list_end(void) {
+    if (recording)
+        cur_frame->list_end = cur_frame->count;
+}
+
+void gr_frame_list_scroll(int x1, int y1, int x2, int y2, int dy) {
+    if (!recording || dy == 0)
+        return;
+    rect_set(&scroll_area, x1, y1, x2, y2);
+    // the pixels moved must be on screen
+    if (rect_empty(&scroll_area) || scroll_area.top - dy < 0
+     || scroll_area.bottom - dy > gr_fb_height())
+        return;
+    scroll_dy = dy;
+    scrolling = 1;
+}
+
+// damage the ops which differ, compared in order
+static void damage_ops(unsigned pa, unsigned pb, unsigned ca, unsigned cb) {
+    unsigned i, n;
+
+    n = pb - pa > cb - ca ? pb - pa : cb - ca;
+    for (i = 0; i < n; i++) {
+        const struct dl_op *a = pa + i < pb ? &prev_frame->ops[pa + i] : NULL;
+        const struct dl_op *b = ca + i < cb ? &cur_frame->ops[ca + i] : NULL;
+
+        if (a && b && op_equal(prev_frame, a, cur_frame, b))
+            continue;
+        if (a) damage_add(&a->bounds);
+        if (b) damage_add(&b->bounds);
+    }
+}
+
+// the rows of r above and below area
+static void damage_outside(const struct gr_rect *r, const struct gr_rect *area) {
+    struct gr_rect band = *r;
+
+    if (band.top < area->top) {
+        struct gr_rect above = band;
+        if (above.bottom > area->top) above.bottom = area->top;
+        damage_add(&above);
+    }
+    if (band.bottom > area->bottom) {
+        if (band.top < area->bottom) band.top = area->bottom;
+        damage_add(&band);
+    }
+}
+
+// The list moved by scroll_dy, its pixels inside scroll_area are moved
+// instead of drawn again: only the list ops outside of it are damaged,
+// in either frame, and the ops drawn over the list.
+static void damage_scroll(void) {
+    struct gr_rect source = scroll_area;
+    unsigned i;
+
+    source.top -= scroll_dy;
+    source.bottom -= scroll_dy;
+
+    for (i = prev_frame->list_begin; i < prev_frame->list_end; i++)
+        damage_outside(&prev_frame->ops[i].bounds, &scroll_area);
+    for (i = cur_frame->list_begin; i < cur_frame->list_end; i++)
+        damage_outside(&cur_frame->ops[i].bounds, &scroll_area);
+
+    // moved along with the list, and to be drawn over it
+    for (i = prev_frame->list_end; i < prev_frame->count; i++) {
+        const struct gr_rect *r = &prev_frame->ops[i].bounds;
+        struct gr_rect moved;
+
+        if (rect_intersect(r, &source)) {
+            rect_set(&moved, r->left, r->top + scroll_dy, r->right, r->bottom + scroll_dy);
+            damage_add(&moved);
+        }
+    }
+    for (i = cur_frame->list_end; i < cur_frame->count; i++) {
+        if (rect_intersect(&cur_frame->ops[i].bounds, &scroll_area))
+            damage_add(&cur_frame->ops[i].bounds);
+    }
+}
+
+// The backends skip bringing the full width damaged rows of the back
+// page up to date, as they are drawn again: but the rows to be moved must
+// be, they are cut out of the damage passed to gr_prepare_damage().
+static int prepare_rects(struct gr_rect *out) {
+    int top = scroll_area.top - scroll_dy, bottom = scroll_area.bottom - scroll_dy;
+    int d, n = 0;
+
+    for (d = 0; d < damage_count; d++) {
+        const struct gr_rect *r = &damage[d];
+
+        if (!scrolling || r->bottom <= top || r->top >= bottom) {
+            out[n++] = *r;
+            continue;
+        }
+        if (r->top < top) {
+            out[n] = *r;
+            out[n++].bottom = top;
+        }
+        if (r->bottom > bottom) {
+            out[n] = *r;
+            out[n++].top = bottom;
+        }
+    }
+    return n;
+}
+
+// damage of the current frame against prev_frame
+static void frame_damage(void) {
+    damage_count = 0;
+    if (prev_frame->list_end && cur_frame->list_end) {
+        // the ops after the list are compared from its end, whatever
+        // the count of its items drawn
+        damage_ops(0, prev_frame->list_begin, 0, cur_frame->list_begin);
+        if (scrolling)
+            damage_scroll();
+        else
+            damage_ops(prev_frame->list_begin, prev_frame->list_end,
+                       cur_frame->list_begin, cur_frame->list_end);
+        damage_ops(prev_frame->list_end, prev_frame->count,
+                   cur_frame->list_end, cur_frame->count);
+        damage_coalesce();
+    } else {
+        damage_ops(0, prev_frame->count, 0, cur_frame->count);
+        damage_coalesce();
+        scrolling = 0;
+    }
+}
+
+static int damage_area(void) {
+    int d, area = 0;
+
+    for (d = 0; d < damage_count; d++)
+        area += rect_area(&damage[d]);
+    return area;
+}
+
+static int frame_copy(struct dl_frame *dst, const struct dl_frame *src) {
+    if (dst->size < src->count) {
+        struct dl_op *ops = realloc(dst->ops, src->count * sizeof(*ops));
+        if (ops == NULL)
+            return -1;
+        dst->ops = ops;
+        dst->size = src->count;
+    }
+    if (dst->text_size < src->text_len) {
+        char *text = realloc(dst->text, src->text_len);
+        if (text == NULL)
+            return -1;
+        dst->text = text;
+        dst->text_size = src->text_len;
+    }
+    memcpy(dst->ops, src->ops, src->count * sizeof(*dst->ops));
+    memcpy(dst->text, src->text, src->text_len);
+    dst->count = src->count;
+    dst->text_len = src->text_len;
+    dst->list_begin = src->list_begin;
+    dst->list_end = src->list_end;
+    return 0;
+}
+
+static void page_drop(struct dl_page *p) {
+    gr_free_surface(p->surface);
+    free(p->frame.ops);
+    free(p->frame.text);
+    memset(p, 0, sizeof(*p));
+}
+
+static void copy_measured(uint64_t ns) {
+    copy_ns = copy_ns ? (copy_ns * 3 + ns) / 4 : ns;
+}
+
+// Keeping the page left costs a copy of the screen now and one when it
+// is shown again, only worth it if drawing it again costs more. The first
+// page is kept to measure the copy.
+static int page_worth_keeping(int page) {
+    if (copy_ns == 0)
+        return 1;
+    return page_redraw_ns[page] > 2 * copy_ns;
+}
+
+// Keep the screen, showing prev_frame, for the page it belongs to. The
+// least recently shown pages are dropped to stay in DL_PAGE_CACHE_BYTES,
+// never the one about to be shown.
+static void page_keep(int page) {
+    struct dl_page *p = &pages[page];
+    unsigned total;
+    uint64_t start;
+    int i, lru;
+    int bytes;
+
+    if (p->surface == NULL)
+        p->surface = gr_create_surface(gr_fb_width(), gr_fb_height());
+    p->valid = 0;
+    start = gr_stats_now();
+    bytes = p->surface ? gr_save_screen(p->surface) : -1;
+    if (bytes < 0 || frame_copy(&p->frame, prev_frame) < 0) {
+        page_drop(p);
+        return;
+    }
+    copy_measured(gr_stats_now() - start);
+    p->bytes = bytes;
+    p->valid = 1;
+
+    for (;;) {
+        total = 0;
+        lru = -1;
+        for (i = 0; i < GR_FRAME_PAGES; i++) {
+            if (!pages[i].surface)
+                continue;
+            total += pages[i].bytes;
+            if (i != page && i != cur_page && (lru < 0 || pages[i].shown < pages[lru].shown))
+                lru = i;
+        }
+        if (total <= DL_PAGE_CACHE_BYTES)
+            break;
+        page_drop(lru >= 0 ? &pages[lru] : p);
+        if (lru < 0)
+            break;
+    }
+}
+
+// When the page shown changes and the new one was kept, the damage
+// against its frame replaces the one against the previous frame if the
+// copy of the kept screen and that damage cost less than drawing the
+// page again, as measured the last time. Returns 1 if so.
+static int page_damage(void) {
+    struct gr_rect saved[DL_MAX_DAMAGE];
+    struct dl_frame *prev = prev_frame;
+    int saved_count = damage_count, saved_scrolling = scrolling;
+    int area = damage_area();
+    uint64_t redraw;
+
+    if (cur_page < 0 || cur_page == prev_page)
+        return 0;
+    redraw = page_redraw_ns[cur_page];
+    if (!pages[cur_page].valid || redraw == 0 || area == 0) {
+        page_misses++;
+        return 0;
+    }
+
+    memcpy(saved, damage, sizeof(saved));
+    prev_frame = &pages[cur_page].frame;
+    scrolling = 0;
+    frame_damage();
+    prev_frame = prev;
+
+    if (copy_ns + redraw * damage_area() / area < redraw) {
+        page_hits++;
+        return 1;
+    }
+
+    memcpy(damage, saved, sizeof(saved));
+    damage_count = saved_count;
+    scrolling = saved_scrolling;
+    page_misses++;
+    return 0;
+}
+
+void gr_frame_page_stats(struct gr_page_stats *st) {
+    int i;
+
+    memset(st, 0, sizeof(*st));
+    for (i = 0; i < GR_FRAME_PAGES; i++) {
+        if (pages[i].valid) {
+            st->pages++;
+            st->bytes += pages[i].bytes;
+        }
+    }
+    st->hits = page_hits;
+    st->misses = page_misses;
+}
+
+int gr_frame_end(void) {
+    struct dl_frame *tmp;
+    struct gr_rect full;
+    struct gr_rect rects[DL_MAX_DAMAGE * 2];
+    uint64_t drawn, flipped, start;
+    int flip_count, restore, switched;
+
+    recording = 0;
+
+    // nothing drawn, keep the previous picture on screen
+    if (cur_frame->count == 0)
+        return 0;
+
+    rect_set(&full, 0, 0, gr_fb_width(), gr_fb_height());
+    if (invalid) {
+        damage_count = 0;
+        damage_add(&full);
+        scrolling = 0;
+    } else {
+        frame_damage();
+    }
+    restore = page_damage();
+
+    // the page to draw into is still on screen, the next attempt will
+    // compare with the same previous frame
+    if ((damage_count > 0 || scrolling || restore) && gr_flip_delay() > 0) {
+        gr_stats_skipped(1);
+        return -1;
+    }
+
+    // the screen shows the page left, unless it was lost
+    switched = cur_page >= 0 && cur_page != prev_page && !invalid;
+    if (prev_page >= 0 && prev_page != cur_page && !invalid && page_worth_keeping(prev_page))
+        page_keep(prev_page);
+    invalid = 0;
+
+    if (restore) {
+        gr_prepare_damage(&full, 1);
+        gr_color(255, 255, 255, 255);
+        start = gr_stats_now();
+        gr_blit(pages[cur_page].surface, 0, 0, full.right, full.bottom, 0, 0);
+        copy_measured(gr_stats_now() - start);
+        replay_damage();
+        rects[0] = full;
+        flip_count = 1;
+    } else if (damage_count > 0 || scrolling) {
+        start = gr_stats_now();
+        gr_prepare_damage(rects, prepare_rects(rects));
+        if (scrolling)
+            gr_scroll_rect(&scroll_area, scroll_dy);
+        replay_damage();
+        if (switched)
+            page_redraw_ns[cur_page] = gr_stats_now() - start;
+
+        // the moved rows changed too
+        memcpy(rects, damage, damage_count * sizeof(damage[0]));
+        flip_count = damage_count;
+        if (scrolling)
+            rects[flip_count++] = scroll_area;
+    }
+
+    if (restore || damage_count > 0 || scrolling) {
+        drawn = gr_stats_now();
+        gr_flip_damage(rects, flip_count);
+        flipped = gr_stats_now();
+
+        gr_stats_add(GR_STAT_DRAW, drawn - frame_start);
+        gr_stats_add(GR_STAT_FLIP, flipped - drawn);
+        gr_stats_add(GR_STAT_FRAME, flipped - frame_start);
+        gr_stats_flipped(flipped);
+    } else {
+        gr_stats_add(GR_STAT_DRAW, gr_stats_now() - frame_start);
+    }
+
+    tmp = prev_frame;
+    prev_frame = cur_frame;
+    cur_frame = tmp;
+    prev_page = cur_page;
+    if (cur_page >= 0)
+        pages[cur_page].shown = ++frame_serial;
+
+    return damage_count + scrolling + restore;
+}
+
+void gr_frame_invalidate(void) {
+    invalid = 1;
+}
+
+void gr_frame_free(void) {
+    int i;
+    for (i = 0; i < 2; i++) {
+        free(frames[i].ops);
+        free(frames[i].text);
+        memset(&frames[i], 0, sizeof(frames[i]));
+    }
+    for (i = 0; i < GR_FRAME_PAGES; i++)
+        page_drop(&pages[i]);
+    prev_page = -1;
+    invalid = 1;
+}
@@ -14,12 +14,19 @@
  * limitations under the License.
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include <fcntl.h>
 #include <dirent.h>
+#include <sys/epoll.h>
+#include <sys/inotify.h>
+#include <sys/ioctl.h>
 #include <sys/poll.h>
 #include <limits.h>
+#include <time.h>
 
 #include <linux/input.h>
 
@@ -28,9 +35,15 @@
 #include "minui.h"
 
 #define MAX_DEVICES 16
+#define MAX_MISC_FDS 8
+/* events read per syscall, a few touch samples */
+#define EV_READ_BATCH 64
 
 #define VIBRATOR_TIMEOUT_FILE	"/sys/class/timed_output/vibrator/enable"
 
+#define INPUT_DIR "/dev/input"
+#define INPUT_SYSFS "/sys/class/input"
+
 #define ABS_MT_POSITION		0x2a	/* Group a set of X and Y */
 #define ABS_MT_AMPLITUDE	0x2b	/* Group a set of Z and W */
 #define ABS_MT_POSITION_X 0x35
@@ -39,6 +52,22 @@
 #define ABS_MT_WIDTH_MAJOR 0x32
 #define SYN_MT_REPORT 2
 
+/* what an input device is used for, the others are not opened */
+#define EV_DEV_KEYS      0x01
+#define EV_DEV_TOUCH     0x02
+#define EV_DEV_TRACKBALL 0x04
+
+#define LONG_BITS (sizeof(long) * 8)
+#define NLONGS(x) ((x) / LONG_BITS + 1)
+#define TEST_BIT(bits, bit) (((bits)[(bit) / LONG_BITS] >> ((bit) % LONG_BITS)) & 1)
+
+struct ev_caps {
+    unsigned long ev[NLONGS(EV_MAX)];
+    unsigned long key[NLONGS(KEY_MAX)];
+    unsigned long abs[NLONGS(ABS_MAX)];
+    unsigned long rel[NLONGS(REL_MAX)];
+};
+
 enum {
     DOWN_NOT,
     DOWN_SENT,
@@ -59,6 +88,8 @@ struct position {
 
 struct ev {
     struct pollfd *fd;
+    char node[16];      /* in INPUT_DIR, empty for a free slot */
+    unsigned type;      /* EV_DEV_* */
 
     struct virtualkey *vks;
     int vk_count;
@@ -69,11 +100,45 @@ struct ev {
 
     struct position p, mt_p;
     int down;
+
+    /* read but not returned yet by ev_get_input() */
+    struct input_event queued[EV_READ_BATCH];
+    int queued_len, queued_pos;
 };
 
+struct fd_info {
+    int fd;
+    ev_callback cb;
+    void *data;
+};
+
+/*
+ * The input devices are found once, by the first ev_init(), and stay open
+ * for the next ones (the boot key check, then the ui). A device is
+ * classified from its capabilities and only opened if it has keys, a
+ * touchscreen or a trackball. The devices plugged later are picked up
+ * through inotify on INPUT_DIR, and tried again when ueventd changes the
+ * owner or the mode of a node that could not be opened yet.
+ */
 static struct pollfd ev_fds[MAX_DEVICES];
 static struct ev evs[MAX_DEVICES];
-static unsigned ev_count = 0;
+static int ev_scanned = 0;
+/* the slots freed by the batch ev_dispatch() is running, not reused
+   before its last events, still pointing to them, are done */
+static unsigned ev_released = 0;
+static ev_callback ev_input_cb;
+static void *ev_input_data;
+
+static int epollfd = -1;
+static struct epoll_event polledevents[MAX_DEVICES + MAX_MISC_FDS + 1];
+static int npolledevents = 0;
+
+/* input devices first, then the other fds added with ev_add_fd() */
+static struct fd_info ev_fdinfo[MAX_DEVICES + MAX_MISC_FDS];
+static unsigned ev_misc_count = 0;
+
+/* inotify, devices added and removed */
+static struct fd_info ev_notify = { -1, NULL, NULL };
 
 static inline int ABS(int x) {
     return x<0?-x:x;
@@ -220,53 +285,299 @@ static int vk_init(struct ev *e)
     return 0;
 }
 
-int ev_init(void)
+static int ev_epoll_add(struct fd_info *fdi)
 {
-    DIR *dir;
-    struct dirent *de;
-    int fd;
+    struct epoll_event ev;
 
-    dir = opendir("/dev/input");
-    if (dir != 0) {
-        while ((de = readdir(dir))) {
+    ev.events = EPOLLIN;
+    ev.data.ptr = fdi;
+    return epoll_ctl(epollfd, EPOLL_CTL_ADD, fdi->fd, &ev);
+}
 
-            if (strncmp(de->d_name,"event",5)) continue;
-            fd = openat(dirfd(dir), de->d_name, O_RDONLY);
-            if (fd < 0) continue;
+/* A capability bitmap of sysfs: words in hex, the last one first */
+static int ev_sysfs_bits(const char *node, const char *type, unsigned long *bits, unsigned longs)
+{
+    char path[PATH_MAX];
+    char buf[1024];
+    unsigned long words[NLONGS(KEY_MAX)];
+    char *word, *save;
+    unsigned n = 0, i;
+    int fd, len;
+
+    memset(bits, 0, longs * sizeof(*bits));
+    snprintf(path, sizeof(path), INPUT_SYSFS "/%s/device/capabilities/%s", node, type);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    len = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    if (len <= 0)
+        return -1;
+    buf[len] = '\0';
+    buf[strcspn(buf, "\n")] = '\0';
 
-            ev_fds[ev_count].fd = fd;
-            ev_fds[ev_count].events = POLLIN;
-            evs[ev_count].fd = &ev_fds[ev_count];
+    for (word = vk_strtok_r(buf, " ", &save); word && n < NLONGS(KEY_MAX);
+         word = vk_strtok_r(NULL, " ", &save)) {
+        if (*word)
+            words[n++] = strtoul(word, NULL, 16);
+    }
+
+    for (i = 0; i < n && i < longs; i++)
+        bits[i] = words[n - 1 - i];
+    return 0;
+}
 
-            /* Load virtualkeys if there are any */
-            vk_init(&evs[ev_count]);
+/* The capabilities without opening the device, a sensor could power up */
+static int ev_sysfs_caps(const char *node, struct ev_caps *caps)
+{
+    if (ev_sysfs_bits(node, "ev", caps->ev, NLONGS(EV_MAX)) < 0)
+        return -1;
+    ev_sysfs_bits(node, "key", caps->key, NLONGS(KEY_MAX));
+    ev_sysfs_bits(node, "abs", caps->abs, NLONGS(ABS_MAX));
+    ev_sysfs_bits(node, "rel", caps->rel, NLONGS(REL_MAX));
+    return 0;
+}
 
-            ev_count++;
-            if (ev_count == MAX_DEVICES) break;
-        }
+static void ev_ioctl_caps(int fd, struct ev_caps *caps)
+{
+    memset(caps, 0, sizeof(*caps));
+    ioctl(fd, EVIOCGBIT(0, sizeof(caps->ev)), caps->ev);
+    ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(caps->key)), caps->key);
+    ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(caps->abs)), caps->abs);
+    ioctl(fd, EVIOCGBIT(EV_REL, sizeof(caps->rel)), caps->rel);
+}
 
-        if (ev_count >= MAX_DEVICES) {
-            ev_count = MAX_DEVICES-1;
+static unsigned ev_classify(const struct ev_caps *caps)
+{
+    unsigned type = 0;
+    int code;
+
+    if (TEST_BIT(caps->ev, EV_KEY)) {
+        // buttons of the touchscreen or of a mouse are not keys
+        for (code = KEY_ESC; code <= KEY_MAX; code++) {
+            if (code == BTN_MISC)
+                code = KEY_OK;
+            if (TEST_BIT(caps->key, code)) {
+                type |= EV_DEV_KEYS;
+                break;
+            }
         }
     }
 
+    if (TEST_BIT(caps->ev, EV_ABS) &&
+        (TEST_BIT(caps->abs, ABS_MT_POSITION_X) || TEST_BIT(caps->abs, ABS_MT_POSITION) ||
+         (TEST_BIT(caps->abs, ABS_X) && TEST_BIT(caps->key, BTN_TOUCH))))
+        type |= EV_DEV_TOUCH;
+
+    // accelerometers report REL_Z too
+    if (TEST_BIT(caps->ev, EV_REL) && TEST_BIT(caps->rel, REL_Y) && !TEST_BIT(caps->rel, REL_Z))
+        type |= EV_DEV_TRACKBALL;
+
+    return type;
+}
+
+static void ev_close(int slot)
+{
+    struct ev *e = &evs[slot];
+
+    free(e->vks);
+    close(ev_fds[slot].fd);
+    ev_fds[slot].fd = -1;
+    ev_fdinfo[slot].fd = -1;
+    memset(e, 0, sizeof(*e));
+    if (npolledevents > 0)
+        ev_released |= 1u << slot;
+}
+
+/* Open a device of INPUT_DIR if the ui has a use for it */
+static int ev_open(const char *node)
+{
+    struct ev_caps caps;
+    struct ev *e;
+    char path[PATH_MAX];
+    unsigned type;
+    int fd = -1, slot = -1, n;
+
+    for (n = 0; n < MAX_DEVICES; n++) {
+        if (!strcmp(evs[n].node, node))
+            return 0;
+        if (slot < 0 && !evs[n].node[0] && !(ev_released & (1u << n)))
+            slot = n;
+    }
+    if (slot < 0) {
+        LOGW("minui: too many input devices, %s not used\n", node);
+        return -1;
+    }
+
+    snprintf(path, sizeof(path), INPUT_DIR "/%s", node);
+    if (ev_sysfs_caps(node, &caps) < 0) {
+        fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0)
+            return -1;
+        ev_ioctl_caps(fd, &caps);
+    }
+
+    type = ev_classify(&caps);
+#ifdef _EVENT_LOGGING
+    LOGI("EV: %s type %x\n", node, type);
+#endif
+    if (type == 0) {
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    if (fd < 0)
+        fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+        return -1;
+
+    e = &evs[slot];
+    snprintf(e->node, sizeof(e->node), "%s", node);
+    e->type = type;
+    ev_fds[slot].fd = fd;
+    ev_fds[slot].events = POLLIN;
+    e->fd = &ev_fds[slot];
+
+    /* Load virtualkeys if there are any */
+    vk_init(e);
+    if (e->ignored) {
+        ev_close(slot);
+        return -1;
+    }
+
+    ev_fdinfo[slot].fd = fd;
+    ev_fdinfo[slot].cb = ev_input_cb;
+    ev_fdinfo[slot].data = ev_input_data;
+    if (epollfd >= 0)
+        ev_epoll_add(&ev_fdinfo[slot]);
     return 0;
 }
 
-void ev_exit(void)
+/* Devices added to or removed from INPUT_DIR */
+static int ev_notify_callback(int fd, uint32_t epevents, void *data)
+{
+    char buf[1024] __attribute__((aligned(__alignof__(struct inotify_event))));
+    struct inotify_event *ie;
+    int len, pos, n;
+
+    len = read(fd, buf, sizeof(buf));
+    for (pos = 0; pos + (int) sizeof(*ie) <= len; pos += sizeof(*ie) + ie->len) {
+        ie = (struct inotify_event *) (buf + pos);
+        if (ie->len == 0 || strncmp(ie->name, "event", 5))
+            continue;
+        if (ie->mask & (IN_CREATE | IN_ATTRIB)) {
+            /* nothing done for a device already open */
+            ev_open(ie->name);
+        } else if (ie->mask & IN_DELETE) {
+            for (n = 0; n < MAX_DEVICES; n++) {
+                if (!strcmp(evs[n].node, ie->name))
+                    ev_close(n);
+            }
+        }
+    }
+    return 0;
+}
+
+/* Find the input devices, once */
+static void ev_scan(void)
 {
-    if (ev_count >= MAX_DEVICES) {
-        ev_count = MAX_DEVICES-1;
+    DIR *dir;
+    struct dirent *de;
+
+    // watched first, not to miss a device
+    ev_notify.fd = inotify_init();
+    if (ev_notify.fd >= 0) {
+        fcntl(ev_notify.fd, F_SETFL, O_NONBLOCK);
+        fcntl(ev_notify.fd, F_SETFD, FD_CLOEXEC);
+        if (inotify_add_watch(ev_notify.fd, INPUT_DIR,
+                              IN_CREATE | IN_DELETE | IN_ATTRIB) < 0) {
+            close(ev_notify.fd);
+            ev_notify.fd = -1;
+        }
+    }
+    ev_notify.cb = ev_notify_callback;
+
+    dir = opendir(INPUT_DIR);
+    if (dir != 0) {
+        while ((de = readdir(dir))) {
+            if (strncmp(de->d_name,"event",5)) continue;
+            ev_open(de->d_name);
+        }
+        closedir(dir);
     }
+    ev_scanned = 1;
+}
 
-    while (ev_count > 0) {
-        ev_count--;
-        if (evs[ev_count].vk_count) {
-            free(evs[ev_count].vks);
-            evs[ev_count].vks = NULL;
-            evs[ev_count].vk_count = 0;
+int ev_init(ev_callback input_cb, void *data)
+{
+    struct input_event stale[EV_READ_BATCH];
+    int n;
+
+    ev_input_cb = input_cb;
+    ev_input_data = data;
+
+    if (!ev_scanned) {
+        ev_scan();
+    } else {
+        // what happened while nobody listened is not for this loop
+        for (n = 0; n < MAX_DEVICES; n++) {
+            if (!evs[n].node[0])
+                continue;
+            while (read(ev_fds[n].fd, stale, sizeof(stale)) > 0)
+                ;
+            evs[n].queued_len = evs[n].queued_pos = 0;
         }
-        close(ev_fds[ev_count].fd);
+    }
+
+    epollfd = epoll_create(MAX_DEVICES + MAX_MISC_FDS + 1);
+    if (epollfd < 0) {
+        LOGE("epoll_create failed\n");
+        return -1;
+    }
+
+    for (n = 0; n < MAX_DEVICES; n++) {
+        if (!evs[n].node[0])
+            continue;
+        ev_fdinfo[n].cb = input_cb;
+        ev_fdinfo[n].data = data;
+        ev_epoll_add(&ev_fdinfo[n]);
+    }
+    if (ev_notify.fd >= 0)
+        ev_epoll_add(&ev_notify);
+
+    return 0;
+}
+
+/* Watch another fd (timers, eventfd...) in the same loop */
+int ev_add_fd(int fd, ev_callback cb, void *data)
+{
+    struct fd_info *fdi;
+
+    if (epollfd < 0 || ev_misc_count >= MAX_MISC_FDS)
+        return -1;
+
+    fdi = &ev_fdinfo[MAX_DEVICES + ev_misc_count];
+    fdi->fd = fd;
+    fdi->cb = cb;
+    fdi->data = data;
+    if (ev_epoll_add(fdi) < 0)
+        return -1;
+
+    ev_misc_count++;
+    return 0;
+}
+
+void ev_exit(void)
+{
+    /* the devices stay open for the next ev_init(), the other fds
+     * belong to the caller */
+    ev_misc_count = 0;
+    npolledevents = 0;
+    ev_released = 0;
+
+    if (epollfd >= 0) {
+        close(epollfd);
+        epollfd = -1;
     }
 }
 
@@ -530,26 +841,161 @@ static int vk_modify(struct ev *e, struct input_event *ev)
     return 0;
 }
 
-int ev_get(struct input_event *ev, unsigned dont_wait)
+/* Wait for any of the watched fds, timeout in ms (-1 for none) */
+int ev_wait(int timeout)
+{
+    npolledevents = epoll_wait(epollfd, polledevents,
+                               MAX_DEVICES + MAX_MISC_FDS + 1, timeout);
+    if (npolledevents <= 0) {
+        npolledevents = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/* Call the callbacks of the fds ready after ev_wait() */
+void ev_dispatch(void)
+{
+    int n;
+
+    for (n = 0; n < npolledevents; n++) {
+        struct fd_info *fdi = polledevents[n].data.ptr;
+        /* a device may have been removed meanwhile */
+        if (fdi->cb && fdi->fd >= 0)
+            fdi->cb(fdi->fd, polledevents[n].events, fdi->data);
+    }
+    npolledevents = 0;
+    ev_released = 0;
+}
+
+/*
+ * Next event of a ready input device. The events are read in batches: the
+ * call with EPOLLIN in epevents reads all those waiting (up to
+ * EV_READ_BATCH), the next ones with epevents 0 return them in turn.
+ * Returns 0 if ev is valid, 1 if the event was used by the virtual keys,
+ * -1 once the batch is over.
+ */
+int ev_get_input(int fd, uint32_t epevents, struct input_event *ev)
+{
+    struct ev *e = NULL;
+    int n, r;
+
+    for (n = 0; n < MAX_DEVICES; n++) {
+        if (evs[n].node[0] && ev_fds[n].fd == fd) {
+            e = &evs[n];
+            break;
+        }
+    }
+    if (e == NULL)
+        return -1;
+
+    if (e->queued_pos >= e->queued_len) {
+        if (!(epevents & EPOLLIN))
+            return -1;
+        r = read(fd, e->queued, sizeof(e->queued));
+        if (r < 0 && errno == ENODEV) {
+            /* unplugged, before inotify tells */
+            ev_close(n);
+            return -1;
+        }
+        if (r < (int) sizeof(*ev))
+            return -1;
+        e->queued_len = r / sizeof(*ev);
+        e->queued_pos = 0;
+    }
+
+    *ev = e->queued[e->queued_pos++];
+    return vk_modify(e, ev) ? 1 : 0;
+}
+
+/* 1 if code is held on one of the keyboards, without the loop */
+int ev_key_held(int code)
+{
+    unsigned long keys[NLONGS(KEY_MAX)];
+    int n;
+
+    for (n = 0; n < MAX_DEVICES; n++) {
+        if (!(evs[n].type & EV_DEV_KEYS))
+            continue;
+        memset(keys, 0, sizeof(keys));
+        if (ioctl(ev_fds[n].fd, EVIOCGKEY(sizeof(keys)), keys) >= 0 && TEST_BIT(keys, code))
+            return 1;
+    }
+    return 0;
+}
+
+static long long ev_now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000;
+}
+
+/*
+ * Wait for one of the keys of codes without the event loop (before
+ * ev_init()): a key held already is seen at once, otherwise the keyboards
+ * and the touchscreens with virtual keys are polled until the first press
+ * of one of them or for timeout ms. A virtual key only counts when touched
+ * during the wait, the touchscreens cannot tell what is held already.
+ * With count 0, returns the first key pressed during the wait, whatever it
+ * is (not the repeats of a key held).
+ * Returns the code of the key, 0 if none, -1 on error.
+ */
+int ev_wait_key(const int *codes, int count, int timeout)
 {
-    int r;
-    unsigned n;
-
-    do {
-        r = poll(ev_fds, ev_count, dont_wait ? 0 : -1);
-
-        if(r > 0) {
-            for(n = 0; n < ev_count; n++) {
-                if(ev_fds[n].revents & POLLIN) {
-                    r = read(ev_fds[n].fd, ev, sizeof(*ev));
-                    if(r == sizeof(*ev)) {
-                        if (!vk_modify(&evs[n], ev))
-                            return 0;
+    struct pollfd fds[MAX_DEVICES];
+    struct ev *devs[MAX_DEVICES];
+    struct input_event buf[EV_READ_BATCH];
+    long long deadline;
+    int nfds = 0, n, i, k, r, len;
+
+    if (!ev_scanned)
+        ev_scan();
+
+    for (k = 0; k < count; k++) {
+        if (ev_key_held(codes[k]))
+            return codes[k];
+    }
+
+    for (n = 0; n < MAX_DEVICES; n++) {
+        if ((evs[n].type & EV_DEV_KEYS) ||
+            ((evs[n].type & EV_DEV_TOUCH) && evs[n].vk_count > 0)) {
+            fds[nfds].fd = ev_fds[n].fd;
+            fds[nfds].events = POLLIN;
+            devs[nfds] = &evs[n];
+            nfds++;
+        }
+    }
+
+    deadline = ev_now_ms() + timeout;
+    /* without any device, a wait for any key still lasts timeout */
+    while ((nfds > 0 || count == 0) && timeout > 0) {
+        r = poll(fds, nfds, timeout);
+        if (r < 0 && errno != EINTR)
+            return -1;
+
+        for (i = 0; r > 0 && i < nfds; i++) {
+            if (!(fds[i].revents & POLLIN))
+                continue;
+            while ((len = read(fds[i].fd, buf, sizeof(buf))) > 0) {
+                for (n = 0; n < len / (int) sizeof(buf[0]); n++) {
+                    /* a touch on a virtual key comes out as its key */
+                    if (devs[i]->vk_count > 0 && vk_modify(devs[i], &buf[n]))
+                        continue;
+                    if (buf[n].type != EV_KEY || buf[n].value == 0)
+                        continue;
+                    if (count == 0 && buf[n].value == 1)
+                        return buf[n].code;
+                    for (k = 0; k < count; k++) {
+                        if (buf[n].code == codes[k])
+                            return codes[k];
                     }
                 }
             }
         }
-    } while(dont_wait == 0);
 
-    return -1;
+        timeout = deadline - ev_now_ms();
+    }
+    return 0;
 }
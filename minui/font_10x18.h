@@ -1,209 +1,177 @@
-struct CFont font = {
-  .width = 960,
-  .height = 18,
+static const struct CFont font = {
   .cwidth = 10,
   .cheight = 18,
   .cheightfix = 3,
-  .rundata = {
-0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x55,0x82,0x06,0x82,0x02,0x82,0x10,0x82,
-0x11,0x83,0x08,0x82,0x0a,0x82,0x04,0x82,0x46,0x82,0x08,0x82,0x07,0x84,0x06,
-0x84,0x0a,0x81,0x03,0x88,0x04,0x84,0x04,0x88,0x04,0x84,0x06,0x84,0x1e,0x81,
-0x0e,0x81,0x0a,0x84,0x06,0x84,0x07,0x82,0x05,0x85,0x07,0x84,0x04,0x86,0x04,
-0x88,0x02,0x88,0x04,0x84,0x04,0x82,0x04,0x82,0x02,0x88,0x05,0x86,0x01,0x82,
-0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x04,0x84,0x04,
-0x86,0x06,0x84,0x04,0x86,0x06,0x84,0x04,0x88,0x02,0x82,0x04,0x82,0x02,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,
-0x88,0x03,0x86,0x0e,0x86,0x06,0x82,0x11,0x82,0x10,0x82,0x18,0x82,0x0f,0x84,
-0x0d,0x82,0x1c,0x82,0x09,0x84,0x7f,0x16,0x84,0x05,0x82,0x05,0x84,0x07,0x83,
-0x02,0x82,0x19,0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x01,0x82,0x03,0x86,0x04,
-0x83,0x02,0x82,0x03,0x82,0x01,0x82,0x07,0x82,0x09,0x82,0x06,0x82,0x3e,0x82,
-0x04,0x84,0x06,0x83,0x06,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x03,
-0x82,0x09,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,
-0x1c,0x82,0x0e,0x82,0x08,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x05,0x84,0x04,
-0x82,0x02,0x82,0x05,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x08,0x82,
-0x09,0x82,0x02,0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x04,
-0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x83,0x03,0x82,0x03,0x82,0x02,0x82,
-0x03,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x02,
-0x82,0x06,0x82,0x05,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x08,0x82,0x03,0x82,0x08,0x82,0x0c,
-0x82,0x05,0x84,0x11,0x82,0x0f,0x82,0x18,0x82,0x0e,0x82,0x02,0x82,0x0c,0x82,
-0x1c,0x82,0x0b,0x82,0x7f,0x15,0x82,0x08,0x82,0x08,0x82,0x05,0x82,0x01,0x82,
-0x01,0x82,0x19,0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x01,0x82,0x02,0x82,0x01,
-0x82,0x01,0x82,0x02,0x82,0x01,0x82,0x01,0x82,0x03,0x82,0x01,0x82,0x07,0x82,
-0x08,0x82,0x08,0x82,0x3d,0x82,0x03,0x82,0x02,0x82,0x04,0x84,0x05,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x06,0x83,0x03,0x82,0x08,0x82,0x04,0x81,0x09,0x82,
-0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x1a,0x82,0x10,0x82,0x06,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x03,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x08,0x82,0x04,0x82,0x02,
-0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x08,0x83,
-0x02,0x83,0x02,0x83,0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x05,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x04,
-0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x08,0x82,0x0c,0x82,0x04,0x82,0x02,0x82,
-0x11,0x82,0x0e,0x82,0x18,0x82,0x0e,0x82,0x02,0x82,0x0c,0x82,0x0b,0x82,0x0b,
-0x82,0x02,0x82,0x0b,0x82,0x4d,0x82,0x45,0x82,0x08,0x82,0x08,0x82,0x05,0x82,
-0x02,0x83,0x1a,0x82,0x07,0x81,0x02,0x81,0x07,0x82,0x01,0x82,0x02,0x82,0x01,
-0x82,0x05,0x82,0x01,0x84,0x04,0x82,0x01,0x82,0x07,0x82,0x08,0x82,0x08,0x82,
-0x06,0x82,0x02,0x82,0x06,0x82,0x28,0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x01,
-0x82,0x05,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x84,0x03,0x82,0x08,0x82,
-0x0d,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x19,0x82,0x12,0x82,0x05,
-0x82,0x04,0x82,0x02,0x82,0x02,0x84,0x03,0x82,0x02,0x82,0x03,0x82,0x03,0x82,
-0x03,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x08,0x82,0x08,0x82,0x04,
-0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x08,0x83,0x02,0x83,
-0x02,0x84,0x02,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x0b,0x82,0x05,0x82,0x04,0x82,0x02,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,
-0x82,0x04,0x82,0x09,0x82,0x0b,0x82,0x03,0x82,0x04,0x82,0x20,0x82,0x18,0x82,
-0x0e,0x82,0x10,0x82,0x0b,0x82,0x0b,0x82,0x02,0x82,0x0b,0x82,0x4d,0x82,0x45,
-0x82,0x08,0x82,0x08,0x82,0x26,0x82,0x10,0x88,0x01,0x82,0x01,0x82,0x06,0x83,
-0x01,0x82,0x04,0x84,0x08,0x81,0x08,0x82,0x0a,0x82,0x05,0x82,0x02,0x82,0x06,
-0x82,0x28,0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x0b,0x82,0x08,0x82,0x04,0x82,
-0x01,0x82,0x03,0x82,0x08,0x82,0x0d,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x04,
-0x82,0x18,0x82,0x06,0x88,0x06,0x82,0x04,0x82,0x04,0x82,0x02,0x82,0x01,0x85,
-0x02,0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x08,0x82,0x04,0x82,0x02,
-0x82,0x08,0x82,0x08,0x82,0x08,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,
-0x02,0x82,0x04,0x82,0x08,0x88,0x02,0x84,0x02,0x82,0x02,0x82,0x04,0x82,0x02,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x0b,0x82,
-0x05,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,0x82,0x04,0x82,0x04,0x84,0x06,
-0x84,0x08,0x82,0x05,0x82,0x09,0x82,0x0b,0x82,0x2b,0x82,0x18,0x82,0x0e,0x82,
-0x10,0x82,0x1c,0x82,0x0b,0x82,0x4d,0x82,0x45,0x82,0x08,0x82,0x08,0x82,0x26,
-0x82,0x11,0x82,0x01,0x82,0x03,0x82,0x01,0x82,0x09,0x82,0x06,0x82,0x12,0x82,
-0x0a,0x82,0x06,0x84,0x07,0x82,0x27,0x82,0x04,0x82,0x04,0x82,0x05,0x82,0x0b,
-0x82,0x07,0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x01,0x83,0x04,0x82,0x01,0x83,
-0x08,0x82,0x05,0x82,0x02,0x82,0x03,0x82,0x04,0x82,0x05,0x83,0x07,0x83,0x05,
-0x82,0x16,0x82,0x08,0x82,0x03,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,
-0x02,0x82,0x02,0x82,0x04,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x08,
-0x82,0x08,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x02,0x82,0x04,0x82,
-0x08,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,
-0x0a,0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,0x82,0x01,0x82,0x01,
-0x82,0x04,0x84,0x06,0x84,0x08,0x82,0x05,0x82,0x0a,0x82,0x0a,0x82,0x23,0x85,
-0x03,0x82,0x01,0x83,0x06,0x85,0x05,0x83,0x01,0x82,0x04,0x84,0x04,0x86,0x05,
-0x85,0x01,0x81,0x02,0x82,0x01,0x83,0x05,0x84,0x09,0x84,0x02,0x82,0x03,0x82,
-0x06,0x82,0x05,0x81,0x01,0x82,0x01,0x82,0x03,0x82,0x01,0x83,0x06,0x84,0x04,
-0x82,0x01,0x83,0x06,0x83,0x01,0x82,0x02,0x82,0x01,0x84,0x04,0x86,0x03,0x86,
-0x04,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x03,0x87,0x05,0x82,0x08,0x82,0x08,0x82,0x26,0x82,
-0x11,0x82,0x01,0x82,0x04,0x86,0x07,0x82,0x05,0x83,0x12,0x82,0x0a,0x82,0x04,
-0x88,0x02,0x88,0x0c,0x88,0x10,0x82,0x04,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,
-0x06,0x83,0x04,0x82,0x03,0x82,0x03,0x83,0x02,0x82,0x03,0x83,0x02,0x82,0x07,
-0x82,0x06,0x84,0x05,0x82,0x02,0x83,0x05,0x83,0x07,0x83,0x04,0x82,0x18,0x82,
-0x06,0x82,0x04,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x86,0x04,
-0x82,0x08,0x82,0x04,0x82,0x02,0x86,0x04,0x86,0x04,0x82,0x02,0x84,0x02,0x88,
-0x05,0x82,0x0a,0x82,0x03,0x85,0x05,0x82,0x08,0x82,0x01,0x82,0x01,0x82,0x02,
-0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x03,0x82,
-0x04,0x82,0x02,0x82,0x03,0x82,0x05,0x84,0x07,0x82,0x05,0x82,0x04,0x82,0x03,
-0x82,0x02,0x82,0x03,0x82,0x01,0x82,0x01,0x82,0x05,0x82,0x08,0x82,0x08,0x82,
-0x06,0x82,0x0a,0x82,0x0a,0x82,0x22,0x82,0x03,0x82,0x02,0x83,0x02,0x82,0x04,
-0x82,0x03,0x82,0x03,0x82,0x02,0x83,0x03,0x82,0x02,0x82,0x05,0x82,0x06,0x82,
-0x03,0x83,0x02,0x83,0x02,0x82,0x06,0x82,0x0b,0x82,0x02,0x82,0x02,0x82,0x07,
-0x82,0x05,0x88,0x02,0x83,0x02,0x82,0x04,0x82,0x02,0x82,0x03,0x83,0x02,0x82,
-0x04,0x82,0x02,0x83,0x03,0x83,0x02,0x82,0x02,0x82,0x04,0x82,0x04,0x82,0x06,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,
-0x03,0x82,0x04,0x82,0x08,0x82,0x02,0x84,0x09,0x82,0x09,0x84,0x23,0x82,0x11,
-0x82,0x01,0x82,0x06,0x82,0x01,0x82,0x05,0x82,0x05,0x82,0x01,0x82,0x11,0x82,
-0x0a,0x82,0x06,0x84,0x07,0x82,0x26,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x08,
-0x83,0x09,0x82,0x03,0x82,0x03,0x82,0x09,0x82,0x02,0x82,0x04,0x82,0x05,0x82,
-0x06,0x82,0x02,0x82,0x05,0x83,0x01,0x82,0x17,0x82,0x16,0x82,0x06,0x82,0x05,
-0x82,0x01,0x82,0x01,0x82,0x02,0x88,0x02,0x82,0x03,0x82,0x03,0x82,0x08,0x82,
-0x04,0x82,0x02,0x82,0x08,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,
-0x82,0x0a,0x82,0x03,0x82,0x02,0x82,0x04,0x82,0x08,0x82,0x01,0x82,0x01,0x82,
-0x02,0x82,0x02,0x84,0x02,0x82,0x04,0x82,0x02,0x86,0x04,0x82,0x04,0x82,0x02,
-0x86,0x09,0x82,0x06,0x82,0x05,0x82,0x04,0x82,0x04,0x84,0x04,0x82,0x01,0x82,
-0x01,0x82,0x04,0x84,0x07,0x82,0x07,0x82,0x07,0x82,0x0b,0x82,0x09,0x82,0x27,
-0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x04,0x82,0x06,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x0b,0x82,0x02,
-0x82,0x01,0x82,0x08,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,
-0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x07,
-0x82,0x0a,0x82,0x06,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,0x82,0x04,0x82,
-0x04,0x84,0x04,0x82,0x04,0x82,0x07,0x82,0x06,0x82,0x08,0x82,0x08,0x82,0x26,
-0x82,0x0f,0x88,0x05,0x82,0x01,0x82,0x05,0x82,0x05,0x82,0x02,0x82,0x01,0x82,
-0x0d,0x82,0x0a,0x82,0x05,0x82,0x02,0x82,0x06,0x82,0x26,0x82,0x05,0x82,0x04,
-0x82,0x05,0x82,0x07,0x82,0x0c,0x82,0x02,0x88,0x08,0x82,0x02,0x82,0x04,0x82,
-0x05,0x82,0x05,0x82,0x04,0x82,0x08,0x82,0x18,0x82,0x14,0x82,0x07,0x82,0x05,
-0x82,0x01,0x84,0x03,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,
-0x04,0x82,0x02,0x82,0x08,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,
-0x82,0x0a,0x82,0x03,0x82,0x02,0x82,0x04,0x82,0x08,0x82,0x01,0x82,0x01,0x82,
-0x02,0x82,0x02,0x84,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,
-0x82,0x02,0x82,0x0a,0x82,0x05,0x82,0x05,0x82,0x04,0x82,0x04,0x84,0x04,0x82,
-0x01,0x82,0x01,0x82,0x04,0x84,0x07,0x82,0x07,0x82,0x07,0x82,0x0b,0x82,0x09,
-0x82,0x22,0x87,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x88,
-0x04,0x82,0x06,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x0b,0x82,0x02,
-0x84,0x09,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x08,0x86,0x05,
-0x82,0x06,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,0x82,0x01,0x82,0x01,0x82,
-0x05,0x82,0x05,0x82,0x04,0x82,0x06,0x82,0x07,0x82,0x08,0x82,0x08,0x82,0x26,
-0x82,0x10,0x82,0x01,0x82,0x07,0x82,0x01,0x82,0x04,0x82,0x01,0x83,0x02,0x82,
-0x03,0x83,0x0f,0x82,0x08,0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x25,0x82,0x07,
-0x82,0x02,0x82,0x06,0x82,0x06,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x09,0x82,
-0x02,0x82,0x04,0x82,0x04,0x82,0x06,0x82,0x04,0x82,0x08,0x82,0x19,0x82,0x05,
-0x88,0x05,0x82,0x08,0x82,0x05,0x82,0x02,0x82,0x04,0x82,0x04,0x82,0x02,0x82,
-0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x08,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x05,0x82,0x03,0x82,0x03,0x82,0x03,0x82,
-0x03,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x03,0x83,0x02,0x82,0x04,0x82,0x02,
-0x82,0x08,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x03,0x82,0x09,0x82,0x05,0x82,
-0x05,0x82,0x04,0x82,0x04,0x84,0x04,0x83,0x02,0x83,0x03,0x82,0x02,0x82,0x06,
-0x82,0x06,0x82,0x08,0x82,0x0c,0x82,0x08,0x82,0x21,0x82,0x04,0x82,0x02,0x82,
-0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x0a,0x82,0x06,0x82,0x03,
-0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x0b,0x82,0x02,0x85,0x08,0x82,0x05,0x82,
-0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x0d,0x82,0x04,0x82,0x06,0x82,0x04,0x82,
-0x04,0x84,0x04,0x82,0x01,0x82,0x01,0x82,0x05,0x82,0x05,0x82,0x04,0x82,0x05,
-0x82,0x08,0x82,0x08,0x82,0x08,0x82,0x38,0x82,0x01,0x82,0x04,0x82,0x01,0x82,
-0x01,0x82,0x04,0x84,0x01,0x82,0x01,0x82,0x03,0x82,0x10,0x82,0x08,0x82,0x30,
-0x83,0x06,0x82,0x07,0x82,0x02,0x82,0x06,0x82,0x05,0x82,0x08,0x82,0x04,0x82,
-0x07,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x04,0x82,0x06,0x82,0x04,
-0x82,0x03,0x81,0x04,0x82,0x1a,0x82,0x10,0x82,0x10,0x82,0x08,0x82,0x04,0x82,
-0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,
-0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x05,0x82,0x03,0x82,
-0x03,0x82,0x03,0x82,0x03,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x03,0x83,0x02,
-0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x02,0x84,0x02,0x82,0x03,0x82,0x03,0x82,
-0x04,0x82,0x05,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x05,0x83,0x02,0x83,0x03,
-0x82,0x02,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x0c,0x82,0x08,0x82,0x21,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x0a,
-0x82,0x07,0x85,0x04,0x82,0x04,0x82,0x05,0x82,0x0b,0x82,0x02,0x82,0x02,0x82,
-0x07,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,
-0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x0d,0x82,0x04,0x82,
-0x06,0x82,0x04,0x82,0x04,0x84,0x04,0x82,0x01,0x82,0x01,0x82,0x04,0x84,0x04,
-0x82,0x04,0x82,0x04,0x82,0x09,0x82,0x08,0x82,0x08,0x82,0x26,0x82,0x10,0x82,
-0x01,0x82,0x05,0x86,0x04,0x82,0x01,0x82,0x01,0x82,0x01,0x83,0x01,0x84,0x10,
-0x82,0x06,0x82,0x1d,0x83,0x11,0x83,0x05,0x82,0x09,0x84,0x07,0x82,0x05,0x82,
-0x09,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,
-0x82,0x08,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x06,0x83,0x07,0x83,0x09,0x82,
-0x0e,0x82,0x0a,0x82,0x06,0x82,0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x03,
-0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x08,0x82,0x09,0x82,
-0x02,0x83,0x02,0x82,0x04,0x82,0x05,0x82,0x06,0x82,0x01,0x82,0x04,0x82,0x04,
-0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,
-0x03,0x82,0x09,0x82,0x02,0x82,0x03,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x06,
-0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x05,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x05,0x82,0x05,0x82,0x09,0x82,0x0d,0x82,0x07,0x82,0x21,0x82,0x04,0x82,0x02,
-0x83,0x02,0x82,0x04,0x82,0x03,0x82,0x03,0x82,0x02,0x83,0x03,0x82,0x03,0x82,
-0x04,0x82,0x06,0x82,0x08,0x82,0x04,0x82,0x05,0x82,0x0b,0x82,0x02,0x82,0x03,
-0x82,0x06,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x03,0x82,
-0x02,0x82,0x03,0x83,0x02,0x82,0x04,0x82,0x02,0x83,0x03,0x82,0x07,0x82,0x04,
-0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x02,0x83,0x05,0x82,0x05,0x88,0x03,0x82,
-0x02,0x82,0x04,0x82,0x02,0x83,0x03,0x82,0x0a,0x82,0x08,0x82,0x08,0x82,0x26,
-0x82,0x1c,0x82,0x06,0x82,0x02,0x83,0x03,0x84,0x02,0x82,0x10,0x82,0x04,0x82,
-0x1e,0x83,0x11,0x83,0x05,0x82,0x0a,0x82,0x05,0x88,0x02,0x88,0x04,0x84,0x09,
-0x82,0x05,0x84,0x06,0x84,0x05,0x82,0x09,0x84,0x06,0x84,0x07,0x83,0x07,0x83,
-0x0a,0x81,0x0e,0x81,0x0b,0x82,0x07,0x85,0x03,0x82,0x04,0x82,0x02,0x86,0x06,
-0x84,0x04,0x86,0x04,0x88,0x02,0x82,0x0a,0x84,0x01,0x81,0x02,0x82,0x04,0x82,
-0x02,0x88,0x04,0x83,0x05,0x82,0x04,0x82,0x02,0x88,0x02,0x82,0x04,0x82,0x02,
-0x82,0x04,0x82,0x04,0x84,0x04,0x82,0x0a,0x85,0x03,0x82,0x04,0x82,0x04,0x84,
-0x07,0x82,0x07,0x84,0x07,0x82,0x05,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,
-0x82,0x05,0x88,0x03,0x86,0x09,0x82,0x03,0x86,0x22,0x85,0x01,0x81,0x02,0x82,
-0x01,0x83,0x06,0x85,0x05,0x83,0x01,0x82,0x04,0x85,0x05,0x82,0x07,0x86,0x03,
-0x82,0x04,0x82,0x02,0x88,0x08,0x82,0x02,0x82,0x04,0x82,0x02,0x88,0x02,0x82,
-0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x04,0x84,0x04,0x82,0x01,0x83,0x06,
-0x83,0x01,0x82,0x03,0x82,0x08,0x86,0x06,0x84,0x05,0x83,0x01,0x82,0x05,0x82,
-0x06,0x82,0x02,0x82,0x03,0x82,0x04,0x82,0x04,0x83,0x01,0x82,0x03,0x87,0x06,
-0x84,0x05,0x82,0x05,0x84,0x7f,0x15,0x83,0x7f,0x14,0x83,0x7f,0x5e,0x82,0x7f,
-0x05,0x89,0x47,0x82,0x04,0x82,0x17,0x82,0x03,0x82,0x34,0x82,0x0e,0x82,0x4e,
-0x82,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x0a,0x82,0x04,0x82,0x17,0x82,0x03,0x82,
-0x34,0x82,0x0e,0x82,0x48,0x82,0x04,0x82,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x0a,
-0x82,0x04,0x82,0x17,0x82,0x03,0x82,0x34,0x82,0x0e,0x82,0x49,0x82,0x02,0x82,
-0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x0c,0x86,0x19,0x85,0x35,0x82,0x0e,0x82,0x4a,
-0x84,0x3f,
-0x00,
+  .glyphs = {
+    {  0,  0,  0,  0,     0 }, /* ' ' */
+    {  4,  1,  2, 13,     0 }, /* '!' */
+    {  2,  1,  6,  4,    13 }, /* '"' */
+    {  1,  2,  9, 11,    17 }, /* '#' */
+    {  1,  1,  8, 13,    39 }, /* '$' */
+    {  1,  2,  9, 12,    52 }, /* '%' */
+    {  1,  1,  9, 13,    76 }, /* '&' */
+    {  4,  1,  2,  5,   102 }, /* ''' */
+    {  3,  1,  5, 13,   107 }, /* '(' */
+    {  2,  1,  5, 13,   120 }, /* ')' */
+    {  1,  4,  8,  7,   133 }, /* '*' */
+    {  1,  4,  8,  7,   140 }, /* '+' */
+    {  3, 12,  4,  3,   147 }, /* ',' */
+    {  1,  7,  8,  1,   150 }, /* '-' */
+    {  4, 11,  3,  3,   151 }, /* '.' */
+    {  2,  2,  7, 12,   154 }, /* '/' */
+    {  1,  1,  8, 13,   166 }, /* '0' */
+    {  1,  1,  8, 13,   179 }, /* '1' */
+    {  1,  1,  8, 13,   192 }, /* '2' */
+    {  1,  1,  8, 13,   205 }, /* '3' */
+    {  1,  1,  8, 13,   218 }, /* '4' */
+    {  1,  1,  8, 13,   231 }, /* '5' */
+    {  1,  1,  8, 13,   244 }, /* '6' */
+    {  1,  1,  8, 13,   257 }, /* '7' */
+    {  1,  1,  8, 13,   270 }, /* '8' */
+    {  1,  1,  8, 13,   283 }, /* '9' */
+    {  4,  6,  3,  8,   296 }, /* ':' */
+    {  3,  6,  4,  9,   304 }, /* ';' */
+    {  1,  1,  7, 13,   313 }, /* '<' */
+    {  1,  5,  8,  6,   326 }, /* '=' */
+    {  2,  1,  7, 13,   332 }, /* '>' */
+    {  1,  1,  8, 13,   345 }, /* '?' */
+    {  1,  1,  8, 13,   358 }, /* '@' */
+    {  1,  1,  8, 13,   371 }, /* 'A' */
+    {  1,  1,  8, 13,   384 }, /* 'B' */
+    {  1,  1,  8, 13,   397 }, /* 'C' */
+    {  1,  1,  8, 13,   410 }, /* 'D' */
+    {  1,  1,  8, 13,   423 }, /* 'E' */
+    {  1,  1,  8, 13,   436 }, /* 'F' */
+    {  1,  1,  8, 13,   449 }, /* 'G' */
+    {  1,  1,  8, 13,   462 }, /* 'H' */
+    {  1,  1,  8, 13,   475 }, /* 'I' */
+    {  1,  1,  9, 13,   488 }, /* 'J' */
+    {  1,  1,  8, 13,   514 }, /* 'K' */
+    {  1,  1,  8, 13,   527 }, /* 'L' */
+    {  1,  1,  8, 13,   540 }, /* 'M' */
+    {  1,  1,  8, 13,   553 }, /* 'N' */
+    {  1,  1,  8, 13,   566 }, /* 'O' */
+    {  1,  1,  8, 13,   579 }, /* 'P' */
+    {  1,  1,  8, 14,   592 }, /* 'Q' */
+    {  1,  1,  8, 13,   606 }, /* 'R' */
+    {  1,  1,  8, 13,   619 }, /* 'S' */
+    {  1,  1,  8, 13,   632 }, /* 'T' */
+    {  1,  1,  8, 13,   645 }, /* 'U' */
+    {  1,  1,  8, 13,   658 }, /* 'V' */
+    {  1,  1,  8, 13,   671 }, /* 'W' */
+    {  1,  1,  8, 13,   684 }, /* 'X' */
+    {  1,  1,  8, 13,   697 }, /* 'Y' */
+    {  1,  1,  8, 13,   710 }, /* 'Z' */
+    {  2,  1,  6, 13,   723 }, /* '[' */
+    {  2,  2,  7, 12,   736 }, /* '\' */
+    {  2,  1,  6, 13,   748 }, /* ']' */
+    {  1,  1,  8,  4,   761 }, /* '^' */
+    {  1, 14,  9,  1,   765 }, /* '_' */
+    {  3,  1,  4,  3,   767 }, /* '`' */
+    {  1,  6,  8,  8,   770 }, /* 'a' */
+    {  1,  1,  8, 13,   778 }, /* 'b' */
+    {  1,  6,  8,  8,   791 }, /* 'c' */
+    {  1,  1,  8, 13,   799 }, /* 'd' */
+    {  1,  6,  8,  8,   812 }, /* 'e' */
+    {  1,  1,  8, 13,   820 }, /* 'f' */
+    {  1,  6,  8, 12,   833 }, /* 'g' */
+    {  1,  1,  8, 13,   845 }, /* 'h' */
+    {  1,  3,  8, 11,   858 }, /* 'i' */
+    {  2,  3,  7, 15,   869 }, /* 'j' */
+    {  1,  1,  8, 13,   884 }, /* 'k' */
+    {  1,  1,  8, 13,   897 }, /* 'l' */
+    {  1,  6,  8,  8,   910 }, /* 'm' */
+    {  1,  6,  8,  8,   918 }, /* 'n' */
+    {  1,  6,  8,  8,   926 }, /* 'o' */
+    {  1,  6,  8, 12,   934 }, /* 'p' */
+    {  1,  6,  8, 12,   946 }, /* 'q' */
+    {  1,  6,  8,  8,   958 }, /* 'r' */
+    {  1,  6,  8,  8,   966 }, /* 's' */
+    {  1,  3,  8, 11,   974 }, /* 't' */
+    {  1,  6,  8,  8,   985 }, /* 'u' */
+    {  1,  6,  8,  8,   993 }, /* 'v' */
+    {  1,  6,  8,  8,  1001 }, /* 'w' */
+    {  1,  6,  8,  8,  1009 }, /* 'x' */
+    {  1,  6,  8, 12,  1017 }, /* 'y' */
+    {  2,  6,  7,  8,  1029 }, /* 'z' */
+    {  1,  1,  8, 13,  1037 }, /* '{' */
+    {  4,  1,  2, 13,  1050 }, /* '|' */
+    {  1,  1,  8, 13,  1063 }, /* '}' */
+    {  1,  1,  8,  3,  1076 }, /* '~' */
+    {  0,  0,  0,  0,  1079 }, /* 0x7f */
+  },
+  .bits = {
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0xc0,0xc0,0xcc,0xcc,
+0xcc,0x48,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x7f,0x80,0x36,0x00,0x36,0x00,0x36,
+0x00,0xff,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x18,0x7e,0xdb,0xd8,0xd8,0xd8,
+0x7e,0x1b,0x1b,0x1b,0xdb,0x7e,0x18,0x73,0x00,0xdb,0x00,0xde,0x00,0x76,0x00,
+0x0c,0x00,0x0c,0x00,0x18,0x00,0x18,0x00,0x37,0x00,0x3d,0x80,0x6d,0x80,0x67,
+0x00,0x38,0x00,0x6c,0x00,0x6c,0x00,0x6c,0x00,0x78,0x00,0x30,0x00,0x70,0x00,
+0xd8,0x00,0xcd,0x80,0xc7,0x00,0xc6,0x00,0xef,0x00,0x79,0x80,0xc0,0xc0,0xc0,
+0xc0,0x80,0x18,0x30,0x60,0x60,0xc0,0xc0,0xc0,0xc0,0xc0,0x60,0x60,0x30,0x18,
+0xc0,0x60,0x30,0x30,0x18,0x18,0x18,0x18,0x18,0x30,0x30,0x60,0xc0,0x66,0x66,
+0x3c,0xff,0x3c,0x66,0x66,0x18,0x18,0x18,0xff,0x18,0x18,0x18,0x70,0x70,0xe0,
+0xff,0xe0,0xe0,0xe0,0x06,0x06,0x0c,0x0c,0x18,0x18,0x30,0x30,0x60,0x60,0xc0,
+0xc0,0x18,0x3c,0x66,0x66,0xc3,0xc3,0xc3,0xc3,0xc3,0x66,0x66,0x3c,0x18,0x18,
+0x38,0x78,0xd8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xff,0x3c,0x66,0xc3,
+0xc3,0x03,0x03,0x06,0x1c,0x30,0x60,0xc0,0xc0,0xff,0x3c,0x66,0xc3,0xc3,0x03,
+0x06,0x1c,0x06,0x03,0xc3,0xc3,0x66,0x3c,0x02,0x06,0x0e,0x1e,0x36,0x66,0xc6,
+0xc6,0xff,0x06,0x06,0x06,0x06,0xff,0xc0,0xc0,0xc0,0xc0,0xdc,0xe6,0x03,0x03,
+0x03,0xc3,0x66,0x3c,0x3c,0x66,0xc2,0xc0,0xc0,0xdc,0xe6,0xc3,0xc3,0xc3,0xc3,
+0x66,0x3c,0xff,0x03,0x03,0x06,0x06,0x0c,0x0c,0x18,0x18,0x30,0x30,0x60,0x60,
+0x3c,0x66,0xc3,0xc3,0xc3,0x66,0x3c,0x66,0xc3,0xc3,0xc3,0x66,0x3c,0x3c,0x66,
+0xc3,0xc3,0xc3,0xc3,0x67,0x3b,0x03,0x03,0x43,0x66,0x3c,0xe0,0xe0,0x00,0x00,
+0x00,0x00,0xe0,0xe0,0x70,0x70,0x00,0x00,0x00,0x00,0x70,0x70,0xe0,0x02,0x06,
+0x0c,0x18,0x30,0x60,0xc0,0x60,0x30,0x18,0x0c,0x06,0x02,0xff,0x00,0x00,0x00,
+0x00,0xff,0x80,0xc0,0x60,0x30,0x18,0x0c,0x06,0x0c,0x18,0x30,0x60,0xc0,0x80,
+0x3c,0x66,0xc3,0xc3,0xc3,0x06,0x0c,0x18,0x18,0x18,0x00,0x18,0x18,0x3c,0x66,
+0xc3,0xcf,0xdf,0xdb,0xdb,0xdb,0xde,0xcc,0xc0,0x63,0x3e,0x18,0x3c,0x66,0x66,
+0xc3,0xc3,0xc3,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xf8,0xcc,0xc6,0xc6,0xc6,0xcc,
+0xfc,0xc6,0xc3,0xc3,0xc3,0xc6,0xfc,0x3c,0x66,0xc3,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc3,0x66,0x3c,0xfc,0xc6,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xc6,0xfc,0xff,0xc0,0xc0,0xc0,0xc0,0xc0,0xfc,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xff,0xff,0xc0,0xc0,0xc0,0xc0,0xc0,0xfc,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x3c,
+0x66,0xc3,0xc0,0xc0,0xc0,0xcf,0xc3,0xc3,0xc3,0xc3,0x67,0x3d,0xc3,0xc3,0xc3,
+0xc3,0xc3,0xc3,0xff,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xff,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xff,0x1f,0x80,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0xc6,0x00,0xc6,0x00,
+0x6c,0x00,0x38,0x00,0xc3,0xc3,0xc6,0xc6,0xcc,0xcc,0xf8,0xcc,0xcc,0xc6,0xc6,
+0xc3,0xc3,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xff,
+0xc3,0xc3,0xe7,0xe7,0xff,0xdb,0xdb,0xdb,0xdb,0xc3,0xc3,0xc3,0xc3,0xc3,0xe3,
+0xe3,0xf3,0xf3,0xdb,0xdb,0xcf,0xcf,0xc7,0xc7,0xc3,0xc3,0x3c,0x66,0xc3,0xc3,
+0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x66,0x3c,0xfc,0xc6,0xc3,0xc3,0xc3,0xc3,
+0xc6,0xfc,0xc0,0xc0,0xc0,0xc0,0xc0,0x3c,0x66,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xdb,0xcf,0x66,0x3e,0x03,0xfc,0xc6,0xc3,0xc3,0xc3,0xc3,0xc6,0xfc,0xcc,
+0xc6,0xc6,0xc3,0xc3,0x3c,0x66,0xc3,0xc0,0xc0,0x60,0x3c,0x06,0x03,0x03,0xc3,
+0x66,0x3c,0xff,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x66,0x3c,0xc3,0xc3,
+0xc3,0xc3,0x66,0x66,0x66,0x3c,0x3c,0x3c,0x18,0x18,0x18,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xdb,0xdb,0xdb,0xdb,0xe7,0xe7,0xc3,0xc3,0xc3,0xc3,0x66,0x66,0x3c,0x3c,
+0x18,0x3c,0x3c,0x66,0x66,0xc3,0xc3,0xc3,0xc3,0x66,0x66,0x3c,0x3c,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0xff,0x03,0x03,0x06,0x0c,0x0c,0x18,0x30,0x30,0x60,
+0xc0,0xc0,0xff,0xfc,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xfc,0xc0,0xc0,0x60,0x60,0x30,0x30,0x18,0x18,0x0c,0x0c,0x06,0x06,0xfc,0x0c,
+0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0xfc,0x18,0x3c,0x66,0xc3,
+0xff,0x80,0xc0,0x60,0x30,0x3e,0x63,0x03,0x7f,0xc3,0xc3,0xc3,0x7d,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xdc,0xe6,0xc3,0xc3,0xc3,0xc3,0xe6,0xdc,0x3e,0x63,0xc0,0xc0,
+0xc0,0xc0,0x63,0x3e,0x03,0x03,0x03,0x03,0x03,0x3b,0x67,0xc3,0xc3,0xc3,0xc3,
+0x67,0x3b,0x3c,0x66,0xc3,0xff,0xc0,0xc0,0x63,0x3e,0x1e,0x33,0x33,0x30,0x30,
+0xfc,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x7d,0xc7,0xc6,0xc6,0xc6,0x7c,0xc0,
+0x7e,0xc3,0xc3,0xc3,0x7e,0xc0,0xc0,0xc0,0xc0,0xc0,0xdc,0xe6,0xc3,0xc3,0xc3,
+0xc3,0xc3,0xc3,0x18,0x18,0x00,0x78,0x18,0x18,0x18,0x18,0x18,0x18,0xff,0x06,
+0x06,0x00,0x1e,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0xc6,0xc6,0xc6,0x7c,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc6,0xcc,0xd8,0xf0,0xf8,0xcc,0xc6,0xc3,0x78,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xff,0xb6,0xff,0xdb,0xdb,0xdb,
+0xdb,0xdb,0xdb,0xdc,0xe6,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x3c,0x66,0xc3,0xc3,
+0xc3,0xc3,0x66,0x3c,0xdc,0xe6,0xc3,0xc3,0xc3,0xc3,0xe6,0xdc,0xc0,0xc0,0xc0,
+0xc0,0x3b,0x67,0xc3,0xc3,0xc3,0xc3,0x67,0x3b,0x03,0x03,0x03,0x03,0xde,0x73,
+0x60,0x60,0x60,0x60,0x60,0x60,0x7e,0xc3,0xc0,0x7e,0x03,0x03,0xc3,0x7e,0x30,
+0x30,0x30,0xfc,0x30,0x30,0x30,0x30,0x30,0x33,0x1e,0xc3,0xc3,0xc3,0xc3,0xc3,
+0xc3,0x67,0x3b,0xc3,0xc3,0x66,0x66,0x3c,0x3c,0x18,0x18,0xc3,0xc3,0xc3,0xdb,
+0xdb,0xdb,0xff,0x66,0xc3,0x66,0x3c,0x18,0x18,0x3c,0x66,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xc3,0xc3,0x67,0x3b,0x03,0xc3,0x66,0x3c,0xfe,0x06,0x0c,0x18,0x30,0x60,
+0xc0,0xfe,0x0f,0x18,0x18,0x18,0x18,0x18,0xf0,0x18,0x18,0x18,0x18,0x18,0x0f,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xf0,0x18,
+0x18,0x18,0x18,0x18,0x0f,0x18,0x18,0x18,0x18,0x18,0xf0,0x73,0xdb,0xce,
   }
 };
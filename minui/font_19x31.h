@@ -1,382 +1,348 @@
-struct CFont bigfont = {
-  .width = 1824,
-  .height = 31,
+static const struct CFont bigfont = {
   .cwidth = 19,
   .cheight = 31,
   .cheightfix = 0,
-  .rundata = {
-0x1c,0x82,0x0d,0x82,0x05,0x82,0x0d,0x81,0x06,0x81,0x0b,0x82,0x17,0x81,0x0d,
-0x81,0x12,0x82,0x13,0x82,0x0c,0x82,0x14,0x81,0x63,0x81,0x21,0x81,0x39,0x83,
-0x09,0x8a,0x1a,0x8f,0x7f,0x36,0x83,0x0a,0x87,0x1f,0x85,0x0f,0x8d,0x07,0x8d,
-0x17,0x82,0x0b,0x82,0x06,0x8b,0x11,0x82,0x07,0x82,0x0b,0x82,0x05,0x82,0x0f,
-0x83,0x09,0x83,0x04,0x83,0x0a,0x82,0x18,0x86,0x20,0x85,0x1f,0x90,0x11,0x82,
-0x04,0x82,0x0b,0x82,0x03,0x81,0x0f,0x81,0x03,0x82,0x0a,0x82,0x04,0x82,0x0d,
-0x82,0x03,0x8f,0x08,0x88,0x09,0x81,0x13,0x88,0x34,0x81,0x1f,0x82,0x31,0x82,
-0x1e,0x87,0x19,0x82,0x16,0x82,0x13,0x82,0x0a,0x82,0x13,0x85,0x7f,0x7f,0x30,
-0x82,0x5e,0x82,0x0d,0x82,0x05,0x82,0x0d,0x81,0x06,0x81,0x0b,0x82,0x0b,0x81,
-0x03,0x81,0x07,0x81,0x0d,0x81,0x12,0x82,0x12,0x82,0x0e,0x82,0x13,0x81,0x62,
-0x82,0x0a,0x87,0x0f,0x82,0x0d,0x88,0x0b,0x87,0x12,0x83,0x09,0x8a,0x0d,0x87,
-0x06,0x8f,0x08,0x87,0x0c,0x87,0x6a,0x88,0x0c,0x88,0x0d,0x83,0x0a,0x8c,0x0d,
-0x89,0x04,0x8a,0x0a,0x8d,0x07,0x8d,0x09,0x89,0x05,0x82,0x0b,0x82,0x07,0x89,
-0x12,0x82,0x07,0x82,0x0a,0x82,0x06,0x82,0x0f,0x83,0x08,0x84,0x04,0x83,0x0a,
-0x82,0x08,0x87,0x09,0x8b,0x0b,0x87,0x09,0x8a,0x0c,0x8a,0x04,0x90,0x04,0x82,
-0x0b,0x82,0x04,0x82,0x0b,0x82,0x03,0x81,0x0f,0x81,0x04,0x81,0x0a,0x81,0x06,
-0x81,0x0d,0x81,0x04,0x8f,0x08,0x88,0x09,0x82,0x12,0x88,0x0e,0x82,0x24,0x82,
-0x1e,0x82,0x31,0x82,0x1d,0x82,0x1f,0x82,0x16,0x82,0x13,0x82,0x0a,0x82,0x16,
-0x82,0x7f,0x7f,0x20,0x84,0x0c,0x82,0x0d,0x84,0x4d,0x82,0x0d,0x82,0x05,0x82,
-0x0d,0x81,0x06,0x81,0x0b,0x82,0x0a,0x81,0x05,0x81,0x05,0x81,0x0e,0x81,0x12,
-0x82,0x12,0x81,0x10,0x81,0x13,0x81,0x62,0x81,0x0a,0x82,0x05,0x82,0x0c,0x84,
-0x0b,0x83,0x06,0x82,0x08,0x82,0x06,0x82,0x10,0x81,0x01,0x82,0x09,0x82,0x13,
-0x83,0x19,0x81,0x08,0x82,0x05,0x82,0x09,0x82,0x06,0x82,0x68,0x82,0x06,0x82,
-0x0a,0x81,0x08,0x81,0x0c,0x83,0x0a,0x82,0x08,0x83,0x0a,0x83,0x06,0x82,0x04,
-0x82,0x07,0x83,0x08,0x82,0x12,0x82,0x13,0x83,0x05,0x81,0x06,0x82,0x0b,0x82,
-0x0a,0x82,0x16,0x82,0x07,0x82,0x09,0x82,0x07,0x82,0x0f,0x82,0x01,0x81,0x07,
-0x84,0x04,0x84,0x09,0x82,0x06,0x83,0x05,0x83,0x07,0x82,0x07,0x83,0x08,0x83,
-0x05,0x82,0x08,0x82,0x06,0x83,0x0a,0x82,0x07,0x82,0x0b,0x82,0x0b,0x82,0x0b,
-0x82,0x04,0x82,0x0b,0x82,0x03,0x81,0x0f,0x81,0x04,0x82,0x08,0x82,0x06,0x82,
-0x0b,0x82,0x10,0x82,0x09,0x82,0x10,0x81,0x18,0x82,0x0e,0x82,0x25,0x82,0x1d,
-0x82,0x31,0x82,0x1d,0x82,0x1f,0x82,0x37,0x82,0x16,0x82,0x7f,0x7f,0x1f,0x82,
-0x0f,0x82,0x10,0x82,0x4c,0x82,0x0d,0x82,0x05,0x82,0x0d,0x81,0x06,0x81,0x08,
-0x8a,0x05,0x81,0x05,0x81,0x05,0x81,0x0e,0x81,0x12,0x82,0x11,0x81,0x12,0x81,
-0x12,0x81,0x61,0x82,0x09,0x82,0x07,0x82,0x0a,0x82,0x02,0x81,0x15,0x82,0x10,
-0x82,0x0e,0x81,0x02,0x82,0x09,0x82,0x12,0x82,0x1a,0x82,0x07,0x82,0x07,0x82,
-0x08,0x81,0x08,0x82,0x70,0x82,0x08,0x81,0x0a,0x81,0x0b,0x81,0x01,0x82,0x09,
-0x82,0x0a,0x82,0x08,0x83,0x0d,0x82,0x09,0x82,0x07,0x82,0x12,0x82,0x12,0x82,
-0x0e,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x08,0x82,0x08,0x82,0x0f,
-0x82,0x01,0x81,0x07,0x81,0x01,0x82,0x04,0x82,0x01,0x81,0x09,0x82,0x05,0x83,
-0x07,0x82,0x07,0x82,0x08,0x83,0x06,0x83,0x07,0x82,0x07,0x82,0x08,0x82,0x08,
-0x82,0x15,0x82,0x0b,0x82,0x0b,0x82,0x05,0x81,0x0a,0x82,0x04,0x82,0x0e,0x81,
-0x05,0x81,0x08,0x81,0x08,0x81,0x0b,0x81,0x11,0x81,0x0a,0x82,0x10,0x82,0x17,
-0x82,0x0d,0x81,0x02,0x81,0x43,0x82,0x31,0x82,0x1d,0x81,0x20,0x82,0x37,0x82,
-0x16,0x82,0x7f,0x16,0x81,0x7f,0x08,0x82,0x0f,0x82,0x10,0x82,0x4c,0x82,0x0d,
-0x82,0x05,0x82,0x0c,0x82,0x05,0x82,0x07,0x82,0x02,0x82,0x0a,0x81,0x05,0x81,
-0x04,0x81,0x09,0x82,0x04,0x81,0x04,0x82,0x0c,0x82,0x10,0x82,0x12,0x82,0x0b,
-0x82,0x04,0x81,0x04,0x82,0x5b,0x81,0x0a,0x81,0x09,0x81,0x09,0x82,0x03,0x81,
-0x15,0x82,0x10,0x82,0x0e,0x81,0x02,0x82,0x09,0x82,0x11,0x82,0x1b,0x81,0x08,
-0x81,0x09,0x81,0x07,0x82,0x09,0x81,0x71,0x81,0x07,0x81,0x0c,0x81,0x09,0x82,
-0x01,0x82,0x09,0x82,0x0a,0x82,0x07,0x83,0x0e,0x82,0x0a,0x82,0x06,0x82,0x12,
-0x82,0x11,0x82,0x0f,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x08,0x81,
-0x09,0x82,0x0f,0x82,0x01,0x81,0x07,0x81,0x01,0x82,0x04,0x82,0x01,0x82,0x08,
-0x82,0x05,0x82,0x09,0x82,0x06,0x82,0x09,0x82,0x06,0x82,0x09,0x82,0x06,0x82,
-0x08,0x82,0x08,0x82,0x15,0x82,0x0b,0x82,0x0b,0x82,0x05,0x82,0x09,0x82,0x04,
-0x82,0x0d,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x09,0x82,0x10,0x82,0x0a,0x82,
-0x11,0x81,0x17,0x82,0x0d,0x81,0x02,0x81,0x43,0x82,0x31,0x82,0x1d,0x81,0x20,
-0x82,0x37,0x82,0x16,0x82,0x7f,0x16,0x81,0x7f,0x08,0x81,0x10,0x82,0x11,0x81,
-0x4c,0x82,0x0d,0x82,0x05,0x82,0x0c,0x81,0x06,0x81,0x08,0x81,0x03,0x82,0x0a,
-0x81,0x05,0x81,0x04,0x81,0x09,0x8d,0x0c,0x82,0x10,0x81,0x14,0x81,0x0b,0x8d,
-0x0b,0x82,0x4d,0x82,0x09,0x82,0x09,0x82,0x07,0x81,0x05,0x81,0x16,0x81,0x11,
-0x81,0x0d,0x81,0x03,0x82,0x09,0x82,0x11,0x82,0x1a,0x82,0x08,0x81,0x09,0x81,
-0x07,0x81,0x0a,0x82,0x38,0x82,0x17,0x82,0x1d,0x81,0x06,0x81,0x0d,0x81,0x09,
-0x81,0x03,0x81,0x09,0x82,0x0a,0x82,0x07,0x82,0x0f,0x82,0x0a,0x82,0x06,0x82,
-0x12,0x82,0x11,0x82,0x0f,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x07,
-0x81,0x0a,0x82,0x0f,0x82,0x01,0x81,0x07,0x81,0x01,0x82,0x04,0x82,0x02,0x81,
-0x08,0x82,0x04,0x82,0x0b,0x81,0x06,0x82,0x09,0x82,0x05,0x82,0x0b,0x81,0x06,
-0x82,0x08,0x82,0x08,0x81,0x16,0x82,0x0b,0x82,0x0b,0x82,0x05,0x82,0x09,0x82,
-0x04,0x82,0x0d,0x82,0x06,0x82,0x05,0x81,0x0a,0x81,0x09,0x81,0x11,0x81,0x0b,
-0x82,0x11,0x82,0x16,0x82,0x0c,0x81,0x04,0x81,0x42,0x82,0x31,0x82,0x1c,0x82,
-0x20,0x82,0x37,0x82,0x16,0x82,0x7f,0x16,0x81,0x7f,0x07,0x82,0x10,0x82,0x11,
-0x82,0x4b,0x82,0x0d,0x82,0x05,0x82,0x0c,0x81,0x06,0x81,0x08,0x81,0x03,0x82,
-0x0a,0x81,0x05,0x81,0x03,0x81,0x0f,0x83,0x11,0x82,0x0f,0x82,0x14,0x82,0x0f,
-0x83,0x10,0x82,0x4d,0x81,0x0a,0x82,0x09,0x82,0x0d,0x81,0x16,0x81,0x11,0x81,
-0x0c,0x82,0x03,0x82,0x09,0x81,0x12,0x81,0x1b,0x82,0x08,0x81,0x09,0x81,0x07,
-0x81,0x0b,0x81,0x36,0x83,0x19,0x83,0x1b,0x81,0x06,0x81,0x0e,0x81,0x08,0x81,
-0x03,0x81,0x09,0x82,0x0a,0x82,0x06,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x12,
-0x82,0x10,0x82,0x10,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x06,0x82,
-0x0a,0x82,0x0f,0x82,0x08,0x81,0x02,0x82,0x04,0x82,0x02,0x82,0x07,0x82,0x04,
-0x82,0x0b,0x82,0x05,0x82,0x09,0x82,0x05,0x82,0x0b,0x82,0x05,0x82,0x08,0x82,
-0x08,0x81,0x16,0x82,0x0b,0x82,0x0b,0x82,0x06,0x81,0x09,0x81,0x05,0x82,0x0d,
-0x82,0x07,0x81,0x04,0x82,0x0a,0x82,0x07,0x82,0x10,0x81,0x0c,0x82,0x12,0x81,
-0x16,0x82,0x0c,0x81,0x04,0x81,0x42,0x82,0x31,0x82,0x1b,0x8a,0x0c,0x88,0x05,
-0x82,0x12,0x86,0x0d,0x89,0x09,0x82,0x0a,0x81,0x0b,0x82,0x0a,0x82,0x13,0x82,
-0x23,0x82,0x1e,0x82,0x06,0x82,0x26,0x8a,0x06,0x82,0x09,0x82,0x05,0x81,0x0c,
-0x82,0x03,0x81,0x06,0x83,0x06,0x81,0x04,0x82,0x09,0x82,0x05,0x81,0x0c,0x82,
-0x06,0x8c,0x0c,0x82,0x10,0x82,0x11,0x82,0x4b,0x82,0x0d,0x82,0x05,0x82,0x07,
-0x91,0x04,0x81,0x03,0x82,0x0a,0x81,0x05,0x81,0x03,0x81,0x0f,0x81,0x01,0x81,
-0x11,0x82,0x0f,0x81,0x16,0x81,0x0f,0x81,0x01,0x81,0x10,0x82,0x4d,0x81,0x0a,
-0x82,0x09,0x82,0x0d,0x81,0x16,0x81,0x10,0x82,0x0c,0x81,0x04,0x82,0x09,0x81,
-0x11,0x82,0x1b,0x81,0x09,0x82,0x07,0x82,0x07,0x81,0x0b,0x81,0x0c,0x82,0x11,
-0x82,0x13,0x82,0x08,0x8f,0x08,0x82,0x18,0x82,0x05,0x82,0x04,0x87,0x03,0x81,
-0x07,0x82,0x03,0x82,0x08,0x82,0x0a,0x82,0x06,0x82,0x10,0x82,0x0b,0x82,0x05,
-0x82,0x12,0x82,0x10,0x82,0x10,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,
-0x05,0x82,0x0b,0x82,0x0f,0x82,0x02,0x81,0x05,0x81,0x02,0x82,0x04,0x82,0x03,
-0x81,0x07,0x82,0x04,0x82,0x0b,0x82,0x05,0x82,0x09,0x82,0x05,0x82,0x0b,0x82,
-0x05,0x82,0x08,0x82,0x08,0x82,0x15,0x82,0x0b,0x82,0x0b,0x82,0x06,0x82,0x07,
-0x82,0x06,0x81,0x06,0x81,0x06,0x82,0x07,0x82,0x03,0x81,0x0c,0x82,0x05,0x82,
-0x10,0x82,0x0c,0x82,0x12,0x81,0x16,0x82,0x12,0x81,0x31,0x88,0x08,0x82,0x03,
-0x86,0x0d,0x88,0x0a,0x86,0x03,0x82,0x08,0x87,0x08,0x8e,0x09,0x89,0x07,0x82,
-0x03,0x86,0x0a,0x85,0x0f,0x87,0x09,0x82,0x09,0x81,0x0c,0x82,0x0a,0x82,0x02,
-0x84,0x03,0x84,0x06,0x82,0x03,0x86,0x0b,0x87,0x08,0x82,0x03,0x86,0x0c,0x86,
-0x03,0x82,0x06,0x82,0x03,0x86,0x0a,0x89,0x06,0x8e,0x06,0x82,0x09,0x82,0x05,
-0x82,0x0b,0x82,0x03,0x81,0x06,0x83,0x06,0x81,0x05,0x82,0x07,0x82,0x06,0x82,
-0x0b,0x82,0x06,0x8c,0x0c,0x82,0x10,0x82,0x11,0x82,0x4b,0x82,0x0d,0x82,0x05,
-0x82,0x07,0x91,0x04,0x82,0x02,0x82,0x0a,0x81,0x05,0x81,0x02,0x81,0x0f,0x81,
-0x03,0x81,0x10,0x82,0x0e,0x82,0x16,0x82,0x0d,0x81,0x03,0x81,0x0f,0x82,0x4c,
-0x82,0x0a,0x82,0x09,0x82,0x0c,0x82,0x15,0x82,0x10,0x81,0x0c,0x81,0x05,0x82,
-0x09,0x81,0x11,0x82,0x1a,0x82,0x0a,0x81,0x07,0x81,0x08,0x81,0x0b,0x81,0x0c,
-0x82,0x11,0x82,0x11,0x82,0x0a,0x8f,0x0a,0x82,0x16,0x82,0x05,0x81,0x04,0x81,
-0x05,0x82,0x03,0x81,0x07,0x81,0x05,0x81,0x08,0x82,0x0a,0x82,0x06,0x82,0x10,
-0x82,0x0b,0x82,0x05,0x82,0x12,0x82,0x10,0x82,0x10,0x82,0x0b,0x82,0x0a,0x82,
-0x16,0x82,0x07,0x82,0x04,0x82,0x0c,0x82,0x0f,0x82,0x02,0x81,0x05,0x81,0x02,
-0x82,0x04,0x82,0x03,0x82,0x06,0x82,0x04,0x82,0x0b,0x82,0x05,0x82,0x09,0x82,
-0x05,0x82,0x0b,0x82,0x05,0x82,0x08,0x82,0x08,0x82,0x15,0x82,0x0b,0x82,0x0b,
-0x82,0x06,0x82,0x07,0x82,0x06,0x81,0x05,0x83,0x05,0x81,0x09,0x81,0x02,0x82,
-0x0d,0x81,0x05,0x81,0x11,0x81,0x0d,0x82,0x12,0x82,0x15,0x82,0x0b,0x81,0x06,
-0x81,0x30,0x82,0x06,0x83,0x06,0x82,0x08,0x83,0x0a,0x82,0x06,0x81,0x09,0x82,
-0x05,0x81,0x02,0x82,0x07,0x82,0x06,0x82,0x0b,0x82,0x0f,0x81,0x06,0x82,0x08,
-0x82,0x07,0x83,0x0c,0x82,0x14,0x82,0x09,0x82,0x08,0x81,0x0d,0x82,0x0a,0x82,
-0x05,0x82,0x05,0x82,0x05,0x82,0x07,0x83,0x09,0x82,0x05,0x82,0x07,0x82,0x08,
-0x83,0x09,0x82,0x05,0x81,0x02,0x82,0x06,0x82,0x02,0x81,0x0e,0x82,0x08,0x81,
-0x0a,0x82,0x0e,0x82,0x09,0x82,0x06,0x81,0x0b,0x81,0x04,0x81,0x06,0x81,0x01,
-0x81,0x06,0x81,0x06,0x81,0x07,0x81,0x08,0x81,0x0b,0x81,0x11,0x81,0x0d,0x82,
-0x10,0x82,0x11,0x82,0x4b,0x82,0x21,0x82,0x05,0x82,0x08,0x82,0x02,0x82,0x0b,
-0x81,0x03,0x81,0x03,0x81,0x0f,0x81,0x03,0x82,0x1f,0x82,0x16,0x82,0x0d,0x81,
-0x03,0x82,0x0e,0x82,0x4c,0x81,0x0b,0x81,0x0b,0x81,0x0c,0x82,0x15,0x81,0x10,
-0x81,0x0c,0x82,0x05,0x82,0x09,0x81,0x11,0x82,0x1a,0x81,0x0c,0x82,0x03,0x82,
-0x09,0x82,0x09,0x82,0x30,0x82,0x27,0x82,0x13,0x82,0x06,0x81,0x04,0x81,0x05,
-0x82,0x03,0x81,0x07,0x81,0x05,0x81,0x08,0x82,0x09,0x82,0x07,0x82,0x10,0x82,
-0x0b,0x82,0x05,0x82,0x12,0x82,0x10,0x82,0x10,0x82,0x0b,0x82,0x0a,0x82,0x16,
-0x82,0x07,0x82,0x03,0x82,0x0d,0x82,0x0f,0x82,0x02,0x81,0x05,0x81,0x02,0x82,
-0x04,0x82,0x04,0x81,0x06,0x82,0x04,0x82,0x0b,0x82,0x05,0x82,0x09,0x82,0x05,
-0x82,0x0b,0x82,0x05,0x82,0x08,0x82,0x09,0x83,0x13,0x82,0x0b,0x82,0x0b,0x82,
-0x07,0x81,0x07,0x81,0x07,0x81,0x05,0x81,0x01,0x81,0x05,0x81,0x09,0x84,0x0e,
-0x82,0x03,0x82,0x10,0x82,0x0d,0x82,0x13,0x81,0x15,0x82,0x0b,0x81,0x07,0x81,
-0x38,0x82,0x06,0x83,0x08,0x82,0x09,0x82,0x10,0x82,0x08,0x83,0x06,0x82,0x08,
-0x81,0x0b,0x82,0x0e,0x82,0x06,0x82,0x08,0x83,0x07,0x82,0x0c,0x82,0x14,0x82,
-0x09,0x82,0x07,0x81,0x0e,0x82,0x0a,0x83,0x04,0x83,0x04,0x82,0x05,0x83,0x07,
-0x82,0x08,0x82,0x07,0x82,0x06,0x83,0x08,0x82,0x08,0x82,0x08,0x83,0x06,0x82,
-0x01,0x81,0x0f,0x81,0x14,0x82,0x0e,0x82,0x09,0x82,0x06,0x82,0x09,0x82,0x04,
-0x82,0x05,0x81,0x01,0x81,0x05,0x82,0x06,0x82,0x05,0x82,0x08,0x82,0x09,0x82,
-0x10,0x81,0x0e,0x82,0x10,0x82,0x11,0x82,0x4b,0x82,0x21,0x81,0x06,0x81,0x0b,
-0x84,0x12,0x82,0x0e,0x82,0x04,0x81,0x1f,0x82,0x16,0x82,0x0c,0x82,0x04,0x81,
-0x0e,0x82,0x4b,0x82,0x0b,0x81,0x0b,0x81,0x0c,0x82,0x14,0x82,0x0a,0x85,0x0e,
-0x81,0x06,0x82,0x09,0x89,0x09,0x82,0x02,0x87,0x10,0x82,0x0d,0x85,0x0a,0x82,
-0x09,0x82,0x2e,0x82,0x2b,0x82,0x10,0x82,0x07,0x81,0x03,0x81,0x06,0x82,0x03,
-0x81,0x06,0x82,0x05,0x82,0x07,0x8a,0x0a,0x82,0x10,0x82,0x0b,0x82,0x05,0x8c,
-0x08,0x82,0x10,0x82,0x10,0x8f,0x0a,0x82,0x16,0x82,0x07,0x82,0x02,0x83,0x0d,
-0x82,0x0f,0x82,0x02,0x81,0x05,0x81,0x02,0x82,0x04,0x82,0x04,0x82,0x05,0x82,
-0x04,0x82,0x0b,0x82,0x05,0x82,0x09,0x82,0x05,0x82,0x0b,0x82,0x05,0x82,0x07,
-0x82,0x0b,0x84,0x11,0x82,0x0b,0x82,0x0b,0x82,0x07,0x81,0x07,0x81,0x07,0x82,
-0x04,0x81,0x01,0x81,0x05,0x81,0x0a,0x82,0x10,0x81,0x03,0x81,0x10,0x82,0x0e,
-0x82,0x13,0x82,0x14,0x82,0x0a,0x81,0x08,0x81,0x39,0x81,0x06,0x83,0x09,0x82,
-0x07,0x82,0x10,0x82,0x09,0x83,0x05,0x82,0x09,0x82,0x0a,0x82,0x0e,0x81,0x08,
-0x81,0x08,0x83,0x07,0x82,0x0c,0x82,0x14,0x82,0x09,0x82,0x06,0x81,0x0f,0x82,
-0x0a,0x83,0x04,0x83,0x05,0x81,0x05,0x83,0x07,0x82,0x07,0x82,0x09,0x82,0x05,
-0x83,0x09,0x82,0x06,0x82,0x09,0x83,0x06,0x83,0x10,0x81,0x14,0x82,0x0e,0x82,
-0x09,0x82,0x06,0x82,0x09,0x82,0x04,0x82,0x05,0x81,0x01,0x81,0x05,0x82,0x07,
-0x82,0x03,0x82,0x0a,0x81,0x09,0x82,0x0f,0x81,0x0f,0x82,0x10,0x82,0x11,0x82,
-0x4b,0x82,0x21,0x81,0x06,0x81,0x0d,0x83,0x11,0x81,0x0e,0x82,0x05,0x82,0x1e,
-0x82,0x16,0x82,0x0b,0x82,0x05,0x82,0x07,0x8e,0x45,0x81,0x0b,0x82,0x0b,0x81,
-0x0c,0x82,0x14,0x81,0x0b,0x85,0x0d,0x81,0x07,0x82,0x10,0x83,0x08,0x81,0x02,
-0x81,0x06,0x82,0x0f,0x81,0x0e,0x85,0x0b,0x82,0x06,0x81,0x02,0x81,0x2c,0x82,
-0x2f,0x82,0x0d,0x82,0x08,0x81,0x03,0x81,0x06,0x82,0x03,0x81,0x06,0x82,0x05,
-0x82,0x07,0x8a,0x0a,0x82,0x10,0x82,0x0b,0x82,0x05,0x8c,0x08,0x8c,0x06,0x82,
-0x06,0x86,0x04,0x8f,0x0a,0x82,0x16,0x82,0x07,0x82,0x02,0x84,0x0c,0x82,0x0f,
-0x82,0x0b,0x82,0x04,0x82,0x05,0x81,0x05,0x82,0x04,0x82,0x0b,0x82,0x05,0x82,
-0x08,0x82,0x06,0x82,0x0b,0x82,0x05,0x8a,0x0e,0x84,0x0f,0x82,0x0b,0x82,0x0b,
-0x82,0x07,0x82,0x05,0x82,0x07,0x82,0x04,0x81,0x02,0x81,0x04,0x81,0x0a,0x83,
-0x0f,0x82,0x01,0x82,0x10,0x81,0x0f,0x82,0x14,0x81,0x14,0x82,0x0a,0x81,0x09,
-0x81,0x38,0x81,0x06,0x83,0x09,0x82,0x07,0x82,0x10,0x82,0x09,0x83,0x05,0x82,
-0x09,0x82,0x0a,0x82,0x0e,0x81,0x08,0x81,0x08,0x83,0x08,0x81,0x0c,0x82,0x14,
-0x82,0x09,0x82,0x05,0x81,0x10,0x82,0x0a,0x82,0x05,0x82,0x06,0x81,0x05,0x83,
-0x08,0x81,0x07,0x82,0x09,0x82,0x05,0x83,0x09,0x82,0x06,0x82,0x09,0x83,0x06,
-0x83,0x10,0x82,0x13,0x82,0x0e,0x82,0x09,0x82,0x07,0x81,0x09,0x81,0x06,0x81,
-0x04,0x81,0x03,0x81,0x04,0x81,0x09,0x81,0x03,0x81,0x0b,0x82,0x08,0x81,0x0f,
-0x82,0x0f,0x82,0x10,0x82,0x11,0x82,0x0c,0x87,0x06,0x81,0x31,0x82,0x21,0x81,
-0x06,0x81,0x0d,0x85,0x0e,0x82,0x35,0x82,0x16,0x82,0x1b,0x8e,0x44,0x82,0x0c,
-0x81,0x0b,0x81,0x0c,0x82,0x13,0x81,0x12,0x82,0x09,0x82,0x07,0x82,0x12,0x82,
-0x07,0x82,0x09,0x82,0x0d,0x82,0x0c,0x82,0x05,0x82,0x0a,0x87,0x02,0x82,0x2c,
-0x82,0x2f,0x82,0x0c,0x82,0x09,0x81,0x03,0x81,0x06,0x82,0x03,0x81,0x06,0x81,
-0x07,0x81,0x07,0x82,0x09,0x82,0x07,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x12,
-0x8c,0x06,0x82,0x06,0x86,0x04,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x84,
-0x02,0x82,0x0c,0x82,0x0f,0x82,0x03,0x81,0x03,0x81,0x03,0x82,0x04,0x82,0x05,
-0x82,0x04,0x82,0x04,0x82,0x0b,0x82,0x05,0x8b,0x07,0x82,0x0b,0x82,0x05,0x88,
-0x13,0x83,0x0d,0x82,0x0b,0x82,0x0b,0x82,0x07,0x82,0x05,0x82,0x07,0x82,0x03,
-0x81,0x03,0x81,0x04,0x81,0x09,0x84,0x10,0x83,0x10,0x82,0x0f,0x82,0x14,0x82,
-0x13,0x82,0x09,0x81,0x0a,0x82,0x37,0x82,0x05,0x82,0x0a,0x82,0x07,0x82,0x10,
-0x82,0x0a,0x82,0x05,0x82,0x0a,0x81,0x0a,0x82,0x0e,0x81,0x08,0x81,0x08,0x82,
-0x09,0x82,0x0b,0x82,0x14,0x82,0x09,0x82,0x03,0x82,0x11,0x82,0x0a,0x82,0x05,
-0x82,0x06,0x82,0x04,0x82,0x09,0x82,0x06,0x82,0x09,0x82,0x05,0x82,0x0a,0x82,
-0x06,0x82,0x0a,0x82,0x06,0x82,0x11,0x83,0x12,0x82,0x0e,0x82,0x09,0x82,0x07,
-0x82,0x07,0x82,0x06,0x81,0x04,0x81,0x03,0x81,0x04,0x81,0x0a,0x81,0x01,0x81,
-0x0c,0x82,0x07,0x82,0x0f,0x81,0x0f,0x82,0x11,0x82,0x12,0x82,0x0a,0x81,0x06,
-0x87,0x32,0x82,0x20,0x82,0x06,0x81,0x0d,0x82,0x03,0x82,0x0c,0x81,0x03,0x81,
-0x03,0x81,0x2e,0x81,0x18,0x81,0x21,0x82,0x20,0x8b,0x1f,0x81,0x0d,0x81,0x0b,
-0x81,0x0c,0x82,0x12,0x81,0x15,0x81,0x08,0x81,0x08,0x82,0x12,0x82,0x07,0x82,
-0x09,0x82,0x0d,0x81,0x0c,0x82,0x07,0x82,0x12,0x82,0x2e,0x82,0x2b,0x82,0x0d,
-0x82,0x0a,0x81,0x03,0x81,0x06,0x82,0x03,0x81,0x05,0x8b,0x06,0x82,0x0b,0x81,
-0x06,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x12,0x82,0x10,0x82,0x0a,0x82,0x04,
-0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x05,0x82,0x0b,0x82,0x0f,0x82,
-0x03,0x81,0x03,0x81,0x03,0x82,0x04,0x82,0x06,0x81,0x04,0x82,0x04,0x82,0x0b,
-0x82,0x05,0x89,0x09,0x82,0x0b,0x82,0x05,0x82,0x05,0x82,0x14,0x82,0x0c,0x82,
-0x0b,0x82,0x0b,0x82,0x08,0x81,0x05,0x81,0x08,0x82,0x03,0x81,0x03,0x81,0x04,
-0x81,0x09,0x81,0x02,0x82,0x0f,0x82,0x10,0x82,0x10,0x82,0x15,0x81,0x13,0x82,
-0x09,0x81,0x0b,0x81,0x36,0x83,0x05,0x82,0x0b,0x81,0x07,0x81,0x11,0x81,0x0b,
-0x82,0x05,0x8d,0x0a,0x82,0x0e,0x82,0x06,0x82,0x08,0x82,0x09,0x82,0x0b,0x82,
-0x14,0x82,0x09,0x82,0x02,0x82,0x12,0x82,0x0a,0x82,0x05,0x82,0x06,0x82,0x04,
-0x82,0x09,0x82,0x06,0x81,0x0b,0x81,0x05,0x82,0x0b,0x81,0x06,0x81,0x0b,0x82,
-0x06,0x82,0x13,0x83,0x10,0x82,0x0e,0x82,0x09,0x82,0x08,0x81,0x07,0x81,0x07,
-0x81,0x04,0x81,0x03,0x81,0x04,0x81,0x0a,0x83,0x0d,0x81,0x07,0x81,0x0f,0x81,
-0x0c,0x84,0x13,0x82,0x14,0x84,0x46,0x82,0x1c,0x91,0x09,0x82,0x03,0x82,0x0c,
-0x81,0x02,0x81,0x05,0x81,0x2d,0x81,0x18,0x81,0x21,0x82,0x20,0x8b,0x1e,0x82,
-0x0d,0x82,0x09,0x82,0x0c,0x82,0x11,0x81,0x16,0x82,0x06,0x81,0x09,0x82,0x13,
-0x81,0x07,0x81,0x0b,0x81,0x0c,0x82,0x0b,0x82,0x09,0x82,0x11,0x82,0x30,0x82,
-0x0c,0x8f,0x0c,0x82,0x0f,0x82,0x0a,0x81,0x03,0x81,0x06,0x82,0x03,0x81,0x05,
-0x8b,0x06,0x82,0x0b,0x82,0x05,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x12,0x82,
-0x10,0x82,0x0a,0x82,0x04,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x06,
-0x82,0x0a,0x82,0x0f,0x82,0x03,0x81,0x03,0x81,0x03,0x82,0x04,0x82,0x06,0x82,
-0x03,0x82,0x04,0x82,0x0b,0x82,0x05,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x06,
-0x81,0x15,0x82,0x0b,0x82,0x0b,0x82,0x0b,0x82,0x08,0x82,0x03,0x82,0x09,0x81,
-0x03,0x81,0x03,0x81,0x04,0x81,0x08,0x82,0x03,0x81,0x0f,0x82,0x10,0x81,0x11,
-0x82,0x15,0x82,0x12,0x82,0x44,0x87,0x02,0x82,0x05,0x82,0x0b,0x81,0x07,0x81,
-0x11,0x81,0x0b,0x82,0x05,0x8e,0x09,0x82,0x0f,0x81,0x06,0x81,0x09,0x82,0x09,
-0x82,0x0b,0x82,0x14,0x82,0x09,0x82,0x01,0x84,0x11,0x82,0x0a,0x82,0x05,0x82,
-0x06,0x82,0x04,0x82,0x09,0x82,0x06,0x81,0x0b,0x81,0x05,0x82,0x0b,0x81,0x06,
-0x81,0x0b,0x82,0x06,0x82,0x15,0x84,0x0d,0x82,0x0e,0x82,0x09,0x82,0x08,0x82,
-0x05,0x82,0x07,0x82,0x03,0x81,0x03,0x81,0x03,0x82,0x0a,0x83,0x0d,0x82,0x05,
-0x82,0x0e,0x81,0x0d,0x84,0x13,0x82,0x14,0x84,0x64,0x91,0x09,0x82,0x04,0x81,
-0x0b,0x81,0x03,0x81,0x05,0x81,0x2d,0x81,0x17,0x82,0x21,0x82,0x49,0x81,0x0e,
-0x82,0x09,0x82,0x0c,0x82,0x10,0x81,0x18,0x81,0x05,0x90,0x10,0x81,0x07,0x81,
-0x0b,0x81,0x0c,0x82,0x0b,0x81,0x0b,0x81,0x11,0x82,0x32,0x82,0x0a,0x8f,0x0a,
-0x82,0x11,0x82,0x0a,0x81,0x03,0x81,0x06,0x82,0x03,0x81,0x05,0x81,0x09,0x81,
-0x06,0x82,0x0b,0x82,0x05,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x12,0x82,0x10,
-0x82,0x0a,0x82,0x04,0x82,0x0b,0x82,0x0a,0x82,0x16,0x82,0x07,0x82,0x06,0x82,
-0x0a,0x82,0x0f,0x82,0x03,0x81,0x03,0x81,0x03,0x82,0x04,0x82,0x07,0x81,0x03,
-0x82,0x04,0x82,0x0b,0x82,0x05,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x06,0x82,
-0x14,0x82,0x0b,0x82,0x0c,0x81,0x0b,0x81,0x09,0x82,0x03,0x82,0x09,0x81,0x03,
-0x81,0x04,0x81,0x02,0x82,0x08,0x81,0x04,0x82,0x0e,0x82,0x0f,0x82,0x11,0x82,
-0x16,0x81,0x12,0x82,0x43,0x82,0x08,0x82,0x05,0x82,0x0b,0x81,0x07,0x81,0x11,
-0x81,0x0b,0x82,0x05,0x81,0x16,0x82,0x10,0x82,0x02,0x82,0x0a,0x82,0x09,0x82,
-0x0b,0x82,0x14,0x82,0x09,0x83,0x03,0x82,0x10,0x82,0x0a,0x82,0x05,0x82,0x06,
-0x82,0x04,0x82,0x09,0x82,0x06,0x81,0x0b,0x81,0x05,0x82,0x0b,0x81,0x06,0x81,
-0x0b,0x82,0x06,0x82,0x18,0x83,0x0b,0x82,0x0e,0x82,0x09,0x82,0x08,0x82,0x05,
-0x82,0x08,0x81,0x03,0x81,0x03,0x81,0x03,0x81,0x0b,0x83,0x0e,0x81,0x05,0x82,
-0x0d,0x81,0x12,0x82,0x11,0x82,0x12,0x82,0x6c,0x81,0x06,0x81,0x0e,0x82,0x04,
-0x81,0x0b,0x81,0x03,0x81,0x05,0x81,0x2d,0x82,0x16,0x82,0x21,0x82,0x49,0x81,
-0x0e,0x82,0x09,0x82,0x0c,0x82,0x0f,0x81,0x19,0x81,0x05,0x90,0x10,0x81,0x07,
-0x81,0x0b,0x81,0x0c,0x81,0x0c,0x81,0x0b,0x81,0x11,0x81,0x35,0x82,0x1f,0x82,
-0x1f,0x81,0x03,0x81,0x05,0x83,0x03,0x81,0x05,0x81,0x09,0x81,0x06,0x82,0x0b,
-0x82,0x05,0x82,0x10,0x82,0x0b,0x82,0x05,0x82,0x12,0x82,0x10,0x82,0x0a,0x82,
-0x04,0x82,0x0b,0x82,0x0a,0x82,0x16,0x81,0x08,0x82,0x07,0x82,0x09,0x82,0x0f,
-0x82,0x0b,0x82,0x04,0x82,0x07,0x82,0x02,0x82,0x04,0x82,0x0b,0x82,0x05,0x82,
-0x10,0x82,0x0b,0x82,0x05,0x82,0x07,0x81,0x15,0x81,0x0b,0x82,0x0c,0x82,0x09,
-0x82,0x0a,0x81,0x03,0x81,0x0a,0x81,0x02,0x81,0x05,0x81,0x02,0x82,0x07,0x82,
-0x05,0x81,0x0e,0x82,0x0e,0x82,0x12,0x82,0x16,0x81,0x12,0x82,0x42,0x82,0x09,
-0x82,0x05,0x82,0x0a,0x82,0x07,0x82,0x10,0x82,0x0a,0x82,0x05,0x82,0x15,0x82,
-0x10,0x81,0x0f,0x82,0x09,0x82,0x0b,0x82,0x14,0x82,0x09,0x82,0x05,0x82,0x0f,
-0x82,0x0a,0x82,0x05,0x82,0x06,0x82,0x04,0x82,0x09,0x82,0x06,0x82,0x09,0x82,
-0x05,0x82,0x0a,0x82,0x06,0x82,0x0a,0x82,0x06,0x82,0x1a,0x82,0x0a,0x82,0x0e,
-0x82,0x09,0x82,0x09,0x81,0x05,0x81,0x09,0x81,0x02,0x81,0x05,0x81,0x02,0x81,
-0x0a,0x82,0x01,0x82,0x0d,0x82,0x04,0x81,0x0d,0x82,0x13,0x82,0x10,0x82,0x11,
-0x82,0x6d,0x81,0x06,0x81,0x0e,0x82,0x03,0x82,0x0a,0x81,0x04,0x81,0x05,0x81,
-0x2d,0x82,0x16,0x82,0x21,0x82,0x48,0x82,0x0e,0x82,0x09,0x82,0x0c,0x82,0x0e,
-0x81,0x1a,0x81,0x10,0x82,0x12,0x82,0x07,0x82,0x0a,0x81,0x0b,0x82,0x0c,0x81,
-0x0b,0x81,0x10,0x82,0x37,0x83,0x19,0x83,0x21,0x81,0x03,0x82,0x04,0x81,0x01,
-0x81,0x08,0x82,0x09,0x82,0x05,0x82,0x0b,0x82,0x06,0x82,0x0f,0x82,0x0a,0x82,
-0x06,0x82,0x12,0x82,0x11,0x81,0x0a,0x82,0x04,0x82,0x0b,0x82,0x0a,0x82,0x15,
-0x82,0x08,0x82,0x08,0x82,0x08,0x82,0x0f,0x82,0x04,0x81,0x01,0x81,0x04,0x82,
-0x04,0x82,0x08,0x81,0x02,0x82,0x04,0x82,0x0b,0x81,0x06,0x82,0x10,0x82,0x0b,
-0x81,0x06,0x82,0x07,0x82,0x14,0x81,0x0b,0x82,0x0c,0x82,0x09,0x82,0x0a,0x81,
-0x03,0x81,0x0a,0x81,0x02,0x81,0x05,0x81,0x02,0x81,0x08,0x81,0x06,0x82,0x0d,
-0x82,0x0e,0x81,0x13,0x82,0x16,0x82,0x11,0x82,0x42,0x81,0x0a,0x82,0x05,0x83,
-0x09,0x82,0x07,0x82,0x10,0x82,0x09,0x83,0x05,0x82,0x15,0x82,0x0f,0x81,0x10,
-0x82,0x09,0x82,0x0b,0x82,0x14,0x82,0x09,0x82,0x06,0x82,0x0e,0x82,0x0a,0x82,
-0x05,0x82,0x06,0x82,0x04,0x82,0x09,0x82,0x06,0x82,0x09,0x82,0x05,0x83,0x09,
-0x82,0x06,0x82,0x09,0x83,0x06,0x82,0x1b,0x81,0x0a,0x82,0x0f,0x81,0x08,0x83,
-0x09,0x82,0x03,0x82,0x09,0x81,0x02,0x81,0x05,0x81,0x02,0x81,0x0a,0x81,0x03,
-0x81,0x0e,0x81,0x03,0x82,0x0d,0x81,0x14,0x82,0x10,0x82,0x11,0x82,0x6c,0x82,
-0x05,0x82,0x09,0x82,0x03,0x82,0x02,0x82,0x0b,0x81,0x04,0x81,0x05,0x81,0x2d,
-0x82,0x16,0x82,0x21,0x82,0x48,0x81,0x10,0x81,0x09,0x81,0x0d,0x82,0x0d,0x81,
-0x1a,0x82,0x10,0x82,0x12,0x82,0x08,0x81,0x09,0x82,0x0b,0x81,0x0d,0x81,0x0b,
-0x81,0x10,0x82,0x39,0x82,0x17,0x82,0x23,0x81,0x04,0x85,0x03,0x83,0x05,0x82,
-0x09,0x82,0x05,0x82,0x0b,0x82,0x06,0x82,0x0f,0x82,0x09,0x82,0x07,0x82,0x12,
-0x82,0x11,0x82,0x09,0x82,0x04,0x82,0x0b,0x82,0x0a,0x82,0x15,0x82,0x08,0x82,
-0x08,0x82,0x08,0x82,0x0f,0x82,0x04,0x81,0x01,0x81,0x04,0x82,0x04,0x82,0x08,
-0x82,0x01,0x82,0x05,0x82,0x09,0x82,0x06,0x82,0x11,0x82,0x09,0x82,0x06,0x82,
-0x08,0x82,0x12,0x82,0x0b,0x82,0x0c,0x82,0x09,0x82,0x0a,0x82,0x01,0x82,0x0a,
-0x81,0x02,0x81,0x06,0x81,0x01,0x81,0x07,0x82,0x07,0x82,0x0c,0x82,0x0d,0x82,
-0x13,0x82,0x17,0x81,0x11,0x82,0x42,0x81,0x09,0x83,0x05,0x83,0x09,0x82,0x07,
-0x82,0x10,0x82,0x09,0x83,0x05,0x82,0x15,0x82,0x0f,0x81,0x10,0x82,0x09,0x82,
-0x0b,0x82,0x14,0x82,0x09,0x82,0x07,0x81,0x0e,0x82,0x0a,0x82,0x05,0x82,0x06,
-0x82,0x04,0x82,0x09,0x82,0x06,0x82,0x09,0x82,0x05,0x83,0x09,0x82,0x06,0x82,
-0x09,0x83,0x06,0x82,0x1b,0x81,0x0b,0x81,0x0f,0x81,0x08,0x83,0x0a,0x81,0x03,
-0x81,0x0a,0x81,0x02,0x81,0x05,0x81,0x02,0x81,0x09,0x81,0x05,0x81,0x0d,0x81,
-0x03,0x81,0x0d,0x81,0x15,0x82,0x10,0x82,0x11,0x82,0x4b,0x82,0x1f,0x81,0x06,
-0x81,0x0b,0x89,0x0b,0x81,0x05,0x81,0x05,0x81,0x2d,0x82,0x16,0x82,0x35,0x82,
-0x23,0x83,0x0d,0x82,0x10,0x82,0x07,0x82,0x0d,0x82,0x0c,0x81,0x1b,0x82,0x10,
-0x82,0x12,0x81,0x09,0x82,0x08,0x81,0x0b,0x82,0x0d,0x82,0x09,0x82,0x0f,0x82,
-0x21,0x82,0x49,0x82,0x0b,0x81,0x13,0x81,0x0b,0x81,0x05,0x82,0x0b,0x82,0x07,
-0x82,0x0e,0x82,0x08,0x83,0x07,0x82,0x12,0x82,0x12,0x82,0x08,0x82,0x04,0x82,
-0x0b,0x82,0x0a,0x82,0x14,0x82,0x09,0x82,0x09,0x82,0x07,0x82,0x0f,0x82,0x04,
-0x83,0x04,0x82,0x04,0x82,0x09,0x84,0x05,0x83,0x07,0x82,0x07,0x82,0x11,0x83,
-0x07,0x82,0x07,0x82,0x08,0x82,0x12,0x82,0x0b,0x82,0x0d,0x82,0x07,0x82,0x0c,
-0x81,0x01,0x81,0x0b,0x81,0x02,0x81,0x06,0x81,0x01,0x81,0x07,0x81,0x08,0x82,
-0x0c,0x82,0x0d,0x81,0x14,0x82,0x17,0x82,0x10,0x82,0x42,0x82,0x08,0x83,0x05,
-0x83,0x08,0x82,0x09,0x82,0x10,0x82,0x08,0x83,0x06,0x82,0x14,0x82,0x0f,0x81,
-0x10,0x82,0x09,0x82,0x0b,0x82,0x14,0x82,0x09,0x82,0x08,0x81,0x0d,0x82,0x0a,
-0x82,0x05,0x82,0x06,0x82,0x04,0x82,0x09,0x82,0x07,0x82,0x07,0x82,0x06,0x83,
-0x08,0x82,0x08,0x82,0x08,0x83,0x06,0x82,0x1b,0x81,0x0b,0x82,0x0e,0x82,0x07,
-0x83,0x0a,0x81,0x03,0x81,0x0a,0x81,0x02,0x81,0x05,0x81,0x02,0x81,0x08,0x82,
-0x05,0x82,0x0c,0x82,0x01,0x82,0x0c,0x81,0x16,0x82,0x10,0x82,0x11,0x82,0x4b,
-0x82,0x1f,0x81,0x06,0x81,0x0f,0x82,0x0e,0x81,0x05,0x81,0x05,0x81,0x2e,0x81,
-0x16,0x81,0x36,0x82,0x23,0x83,0x0d,0x81,0x12,0x82,0x05,0x82,0x0e,0x82,0x0b,
-0x82,0x10,0x82,0x07,0x83,0x11,0x82,0x08,0x81,0x07,0x83,0x0a,0x82,0x06,0x82,
-0x0b,0x81,0x0f,0x82,0x07,0x82,0x0f,0x82,0x0f,0x82,0x11,0x82,0x49,0x82,0x0b,
-0x81,0x12,0x82,0x0b,0x82,0x04,0x82,0x09,0x83,0x09,0x83,0x07,0x81,0x04,0x82,
-0x06,0x84,0x08,0x82,0x12,0x82,0x13,0x82,0x06,0x83,0x04,0x82,0x0b,0x82,0x0a,
-0x82,0x0b,0x81,0x07,0x82,0x0a,0x82,0x0a,0x82,0x06,0x82,0x0f,0x82,0x04,0x83,
-0x04,0x82,0x04,0x82,0x09,0x84,0x06,0x83,0x05,0x83,0x07,0x82,0x12,0x83,0x05,
-0x82,0x08,0x82,0x09,0x82,0x06,0x82,0x07,0x83,0x0c,0x82,0x0d,0x83,0x05,0x83,
-0x0c,0x83,0x0b,0x83,0x07,0x83,0x06,0x82,0x09,0x82,0x0b,0x82,0x0c,0x82,0x14,
-0x82,0x18,0x81,0x10,0x82,0x42,0x82,0x09,0x82,0x05,0x82,0x02,0x81,0x05,0x82,
-0x0b,0x82,0x07,0x81,0x07,0x83,0x08,0x82,0x07,0x82,0x07,0x82,0x0a,0x82,0x0f,
-0x87,0x0a,0x82,0x09,0x82,0x0b,0x82,0x14,0x82,0x09,0x82,0x08,0x82,0x0c,0x82,
-0x0a,0x82,0x05,0x82,0x06,0x82,0x04,0x82,0x09,0x82,0x08,0x82,0x05,0x82,0x07,
-0x82,0x02,0x81,0x05,0x82,0x09,0x83,0x08,0x82,0x06,0x82,0x10,0x82,0x08,0x82,
-0x0b,0x82,0x0e,0x83,0x07,0x82,0x0a,0x82,0x01,0x82,0x13,0x81,0x0a,0x82,0x07,
-0x82,0x0c,0x81,0x01,0x82,0x0b,0x82,0x16,0x82,0x10,0x82,0x11,0x82,0x4b,0x82,
-0x1f,0x81,0x06,0x81,0x0f,0x82,0x0d,0x81,0x07,0x81,0x03,0x81,0x2f,0x82,0x14,
-0x82,0x36,0x82,0x23,0x83,0x0c,0x82,0x13,0x87,0x0f,0x82,0x0a,0x8f,0x05,0x89,
-0x13,0x82,0x09,0x88,0x0d,0x87,0x0c,0x82,0x10,0x89,0x09,0x87,0x11,0x82,0x10,
-0x83,0x49,0x82,0x0c,0x81,0x11,0x82,0x0b,0x82,0x04,0x8c,0x0c,0x8a,0x04,0x8a,
-0x0a,0x8d,0x07,0x82,0x14,0x89,0x05,0x82,0x0b,0x82,0x07,0x89,0x07,0x89,0x0b,
-0x82,0x0a,0x82,0x06,0x8c,0x05,0x82,0x05,0x81,0x05,0x82,0x04,0x82,0x0a,0x83,
-0x08,0x87,0x09,0x82,0x14,0x87,0x09,0x82,0x0a,0x82,0x06,0x8a,0x0d,0x82,0x0f,
-0x87,0x0e,0x83,0x0c,0x82,0x08,0x82,0x06,0x81,0x0b,0x81,0x0b,0x82,0x0b,0x8f,
-0x08,0x82,0x18,0x82,0x0f,0x82,0x43,0x87,0x03,0x82,0x05,0x82,0x03,0x86,0x0d,
-0x89,0x09,0x86,0x03,0x82,0x08,0x89,0x0b,0x82,0x10,0x89,0x07,0x82,0x09,0x82,
-0x07,0x8b,0x0f,0x82,0x09,0x82,0x09,0x82,0x07,0x8b,0x05,0x82,0x05,0x82,0x06,
-0x82,0x04,0x82,0x09,0x82,0x09,0x87,0x08,0x82,0x03,0x86,0x0c,0x86,0x03,0x82,
-0x06,0x82,0x11,0x89,0x0e,0x88,0x08,0x86,0x03,0x82,0x0b,0x81,0x01,0x81,0x0c,
-0x82,0x07,0x82,0x08,0x81,0x09,0x81,0x0c,0x83,0x0b,0x8d,0x0c,0x82,0x10,0x82,
-0x11,0x82,0x6c,0x81,0x06,0x81,0x0f,0x82,0x0d,0x81,0x3c,0x81,0x14,0x81,0x36,
-0x83,0x32,0x81,0x2a,0x82,0x0a,0x8f,0x21,0x82,0x31,0x82,0x4c,0x82,0x58,0x82,
-0x10,0x82,0x0b,0x82,0x04,0x88,0x1e,0x85,0x0f,0x8d,0x07,0x82,0x22,0x82,0x0b,
-0x82,0x06,0x8b,0x1a,0x82,0x0b,0x82,0x05,0x8c,0x05,0x82,0x05,0x81,0x05,0x82,
-0x04,0x82,0x0a,0x83,0x18,0x82,0x19,0x82,0x09,0x82,0x0a,0x82,0x1d,0x82,0x25,
-0x82,0x0c,0x82,0x08,0x82,0x05,0x82,0x0b,0x82,0x0a,0x82,0x0b,0x8f,0x08,0x82,
-0x19,0x81,0x0f,0x82,0x4d,0x82,0x05,0x82,0x31,0x82,0x1c,0x82,0x0f,0x81,0x08,
-0x82,0x06,0x82,0x09,0x82,0x06,0x8d,0x0e,0x82,0x09,0x82,0x0a,0x82,0x05,0x8d,
-0x04,0x82,0x05,0x82,0x06,0x82,0x04,0x82,0x09,0x82,0x18,0x82,0x1e,0x82,0x06,
-0x82,0x41,0x82,0x0b,0x83,0x0c,0x82,0x07,0x82,0x07,0x82,0x09,0x82,0x0c,0x82,
-0x0b,0x8d,0x0c,0x82,0x10,0x82,0x11,0x82,0x7f,0x04,0x82,0x4a,0x82,0x12,0x82,
-0x36,0x82,0x7f,0x7f,0x1d,0x82,0x59,0x82,0x7f,0x7f,0x4b,0x82,0x7f,0x37,0x82,
-0x29,0x82,0x7f,0x35,0x82,0x0a,0x81,0x34,0x82,0x67,0x82,0x1e,0x82,0x7f,0x11,
-0x81,0x26,0x81,0x10,0x82,0x11,0x81,0x7f,0x52,0x81,0x12,0x81,0x37,0x82,0x7f,
-0x7f,0x1d,0x82,0x5b,0x89,0x7f,0x7f,0x42,0x82,0x7f,0x37,0x82,0x29,0x82,0x7f,
-0x35,0x81,0x0b,0x81,0x34,0x82,0x67,0x82,0x1e,0x82,0x7f,0x10,0x82,0x26,0x82,
-0x0f,0x82,0x10,0x82,0x7f,0x53,0x81,0x10,0x81,0x38,0x82,0x7f,0x7f,0x1d,0x81,
-0x7f,0x7f,0x7f,0x29,0x82,0x7f,0x36,0x82,0x29,0x82,0x7f,0x35,0x81,0x0b,0x81,
-0x34,0x81,0x68,0x82,0x1e,0x82,0x7f,0x10,0x82,0x26,0x82,0x0f,0x82,0x10,0x82,
-0x7f,0x53,0x82,0x0e,0x82,0x38,0x81,0x7f,0x7f,0x1e,0x81,0x7f,0x7f,0x7f,0x2a,
-0x82,0x7f,0x35,0x88,0x1d,0x88,0x19,0x93,0x7f,0x09,0x81,0x0b,0x81,0x34,0x81,
-0x68,0x82,0x1e,0x82,0x7f,0x0f,0x82,0x28,0x84,0x0c,0x82,0x0d,0x84,0x7f,0x55,
-0x82,0x0c,0x82,0x39,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x4a,0x82,0x7f,0x34,0x88,
-0x1d,0x88,0x19,0x93,0x7f,0x09,0x81,0x0a,0x82,0x33,0x82,0x68,0x82,0x1e,0x82,
-0x7f,0x0f,0x82,0x38,0x82,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,
-0x7f,0x15,0x82,0x08,0x82,0x33,0x82,0x69,0x82,0x1e,0x82,0x7f,0x0e,0x82,0x39,
-0x82,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x17,0x89,0x2d,
-0x88,0x6a,0x82,0x1e,0x82,0x7f,0x09,0x86,0x3a,0x82,0x7f,0x7f,0x7f,0x7f,0x7f,
-0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x40,0x82,0x1e,0x82,0x7f,0x49,0x82,0x42,
-0x00,
+  .glyphs = {
+    {  0,  0,  0,  0,     0 }, /* ' ' */
+    {  9,  0,  2, 22,     0 }, /* '!' */
+    {  5,  0,  9,  9,    22 }, /* '"' */
+    {  1,  0, 18, 23,    40 }, /* '#' */
+    {  3,  0, 12, 24,   109 }, /* '$' */
+    {  1,  0, 17, 23,   157 }, /* '%' */
+    {  3,  0, 13, 12,   226 }, /* '&' */
+    {  9,  0,  2,  9,   250 }, /* ''' */
+    {  6,  0,  7, 28,   259 }, /* '(' */
+    {  6,  0,  7, 28,   287 }, /* ')' */
+    {  3,  0, 13, 12,   315 }, /* '*' */
+    {  2,  5, 14, 14,   339 }, /* '+' */
+    {  8, 19,  3,  9,   367 }, /* ',' */
+    {  4, 13, 11,  2,   376 }, /* '-' */
+    {  8, 19,  3,  3,   380 }, /* '.' */
+    {  4,  0, 11, 23,   383 }, /* '/' */
+    {  2,  1, 14, 21,   429 }, /* '0' */
+    {  4,  0,  7, 23,   471 }, /* '1' */
+    {  2,  1, 15, 22,   494 }, /* '2' */
+    {  2,  1, 13, 21,   538 }, /* '3' */
+    {  1,  0, 16, 23,   580 }, /* '4' */
+    {  3,  0, 12, 22,   626 }, /* '5' */
+    {  3,  1, 13, 21,   670 }, /* '6' */
+    {  2,  0, 15, 23,   712 }, /* '7' */
+    {  3,  1, 13, 21,   758 }, /* '8' */
+    {  3,  1, 13, 21,   800 }, /* '9' */
+    {  9,  7,  2, 15,   842 }, /* ':' */
+    {  8,  7,  3, 20,   857 }, /* ';' */
+    {  3,  5, 14, 14,   877 }, /* '<' */
+    {  2,  7, 15,  9,   905 }, /* '=' */
+    {  2,  5, 14, 14,   923 }, /* '>' */
+    {  4,  1, 11, 21,   951 }, /* '?' */
+    {  1,  1, 17, 24,   993 }, /* '@' */
+    {  2,  0, 15, 23,  1065 }, /* 'A' */
+    {  2,  0, 15, 23,  1111 }, /* 'B' */
+    {  3,  1, 14, 21,  1157 }, /* 'C' */
+    {  2,  0, 15, 23,  1199 }, /* 'D' */
+    {  3,  0, 13, 23,  1245 }, /* 'E' */
+    {  4,  0, 13, 23,  1291 }, /* 'F' */
+    {  3,  1, 14, 21,  1337 }, /* 'G' */
+    {  2,  0, 15, 23,  1379 }, /* 'H' */
+    {  4,  0, 11, 23,  1425 }, /* 'I' */
+    {  2,  0, 13, 22,  1471 }, /* 'J' */
+    {  3,  0, 15, 23,  1515 }, /* 'K' */
+    {  4,  0, 12, 23,  1561 }, /* 'L' */
+    {  2,  0, 15, 23,  1607 }, /* 'M' */
+    {  2,  0, 15, 23,  1653 }, /* 'N' */
+    {  2,  1, 15, 21,  1699 }, /* 'O' */
+    {  3,  0, 13, 23,  1741 }, /* 'P' */
+    {  2,  1, 15, 27,  1787 }, /* 'Q' */
+    {  3,  0, 14, 23,  1841 }, /* 'R' */
+    {  3,  1, 13, 21,  1887 }, /* 'S' */
+    {  1,  0, 16, 23,  1929 }, /* 'T' */
+    {  2,  0, 15, 22,  1975 }, /* 'U' */
+    {  2,  0, 15, 23,  2019 }, /* 'V' */
+    {  1,  0, 17, 23,  2065 }, /* 'W' */
+    {  2,  0, 15, 23,  2134 }, /* 'X' */
+    {  1,  0, 17, 23,  2180 }, /* 'Y' */
+    {  2,  0, 15, 23,  2249 }, /* 'Z' */
+    {  6,  0,  8, 28,  2295 }, /* '[' */
+    {  4,  0, 11, 23,  2323 }, /* '\' */
+    {  5,  0,  8, 28,  2369 }, /* ']' */
+    {  3,  1, 13, 13,  2397 }, /* '^' */
+    {  0, 26, 19,  2,  2423 }, /* '_' */
+    {  8,  0,  3,  3,  2429 }, /* '`' */
+    {  3,  7, 13, 16,  2432 }, /* 'a' */
+    {  2,  0, 14, 23,  2464 }, /* 'b' */
+    {  4,  7, 12, 15,  2510 }, /* 'c' */
+    {  3,  0, 14, 23,  2540 }, /* 'd' */
+    {  3,  7, 14, 15,  2586 }, /* 'e' */
+    {  2,  0, 14, 23,  2616 }, /* 'f' */
+    {  3,  6, 14, 24,  2662 }, /* 'g' */
+    {  3,  0, 13, 23,  2710 }, /* 'h' */
+    {  3,  0, 13, 23,  2756 }, /* 'i' */
+    {  2,  0, 11, 30,  2802 }, /* 'j' */
+    {  3,  0, 14, 23,  2862 }, /* 'k' */
+    {  3,  0, 13, 23,  2908 }, /* 'l' */
+    {  1,  6, 17, 17,  2954 }, /* 'm' */
+    {  3,  6, 13, 17,  3005 }, /* 'n' */
+    {  3,  7, 13, 15,  3039 }, /* 'o' */
+    {  2,  6, 14, 25,  3069 }, /* 'p' */
+    {  3,  6, 14, 25,  3119 }, /* 'q' */
+    {  4,  6, 11, 17,  3169 }, /* 'r' */
+    {  3,  7, 12, 15,  3203 }, /* 's' */
+    {  2,  3, 14, 19,  3233 }, /* 't' */
+    {  3,  6, 13, 17,  3271 }, /* 'u' */
+    {  2,  6, 15, 17,  3305 }, /* 'v' */
+    {  1,  6, 17, 17,  3339 }, /* 'w' */
+    {  3,  6, 13, 17,  3390 }, /* 'x' */
+    {  1,  6, 16, 24,  3424 }, /* 'y' */
+    {  3,  6, 13, 17,  3472 }, /* 'z' */
+    {  4,  1, 11, 26,  3506 }, /* '{' */
+    {  8,  0,  2, 31,  3558 }, /* '|' */
+    {  4,  1, 11, 26,  3589 }, /* '}' */
+    {  2, 11, 15,  2,  3641 }, /* '~' */
+    {  0,  0,  0,  0,  3645 }, /* 0x7f */
+  },
+  .bits = {
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,
+0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0x01,0x02,0x00,0x01,0x02,
+0x00,0x01,0x02,0x00,0x01,0x02,0x00,0x03,0x06,0x00,0x02,0x04,0x00,0x02,0x04,
+0x00,0x7f,0xff,0xc0,0x7f,0xff,0xc0,0x06,0x0c,0x00,0x04,0x08,0x00,0x04,0x08,
+0x00,0x04,0x08,0x00,0x0c,0x08,0x00,0xff,0xff,0x80,0xff,0xff,0x80,0x08,0x10,
+0x00,0x08,0x10,0x00,0x18,0x30,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,
+0x00,0x10,0x20,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x3f,0xf0,0x66,0x00,0x46,
+0x00,0x46,0x00,0x46,0x00,0x66,0x00,0x66,0x00,0x1e,0x00,0x07,0x00,0x07,0xc0,
+0x06,0x30,0x06,0x30,0x06,0x10,0x06,0x10,0x06,0x30,0xc6,0x60,0x7f,0xc0,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x04,0x00,0x44,0x04,0x00,0x82,0x08,
+0x00,0x82,0x08,0x00,0x82,0x10,0x00,0x82,0x10,0x00,0x82,0x20,0x00,0x82,0x20,
+0x00,0x82,0x40,0x00,0x44,0x40,0x00,0x00,0xc0,0x00,0x00,0x80,0x00,0x01,0x80,
+0x00,0x01,0x11,0x00,0x01,0x20,0x80,0x02,0x20,0x80,0x02,0x20,0x80,0x04,0x20,
+0x80,0x04,0x20,0x80,0x08,0x20,0x80,0x08,0x20,0x80,0x10,0x11,0x00,0x10,0x00,
+0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xc2,0x18,0xff,0xf8,0x07,0x00,
+0x05,0x00,0x08,0x80,0x08,0xc0,0x18,0x40,0x30,0x60,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0x06,0x0c,0x08,0x10,0x30,0x20,0x60,0x40,0xc0,0xc0,0xc0,
+0xc0,0xc0,0x80,0x80,0x80,0xc0,0xc0,0xc0,0xc0,0x40,0x60,0x20,0x30,0x10,0x08,
+0x0c,0x06,0xc0,0x60,0x20,0x10,0x18,0x08,0x0c,0x04,0x06,0x06,0x06,0x06,0x06,
+0x02,0x02,0x06,0x06,0x06,0x06,0x06,0x04,0x0c,0x08,0x18,0x10,0x20,0x60,0xc0,
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xc2,0x18,0xff,0xf8,0x07,0x00,0x05,
+0x00,0x08,0x80,0x08,0xc0,0x18,0x40,0x30,0x60,0x03,0x00,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x03,0x00,0xff,0xfc,0xff,0xfc,0x03,0x00,0x03,0x00,0x03,
+0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x60,0x60,0x60,0xe0,0xc0,0xc0,0xc0,0x80,
+0x80,0xff,0xe0,0xff,0xe0,0xe0,0xe0,0xe0,0x00,0x20,0x00,0x60,0x00,0x40,0x00,
+0xc0,0x00,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x03,0x00,0x02,0x00,0x06,0x00,
+0x04,0x00,0x0c,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x20,
+0x00,0x60,0x00,0x40,0x00,0xc0,0x00,0x80,0x00,0x0f,0xe0,0x18,0x30,0x30,0x18,
+0x20,0x08,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x40,0x04,0x40,0x04,0xc0,
+0x04,0x40,0x04,0x40,0x04,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x60,0x0c,0x20,0x08,
+0x30,0x18,0x18,0x30,0x0f,0xe0,0x02,0x06,0x1e,0x32,0x62,0x82,0x02,0x02,0x06,
+0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x1f,
+0xe0,0x70,0x30,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x18,
+0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x00,0x02,0x00,0x04,
+0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x60,0x00,0xff,0xfe,0xff,0xfe,0x1f,0xc0,
+0x60,0x60,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x10,0x00,0x30,0x00,0x20,0x00,
+0x40,0x1f,0x00,0x1f,0x00,0x00,0x60,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x08,
+0x00,0x08,0x00,0x18,0x00,0x18,0xc0,0x70,0x7f,0xc0,0x00,0x38,0x00,0x38,0x00,
+0x58,0x00,0x98,0x00,0x98,0x01,0x18,0x03,0x18,0x02,0x18,0x04,0x18,0x0c,0x18,
+0x08,0x18,0x10,0x18,0x30,0x18,0x20,0x18,0x40,0x18,0xff,0xff,0xff,0xff,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x7f,0xe0,0x7f,0xe0,
+0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
+0x00,0x7f,0xc0,0x00,0xe0,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x10,0x00,0x10,
+0x00,0x30,0x00,0x30,0x00,0x20,0x80,0xe0,0x7f,0x80,0x07,0xf0,0x1c,0x00,0x30,
+0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xcf,0xe0,
+0x90,0x30,0xc0,0x18,0xc0,0x18,0x80,0x08,0x80,0x08,0x80,0x08,0xc0,0x08,0x40,
+0x18,0x60,0x10,0x30,0x30,0x1f,0xc0,0xff,0xfe,0xff,0xfe,0x00,0x04,0x00,0x0c,
+0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,
+0x40,0x00,0xc0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x02,0x00,
+0x06,0x00,0x04,0x00,0x0c,0x00,0x0c,0x00,0x1f,0xc0,0x30,0x60,0x60,0x30,0x40,
+0x10,0x40,0x10,0x40,0x10,0x60,0x30,0x20,0x20,0x18,0xc0,0x0f,0x80,0x0f,0x80,
+0x30,0x60,0x60,0x30,0xc0,0x18,0x80,0x08,0x80,0x08,0x80,0x08,0x80,0x08,0xc0,
+0x18,0x60,0x30,0x3f,0xe0,0x1f,0xc0,0x60,0x60,0x40,0x30,0xc0,0x10,0x80,0x18,
+0x80,0x08,0x80,0x08,0x80,0x08,0xc0,0x18,0xc0,0x18,0x60,0x48,0x3f,0x98,0x00,
+0x18,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0xc0,
+0x7f,0x00,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xc0,0xc0,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,
+0x60,0xe0,0xc0,0xc0,0xc0,0x80,0x80,0x00,0x0c,0x00,0x38,0x00,0xc0,0x03,0x00,
+0x0c,0x00,0x30,0x00,0xc0,0x00,0xc0,0x00,0x30,0x00,0x0c,0x00,0x03,0x00,0x00,
+0xc0,0x00,0x38,0x00,0x0c,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xc0,0x00,0x70,0x00,0x0c,0x00,0x03,
+0x00,0x00,0xc0,0x00,0x30,0x00,0x0c,0x00,0x0c,0x00,0x30,0x00,0xc0,0x03,0x00,
+0x0c,0x00,0x70,0x00,0xc0,0x00,0x7f,0x80,0xc0,0xc0,0x00,0x60,0x00,0x20,0x00,
+0x20,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0xc0,0x01,0x80,0x03,0x00,0x06,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x07,0xf8,0x00,0x08,0x04,0x00,0x10,0x02,0x00,0x20,0x01,0x00,
+0x40,0x01,0x00,0x40,0x00,0x80,0xc3,0xf8,0x80,0x84,0x18,0x80,0x84,0x18,0x80,
+0x88,0x18,0x80,0x88,0x18,0x80,0x88,0x18,0x80,0x88,0x18,0x80,0x88,0x18,0x80,
+0x88,0x18,0x80,0x88,0x38,0x80,0x8c,0x28,0x00,0x87,0xc7,0x00,0x40,0x00,0x00,
+0x40,0x00,0x00,0x20,0x00,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x07,0xfc,0x00,
+0x03,0x80,0x03,0x80,0x03,0x80,0x02,0xc0,0x06,0xc0,0x04,0x40,0x04,0x40,0x0c,
+0x60,0x08,0x20,0x08,0x20,0x18,0x30,0x18,0x30,0x10,0x10,0x3f,0xf8,0x3f,0xf8,
+0x20,0x08,0x20,0x08,0x60,0x0c,0x60,0x0c,0x40,0x04,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xfe,0x00,0xff,0xf0,0xc0,0x38,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,0xc0,0x0c,
+0xc0,0x0c,0xc0,0x0c,0xc0,0x18,0xff,0xc0,0xff,0xc0,0xc0,0x18,0xc0,0x04,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x1c,0xff,0xf0,
+0xff,0x00,0x07,0xfc,0x1c,0x0c,0x38,0x00,0x70,0x00,0x60,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x1c,0x04,0x0f,0xfc,0xf8,
+0x00,0xff,0xc0,0xc0,0x70,0xc0,0x18,0xc0,0x0c,0xc0,0x0c,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x0c,0xc0,0x18,0xc0,0x38,0xc0,0xf0,0xff,0xc0,0xf8,0x00,
+0xff,0xf8,0xff,0xf8,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xff,0xf0,0xff,0xf0,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xff,0xf8,0xff,
+0xf8,0xff,0xf8,0xff,0xf8,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xff,0xf0,0xff,0xf0,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0x0f,0xf8,0x1c,0x10,0x30,0x00,0x60,0x00,0x60,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0xfc,0xc0,0xfc,0xc0,0x0c,0xc0,0x0c,
+0xc0,0x0c,0xc0,0x0c,0x40,0x0c,0x60,0x0c,0x30,0x0c,0x18,0x1c,0x0f,0xf8,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xff,0xfe,0xff,0xfe,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xff,0xe0,0x7f,0xc0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x7f,0xc0,0xff,
+0xe0,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x60,0x80,0xc0,0xff,0x80,
+0xc0,0x06,0xc0,0x0c,0xc0,0x18,0xc0,0x30,0xc0,0x20,0xc0,0x40,0xc0,0xc0,0xc1,
+0x80,0xc3,0x00,0xc6,0x00,0xce,0x00,0xcf,0x00,0xf3,0x00,0xc1,0x80,0xc0,0xc0,
+0xc0,0xc0,0xc0,0x60,0xc0,0x30,0xc0,0x30,0xc0,0x18,0xc0,0x0c,0xc0,0x0c,0xc0,
+0x06,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xff,0xf0,
+0xff,0xf0,0xe0,0x0e,0xe0,0x1e,0xd0,0x1e,0xd0,0x16,0xd0,0x16,0xd0,0x16,0xc0,
+0x26,0xc8,0x26,0xc8,0x26,0xc8,0x26,0xc8,0x26,0xc0,0x06,0xc4,0x46,0xc4,0x46,
+0xc4,0x46,0xc4,0x46,0xc0,0x06,0xc2,0x86,0xc2,0x86,0xc3,0x86,0xc3,0x86,0xc1,
+0x06,0xc1,0x06,0xe0,0x06,0xe0,0x06,0xf0,0x06,0xd0,0x06,0xd8,0x06,0xc8,0x06,
+0xcc,0x06,0xc4,0x06,0xc6,0x06,0xc2,0x06,0xc3,0x06,0xc1,0x06,0xc1,0x86,0xc0,
+0x86,0xc0,0xc6,0xc0,0x46,0xc0,0x66,0xc0,0x26,0xc0,0x36,0xc0,0x1e,0xc0,0x1e,
+0xc0,0x0e,0xc0,0x0e,0x0f,0xe0,0x38,0x38,0x70,0x18,0x60,0x0c,0xc0,0x04,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x04,0x60,0x0c,0x70,0x18,0x38,0x38,0x0f,
+0xe0,0xfc,0x00,0xff,0xe0,0xc0,0x70,0xc0,0x38,0xc0,0x18,0xc0,0x18,0xc0,0x18,
+0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x30,0xff,0xe0,0xff,0x80,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0x0f,0xe0,0x38,0x30,0x70,0x18,0x60,0x0c,0xc0,0x04,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x04,0x60,0x0c,0x70,0x18,0x38,0x30,0x0f,0xe0,0x00,
+0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x0c,0x00,0x06,0xf8,0x00,0xff,0xc0,
+0xc0,0xe0,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,
+0x30,0xc0,0x60,0xff,0xc0,0xff,0x00,0xc1,0x80,0xc0,0x80,0xc0,0xc0,0xc0,0x40,
+0xc0,0x60,0xc0,0x30,0xc0,0x30,0xc0,0x18,0xc0,0x0c,0xc0,0x0c,0x1f,0xf8,0x30,
+0x18,0x60,0x00,0x60,0x00,0x40,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x38,0x00,
+0x1e,0x00,0x07,0x80,0x00,0xe0,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x08,0x00,
+0x08,0x00,0x18,0x00,0x18,0xc0,0x70,0x7f,0xe0,0xff,0xff,0xff,0xff,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x06,0xc0,0x06,0xc0,
+0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0xc0,0x06,0x40,0x04,0x60,0x0c,0x60,
+0x0c,0x60,0x0c,0x30,0x18,0x38,0x38,0x0f,0xe0,0xc0,0x06,0xc0,0x06,0xc0,0x06,
+0x40,0x0c,0x60,0x0c,0x60,0x0c,0x20,0x08,0x30,0x18,0x30,0x18,0x10,0x10,0x10,
+0x10,0x18,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,0x0c,0x60,0x04,0x40,0x04,0x40,
+0x06,0xc0,0x02,0x80,0x03,0x80,0x03,0x80,0x01,0x80,0x80,0x00,0x80,0x80,0x00,
+0x80,0x80,0x00,0x80,0xc0,0x00,0x80,0xc0,0x01,0x80,0xc0,0x01,0x80,0xc0,0x01,
+0x80,0x40,0x81,0x80,0x41,0xc1,0x00,0x41,0x41,0x00,0x61,0x41,0x00,0x61,0x21,
+0x00,0x62,0x21,0x00,0x62,0x21,0x00,0x22,0x21,0x00,0x22,0x13,0x00,0x24,0x13,
+0x00,0x24,0x12,0x00,0x24,0x0a,0x00,0x24,0x0a,0x00,0x38,0x0e,0x00,0x18,0x06,
+0x00,0x18,0x06,0x00,0xc0,0x0c,0x40,0x08,0x60,0x18,0x20,0x10,0x30,0x30,0x18,
+0x20,0x08,0x60,0x0c,0x40,0x04,0xc0,0x07,0x80,0x03,0x00,0x03,0x80,0x07,0x80,
+0x04,0xc0,0x0c,0x40,0x08,0x60,0x18,0x20,0x10,0x30,0x30,0x18,0x20,0x18,0x60,
+0x0c,0x40,0x04,0xc0,0x06,0xc0,0x01,0x80,0x40,0x01,0x00,0x60,0x03,0x00,0x20,
+0x02,0x00,0x30,0x06,0x00,0x10,0x04,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x04,
+0x10,0x00,0x06,0x30,0x00,0x02,0x20,0x00,0x03,0x60,0x00,0x01,0xc0,0x00,0x01,
+0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,
+0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0xff,
+0xfe,0xff,0xfe,0x00,0x0c,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x20,0x00,0x60,
+0x00,0x40,0x00,0xc0,0x01,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x04,0x00,0x0c,
+0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0xff,0xfe,0xff,0xfe,
+0xff,0xff,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xff,0xff,0x80,0x00,
+0xc0,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x10,0x00,0x18,
+0x00,0x08,0x00,0x0c,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x01,0x00,
+0x01,0x00,0x01,0x80,0x00,0x80,0x00,0xc0,0x00,0x40,0x00,0x60,0x00,0x20,0xff,
+0xff,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0x06,0x00,0x06,
+0x00,0x09,0x00,0x09,0x00,0x10,0x80,0x10,0x80,0x00,0x40,0x20,0x40,0x20,0x20,
+0x40,0x20,0x40,0x10,0x80,0x18,0x80,0x08,0xff,0xff,0xe0,0xff,0xff,0xe0,0x80,
+0xc0,0x60,0x3f,0xc0,0x60,0x70,0x00,0x30,0x00,0x10,0x00,0x10,0x00,0x18,0x00,
+0x38,0x3f,0x98,0x60,0x18,0xc0,0x18,0x80,0x18,0x80,0x38,0xc0,0x38,0xc0,0x18,
+0x7f,0x18,0x00,0x18,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc7,0xe0,0xc0,0x38,0xe0,0x18,0xe0,0x0c,0xe0,0x0c,0xc0,0x0c,
+0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,0x0c,0xe0,0x0c,0xe0,0x0c,0xe0,0x18,0xc8,
+0x30,0xc7,0xe0,0xc0,0x00,0x1f,0xe0,0x30,0x20,0x60,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x60,
+0x00,0x30,0x10,0x1f,0xf0,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x1f,0x8c,0x30,0x4c,0x60,0x1c,0xc0,0x1c,0xc0,0x1c,0xc0,
+0x0c,0x80,0x0c,0x80,0x0c,0x80,0x0c,0xc0,0x0c,0xc0,0x1c,0xc0,0x1c,0x60,0x1c,
+0x70,0x0c,0x1f,0x8c,0x00,0x0c,0x1f,0xc0,0x30,0x30,0x60,0x10,0xc0,0x18,0xc0,
+0x18,0xc0,0x08,0xff,0xf8,0xff,0xfc,0x80,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0x60,0x00,0x30,0x18,0x1f,0xf0,0x01,0xfc,0x03,0x00,0x03,0x00,0x02,0x00,0x02,
+0x00,0x06,0x00,0x0f,0xfc,0xff,0xfc,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0xfc,0x1f,0xf0,0x20,0x60,0x60,0x60,
+0x40,0x20,0x40,0x20,0x40,0x20,0x60,0x60,0x20,0x40,0x19,0x80,0x10,0x00,0x20,
+0x00,0x20,0x00,0x20,0x00,0x3f,0x80,0x1f,0xf0,0x20,0x18,0xc0,0x08,0x80,0x08,
+0x80,0x08,0x80,0x08,0x80,0x18,0xc0,0x30,0x3f,0xe0,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc7,0xe0,0xc0,0x70,0xe0,0x30,
+0xe0,0x30,0xe0,0x10,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,
+0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0x06,0x00,0x06,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x3e,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x7f,0xf0,0xff,0xf8,0x00,0xc0,0x00,
+0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x0f,0xe0,0x00,0x60,
+0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,
+0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,
+0x00,0x60,0x00,0x40,0x00,0x40,0x00,0xc0,0x01,0x80,0xff,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x08,0xc0,0x10,0xc0,0x20,
+0xc0,0x40,0xc0,0x80,0xc1,0x00,0xc6,0x00,0xcc,0x00,0xde,0x00,0xe3,0x00,0xc1,
+0x80,0xc0,0xc0,0xc0,0x40,0xc0,0x20,0xc0,0x30,0xc0,0x18,0xc0,0x0c,0x3e,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x7f,0xf0,0xff,0xf8,0xc0,
+0x00,0x00,0xcf,0x1e,0x00,0xc1,0x83,0x00,0xe1,0xc3,0x00,0xe1,0xc1,0x00,0xc1,
+0x81,0x00,0xc1,0x81,0x80,0xc1,0x81,0x80,0xc1,0x81,0x80,0xc1,0x81,0x80,0xc1,
+0x81,0x80,0xc1,0x81,0x80,0xc1,0x81,0x80,0xc1,0x81,0x80,0xc1,0x81,0x80,0xc1,
+0x81,0x80,0xc1,0x81,0x80,0xc0,0x00,0xc7,0xe0,0xc0,0x70,0xe0,0x30,0xe0,0x30,
+0xe0,0x10,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,
+0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0x1f,0xc0,0x30,0x60,0x60,0x30,
+0xc0,0x18,0xc0,0x18,0xc0,0x18,0x80,0x08,0x80,0x08,0x80,0x08,0xc0,0x18,0xc0,
+0x18,0xc0,0x18,0x60,0x30,0x30,0x60,0x1f,0xc0,0xc0,0x00,0xc7,0xe0,0xc0,0x38,
+0xe0,0x18,0xe0,0x0c,0xe0,0x0c,0xc0,0x0c,0xc0,0x04,0xc0,0x04,0xc0,0x04,0xc0,
+0x0c,0xe0,0x0c,0xe0,0x0c,0xe0,0x18,0xc8,0x30,0xc7,0xe0,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x00,
+0x0c,0x1f,0x8c,0x30,0x4c,0x60,0x1c,0xc0,0x1c,0xc0,0x1c,0xc0,0x0c,0x80,0x0c,
+0x80,0x0c,0x80,0x0c,0xc0,0x0c,0xc0,0x1c,0xc0,0x1c,0x60,0x1c,0x70,0x0c,0x1f,
+0x8c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0xc0,0x00,0xc7,0xe0,0xc8,0x00,0xd0,0x00,0xe0,0x00,0xe0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x1f,0xf0,0x60,0x10,0x40,0x00,0x40,
+0x00,0x60,0x00,0x70,0x00,0x1c,0x00,0x07,0x80,0x00,0xe0,0x00,0x30,0x00,0x10,
+0x00,0x10,0x00,0x10,0xc0,0x30,0x7f,0xc0,0x04,0x00,0x04,0x00,0x04,0x00,0x0f,
+0xfc,0xff,0xfc,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x03,
+0xfc,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,
+0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0x40,0x38,0x40,0x38,0x60,0x38,0x70,
+0x18,0x3f,0x18,0x00,0x18,0x80,0x06,0xc0,0x06,0x40,0x04,0x60,0x0c,0x60,0x0c,
+0x20,0x08,0x30,0x18,0x10,0x10,0x18,0x30,0x18,0x30,0x08,0x20,0x0c,0x60,0x04,
+0x40,0x04,0x40,0x06,0xc0,0x02,0x80,0x03,0x80,0x81,0xc0,0x80,0x81,0xc0,0x80,
+0x81,0x40,0x80,0xc1,0x41,0x80,0xc1,0x41,0x80,0x42,0x21,0x00,0x42,0x21,0x00,
+0x42,0x21,0x00,0x62,0x23,0x00,0x22,0x22,0x00,0x24,0x12,0x00,0x24,0x12,0x00,
+0x24,0x12,0x00,0x24,0x12,0x00,0x00,0x10,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,
+0xc0,0x18,0x60,0x30,0x20,0x20,0x30,0x60,0x18,0xc0,0x08,0x80,0x05,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x0d,0x80,0x08,0x80,0x10,0x40,0x30,0x60,0x60,0x30,
+0x40,0x10,0xc0,0x18,0x40,0x03,0x60,0x03,0x20,0x02,0x30,0x06,0x10,0x06,0x18,
+0x04,0x18,0x0c,0x08,0x08,0x0c,0x18,0x04,0x18,0x06,0x10,0x02,0x30,0x02,0x20,
+0x03,0x60,0x01,0x60,0x01,0xc0,0x00,0xc0,0x00,0x80,0x01,0x80,0x01,0x80,0x03,
+0x00,0x03,0x00,0x06,0x00,0xfc,0x00,0x7f,0xf8,0x7f,0xf8,0x00,0x10,0x00,0x20,
+0x00,0x40,0x00,0xc0,0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x0c,0x00,0x08,
+0x00,0x10,0x00,0x20,0x00,0x60,0x00,0xff,0xf8,0xff,0xf8,0x01,0xe0,0x03,0x00,
+0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,
+0x00,0x06,0x00,0x0c,0x00,0xf0,0x00,0xf0,0x00,0x0c,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,
+0x00,0x01,0xe0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xf0,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x06,0x00,0x01,0xe0,
+0x01,0xe0,0x06,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0xf0,0x00,0x7f,0x02,0x81,0xfc,
   }
 };
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <errno.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -21,10 +22,12 @@
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <time.h>
 #include <linux/fb.h>
 #include <linux/kd.h>
 #include <pixelflinger/pixelflinger.h>
 #include <math.h>
+#include <pthread.h>
 
 #if defined(PIXELS_BGRA)
 # define PIXEL_FORMAT GGL_PIXEL_FORMAT_BGRA_8888
@@ -44,9 +47,19 @@
 # define PIXEL_SIZE   2
 #endif
 
-#define NUM_BUFFERS 2
+// pages of the framebuffer memory used, as many as fi.smem_len allows
+#define MAX_BUFFERS 3
+
+#ifndef FBIO_WAITFORVSYNC
+# define FBIO_WAITFORVSYNC _IOW('F', 0x20, __u32)
+#endif
+
+// used when the mode has no pixel clock
+#define DEFAULT_REFRESH_NS (1000000000ULL / 60)
 
 #include "minui.h"
+#include "graphics_internal.h"
+#include "spans.h"
 #include "font_10x18.h"
 #include "roboto_15x24.h"
 
@@ -54,15 +67,54 @@
 
 
 static struct UiFont FONTS[3];
-static int selectedFont = FONT_HEAD;
+
+// fonts are loaded once per CFont, the FONTS slots using it share it
+struct gr_font {
+    const struct CFont *cfont;
+    GRFont font;
+    struct span_font spans;
+};
+static struct gr_font gr_fonts[3];
+static struct gr_font *gr_font_slots[3];
 static GGLContext *gr_context = 0;
-static GGLSurface gr_framebuffer[NUM_BUFFERS];
+static GGLSurface gr_framebuffer[MAX_BUFFERS];
 static GGLSurface gr_mem_surface;
+static GGLSurface *gr_draw = &gr_mem_surface;
 static unsigned gr_active_fb = 0;
-static unsigned double_buffering = 0;
+static unsigned num_buffers = 1;
+
+// native span kernels, pixelflinger only draws what they can't
+static int gr_native = 0;
+
+// raster state, one per thread of the raster pool
+struct gr_state {
+    struct UiColor color;
+    struct span_color span_color;
+    GGLint gl_color[4];
+    struct gr_rect clip;
+    int clip_enabled;
+    int font;
+    int gl_stale;               // color or clip changed since loaded into gr_context
+};
+static struct gr_state gr_states[GR_RASTER_MAX_THREADS];
+static struct gr_state *gr_gl_state = NULL;    // the one loaded
+static pthread_mutex_t gr_gl_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int gr_fonts_expanded = 0;
+
+// offscreen surfaces, the generation changes each time one is drawn into
+#define MAX_SURFACES 8
+static struct {
+    GGLSurface *surface;
+    unsigned generation;
+} gr_surfaces[MAX_SURFACES];
+static unsigned gr_generation = 0;
+static GGLSurface *gr_target = NULL;
+static int gr_target_x = 0;
+static int gr_target_y = 0;
+
+// per page, rows which are older than the in-memory surface
+static unsigned char *gr_stale_rows[MAX_BUFFERS];
 
-static void * gr_fontmem = NULL;
-static void * gr_bigfontmem = NULL;
 static int gr_fb_fd = -1;
 static int gr_vt_fd = -1;
 
@@ -73,6 +125,21 @@ static struct fb_fix_screeninfo fi;
 
 static unsigned mmap_len = 0;
 
+// flips are paced by the vertical blanking of the panel
+static int gr_vsync_ioctl = 1;          // FBIO_WAITFORVSYNC works, until it fails
+static uint64_t gr_refresh_ns = DEFAULT_REFRESH_NS;
+static uint64_t gr_vsync_time = 0;      // a known vblank
+static uint64_t gr_flip_time = 0;       // last pan, 0 once it is on screen
+
+static void gr_mark_stale(int top, int bottom);
+static void gr_set_draw_surface(void);
+static GGLSurface *gr_font_texture(struct gr_font *f);
+
+static inline struct gr_state *gr_state(void)
+{
+    return &gr_states[gr_raster_worker()];
+}
+
 static void gr_fb_clear(GGLSurface *fb) {
     if (fb && fb->data) {
         memset(fb->data, 0, vi.yres * vi.xres * PIXEL_SIZE);
@@ -83,9 +150,23 @@ static void gr_fb_clear(GGLSurface *fb) {
 #  define DEFAULT_PAGE_SIZE 4096
 #endif
 
+// refresh period of the mode, the pixel clock is in picoseconds
+static uint64_t gr_mode_refresh_ns(void)
+{
+    uint64_t htotal = vi.xres + vi.left_margin + vi.right_margin + vi.hsync_len;
+    uint64_t vtotal = vi.yres + vi.upper_margin + vi.lower_margin + vi.vsync_len;
+    uint64_t ns = htotal * vtotal * vi.pixclock / 1000;
+
+    // no or bogus timings (many panels report none)
+    if (ns < 1000000000ULL / 120 || ns > 1000000000ULL / 20)
+        return DEFAULT_REFRESH_NS;
+    return ns;
+}
+
 static int get_framebuffer(GGLSurface *fb)
 {
     int fd;
+    unsigned n;
     void *bits;
 
     memset(&vi, 0, sizeof(vi));
@@ -106,6 +187,9 @@ static int get_framebuffer(GGLSurface *fb)
         return -1;
     }
 
+    // until FBIO_WAITFORVSYNC measures the actual period
+    gr_refresh_ns = gr_mode_refresh_ns();
+
     vi.bits_per_pixel = PIXEL_SIZE * 8;
     if (PIXEL_FORMAT == GGL_PIXEL_FORMAT_RGBA_8888
      || PIXEL_FORMAT == GGL_PIXEL_FORMAT_RGBX_8888) {
@@ -182,21 +266,31 @@ static int get_framebuffer(GGLSurface *fb)
     fb->format = PIXEL_FORMAT;
     gr_fb_clear(fb);
 
-    fb++;
-
-    /* check if we can use double buffering */
-    if (vi.yres * fi.line_length * NUM_BUFFERS > fi.smem_len)
+    /* check if we can use double or triple buffering */
+    num_buffers = fi.smem_len / (vi.yres * fi.line_length);
+    if (num_buffers > MAX_BUFFERS)
+        num_buffers = MAX_BUFFERS;
+    if (num_buffers == 3) {
+        // smem_len may be larger than the virtual height the driver allows
+        vi.yres_virtual = vi.yres * 3;
+        if (ioctl(fd, FBIOPUT_VSCREENINFO, &vi) < 0)
+            num_buffers = 2;
+    }
+    if (num_buffers < 2) {
+        num_buffers = 1;
         return fd;
+    }
 
-    double_buffering = 1;
-
-    fb->version = sizeof(*fb);
-    fb->width = vi.xres;
-    fb->height = vi.yres;
-    fb->stride = fi.line_length/PIXEL_SIZE;
-    fb->data = (void*) (((unsigned) bits) + vi.yres * fi.line_length);
-    fb->format = PIXEL_FORMAT;
-    gr_fb_clear(fb);
+    for (n = 1; n < num_buffers; n++) {
+        fb++;
+        fb->version = sizeof(*fb);
+        fb->width = vi.xres;
+        fb->height = vi.yres;
+        fb->stride = fi.line_length/PIXEL_SIZE;
+        fb->data = (void*) (((unsigned) bits) + n * vi.yres * fi.line_length);
+        fb->format = PIXEL_FORMAT;
+        gr_fb_clear(fb);
+    }
 
     return fd;
 }
@@ -235,6 +329,8 @@ int gr_fb_test(void)
         return -1;
     }
 
+    gr_mark_stale(0, vi.yres);
+    gr_set_draw_surface();
     return 0;
 }
 
@@ -250,8 +346,8 @@ static void get_memory_surface(GGLSurface* ms) {
 
 static void set_active_framebuffer(unsigned n)
 {
-    if (n >= NUM_BUFFERS || !double_buffering) return;
-    vi.yres_virtual = vi.yres * NUM_BUFFERS;
+    if (n >= num_buffers || num_buffers < 2) return;
+    vi.yres_virtual = vi.yres * num_buffers;
     vi.yoffset = n * vi.yres;
     vi.bits_per_pixel = PIXEL_SIZE * 8;
     if (ioctl(gr_fb_fd, FBIOPUT_VSCREENINFO, &vi) < 0) {
@@ -274,27 +370,280 @@ static void set_final_framebuffer(void)
     }
 }
 
-void gr_flip(void)
+// first vblank after t, predicted from the last known one
+static uint64_t gr_next_vsync(uint64_t t)
+{
+    if (t < gr_vsync_time)
+        return gr_vsync_time;
+    return gr_vsync_time + ((t - gr_vsync_time) / gr_refresh_ns + 1) * gr_refresh_ns;
+}
+
+// Wait for the next vblank. Without FBIO_WAITFORVSYNC, sleep until the
+// predicted one.
+static void gr_wait_vsync(void)
+{
+    __u32 crtc = 0;
+    uint64_t now, interval;
+    struct timespec ts;
+
+    if (gr_vsync_ioctl && ioctl(gr_fb_fd, FBIO_WAITFORVSYNC, &crtc) == 0) {
+        now = gr_stats_now();
+        // follow the actual refresh rate
+        interval = now - gr_vsync_time;
+        if (interval > gr_refresh_ns / 2 && interval < gr_refresh_ns * 3 / 2)
+            gr_refresh_ns = (gr_refresh_ns * 7 + interval) / 8;
+        gr_vsync_time = now;
+    } else {
+        if (gr_vsync_ioctl) {
+            perror("FBIO_WAITFORVSYNC unsupported, flips are timed");
+            gr_vsync_ioctl = 0;
+        }
+        now = gr_next_vsync(gr_stats_now());
+        ts.tv_sec = now / 1000000000ULL;
+        ts.tv_nsec = now % 1000000000ULL;
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+        gr_vsync_time = now;
+    }
+    gr_flip_time = 0;
+}
+
+// pan to page n, the pan is pending until the next vblank
+static void gr_pan(unsigned n)
+{
+    uint64_t start = gr_stats_now();
+
+    set_active_framebuffer(n);
+    gr_flip_time = gr_stats_now();
+
+    // many drivers only return from the pan at the vblank
+    if (gr_flip_time - start > gr_refresh_ns / 4) {
+        gr_vsync_time = gr_flip_time;
+        gr_flip_time = 0;
+    }
+}
+
+// the last pan is not on screen yet
+static int gr_flip_pending(void)
+{
+    if (gr_flip_time != 0 && gr_stats_now() >= gr_next_vsync(gr_flip_time))
+        gr_flip_time = 0;
+    return gr_flip_time != 0;
+}
+
+int gr_flip_delay(void)
+{
+    uint64_t now, shown;
+
+    // a third page is always free, drawing goes on while a flip is pending
+    if (num_buffers != 2 || gr_flip_time == 0)
+        return 0;
+
+    now = gr_stats_now();
+    shown = gr_next_vsync(gr_flip_time);
+    if (now >= shown) {
+        gr_flip_time = 0;
+        return 0;
+    }
+    return (shown - now + 999999) / 1000000;
+}
+
+static void gr_mark_stale(int top, int bottom)
+{
+    int n;
+
+    if (top < 0) top = 0;
+    if (bottom > (int) vi.yres) bottom = vi.yres;
+    if (top >= bottom) return;
+
+    for (n = 0; n < MAX_BUFFERS; n++) {
+        if (gr_stale_rows[n])
+            memset(gr_stale_rows[n] + top, 1, bottom - top);
+    }
+}
+
+// copy the runs of stale rows from src to dst, and clear them
+static void gr_copy_stale_rows(GGLSurface *dst, GGLSurface *src, unsigned char *stale)
+{
+    unsigned y, top;
+
+    for (y = 0; y < vi.yres; ) {
+        if (!stale[y]) {
+            y++;
+            continue;
+        }
+        for (top = y; y < vi.yres && stale[y]; y++) {}
+        memcpy(dst->data + top * fi.line_length,
+               src->data + top * fi.line_length,
+               (y - top) * fi.line_length);
+        memset(stale + top, 0, y - top);
+    }
+}
+
+// select the surface the primitives rasterize into
+static void gr_set_draw_surface(void)
 {
     GGLContext *gl = gr_context;
 
-    /* swap front and back buffers */
-    if (double_buffering)
-        gr_active_fb = (gr_active_fb + 1) % NUM_BUFFERS;
+    if (gr_target) {
+        gr_draw = gr_target;
+    } else if (num_buffers > 1) {
+        /* draw straight into the hidden page, the oldest one */
+        gr_draw = &gr_framebuffer[(gr_active_fb + 1) % num_buffers];
+    } else {
+        gr_draw = &gr_mem_surface;
+    }
+    gl->colorBuffer(gl, gr_draw);
+
+    gr_native = span_supported(gr_draw->format);
+}
+
+static void gr_flip_page(void)
+{
+    if (num_buffers > 1) {
+        /* one frame per vblank, a pending one is never replaced */
+        if (gr_flip_pending())
+            gr_wait_vsync();
+
+        /* the back page holds the new frame */
+        gr_active_fb = (gr_active_fb + 1) % num_buffers;
+        memset(gr_stale_rows[gr_active_fb], 0, vi.yres);
+
+        /* inform the display driver */
+        gr_pan(gr_active_fb);
+
+        /* with two pages the old front one is drawn into next, wait
+         * until it is not scanned out anymore when this can be known */
+        if (num_buffers == 2 && gr_vsync_ioctl && gr_flip_pending())
+            gr_wait_vsync();
+    } else {
+        /* single page, copy the rows changed since the last flip from
+         * the in-memory surface, during the vblank if possible. */
+        if (gr_vsync_ioctl)
+            gr_wait_vsync();
+        gr_copy_stale_rows(&gr_framebuffer[0], &gr_mem_surface, gr_stale_rows[0]);
+    }
 
-    /* copy data from the in-memory surface to the buffer we're about
-     * to make active. */
-    memcpy(gr_framebuffer[gr_active_fb].data, gr_mem_surface.data,
-           vi.yres * fi.line_length);
+    gr_set_draw_surface();
+}
 
-    /* inform the display driver */
-    set_active_framebuffer(gr_active_fb);
+// caller has redrawn the whole screen
+void gr_flip(void)
+{
+    gr_mark_stale(0, vi.yres);
+    gr_capture_changing();
+    gr_flip_page();
+    gr_capture_changed(NULL, 0);
 }
 
-void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+// bring the back page up to date before only the damaged areas are
+// redrawn into it: copy forward from the front page the rows which
+// changed since the back page was last shown.
+void gr_prepare_damage(const struct gr_rect *rects, int count)
+{
+    unsigned char *stale;
+    int i;
+
+    if (num_buffers < 2)
+        return;
+
+    stale = gr_stale_rows[(gr_active_fb + 1) % num_buffers];
+
+    // full width damaged rows are repainted anyway
+    for (i = 0; i < count; i++) {
+        if (rects[i].left <= 0 && rects[i].right >= (int) vi.xres
+         && rects[i].top < rects[i].bottom)
+            memset(stale + rects[i].top, 0, rects[i].bottom - rects[i].top);
+    }
+
+    gr_copy_stale_rows(gr_draw, &gr_framebuffer[gr_active_fb], stale);
+}
+
+// the rows of area - dy, up to date in the back page, are moved to area
+void gr_scroll_rect(const struct gr_rect *area, int dy)
+{
+    span_copy_rect(gr_draw, area->left, area->top, gr_draw, area->left, area->top - dy,
+                   area->right - area->left, area->bottom - area->top);
+}
+
+// flip after only the damaged areas have been redrawn
+void gr_flip_damage(const struct gr_rect *rects, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+        gr_mark_stale(rects[i].top, rects[i].bottom);
+    gr_capture_changing();
+    gr_flip_page();
+    gr_capture_changed(rects, count);
+}
+
+// Bands of the screen can be rasterized at once if the primitives draw
+// into it with the span kernels: the glyphs are expanded before, and the
+// few pixelflinger fallbacks take turns.
+int gr_raster_ready(void)
+{
+    int i;
+
+    if (!gr_native || gr_target != NULL)
+        return 0;
+    if (!gr_fonts_expanded) {
+        for (i = 0; i < 3; i++) {
+            if (gr_fonts[i].cfont)
+                span_font_expand(&gr_fonts[i].spans);
+        }
+        gr_fonts_expanded = 1;
+    }
+    return 1;
+}
+
+void gr_set_clip(const struct gr_rect *clip)
+{
+    struct gr_state *st = gr_state();
+
+    st->gl_stale = 1;
+    if (clip == NULL) {
+        st->clip_enabled = 0;
+        return;
+    }
+    st->clip = *clip;
+    st->clip_enabled = 1;
+}
+
+// The color and the clip of the calling thread are only loaded into the
+// pixelflinger context before it draws. While the raster pool runs, the
+// context is shared by its threads, one at a time.
+static GGLContext *gr_gl_begin(struct gr_state *st)
 {
     GGLContext *gl = gr_context;
-    GGLint color[4];
+
+    if (gr_raster_busy())
+        pthread_mutex_lock(&gr_gl_mutex);
+
+    if (gr_gl_state != st || st->gl_stale) {
+        gl->color4xv(gl, st->gl_color);
+        if (st->clip_enabled) {
+            gl->scissor(gl, st->clip.left, st->clip.top,
+                        st->clip.right - st->clip.left, st->clip.bottom - st->clip.top);
+            gl->enable(gl, GGL_SCISSOR_TEST);
+        } else {
+            gl->disable(gl, GGL_SCISSOR_TEST);
+        }
+        gr_gl_state = st;
+        st->gl_stale = 0;
+    }
+    return gl;
+}
+
+static void gr_gl_end(void)
+{
+    if (gr_raster_busy())
+        pthread_mutex_unlock(&gr_gl_mutex);
+}
+
+void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    struct gr_state *st = gr_state();
+    GGLint *color = st->gl_color;
     color[0] = ((r << 8) | r) + 1;
     color[1] = ((g << 8) | g) + 1;
     color[2] = ((b << 8) | b) + 1;
@@ -303,7 +652,102 @@ void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a
     color[0] = ((b << 8) | b) + 1;
     color[2] = ((r << 8) | r) + 1;
 #endif
-    gl->color4xv(gl, color);
+    st->gl_stale = 1;
+
+#ifdef COLORS_REVERSED
+    span_set_color(&st->span_color, PIXEL_FORMAT, b, g, r, a);
+#else
+    span_set_color(&st->span_color, PIXEL_FORMAT, r, g, b, a);
+#endif
+
+    st->color = gr_make_uicolor(r, g, b, a);
+}
+
+// clip [x1,x2) x [y1,y2) to the draw surface and the clip rect,
+// returns 0 if nothing is left
+static int gr_clip_rect(int *x1, int *y1, int *x2, int *y2)
+{
+    struct gr_state *st = gr_state();
+    int left = 0, top = 0;
+    int right = gr_draw->width, bottom = gr_draw->height;
+
+    if (st->clip_enabled) {
+        if (st->clip.left > left) left = st->clip.left;
+        if (st->clip.top > top) top = st->clip.top;
+        if (st->clip.right < right) right = st->clip.right;
+        if (st->clip.bottom < bottom) bottom = st->clip.bottom;
+    }
+    if (*x1 < left) *x1 = left;
+    if (*y1 < top) *y1 = top;
+    if (*x2 > right) *x2 = right;
+    if (*y2 > bottom) *y2 = bottom;
+
+    return *x1 < *x2 && *y1 < *y2;
+}
+
+// clip the destination of a blit, and the source to its surface
+static int gr_clip_blit(const GGLSurface *src, int *sx, int *sy, int *w, int *h,
+                        int *dx, int *dy)
+{
+    int x1 = *dx, y1 = *dy, x2 = *dx + *w, y2 = *dy + *h;
+
+    if (*sx < 0) x1 -= *sx;
+    if (*sy < 0) y1 -= *sy;
+    if (*sx + *w > (int) src->width) x2 -= *sx + *w - src->width;
+    if (*sy + *h > (int) src->height) y2 -= *sy + *h - src->height;
+
+    if (!gr_clip_rect(&x1, &y1, &x2, &y2))
+        return 0;
+
+    *sx += x1 - *dx;
+    *sy += y1 - *dy;
+    *dx = x1;
+    *dy = y1;
+    *w = x2 - x1;
+    *h = y2 - y1;
+    return 1;
+}
+
+// primitives drawn into an offscreen surface are not recorded
+static inline int gr_recording(void)
+{
+    return gr_target == NULL && gr_dl_recording();
+}
+
+// screen coordinate of an optional text clip bound to the draw surface
+static inline int gr_target_bound(int v, int origin)
+{
+    if (v < 0)
+        return v;
+    return v > origin ? v - origin : 0;
+}
+
+static int gr_find_surface(const GGLSurface *surface)
+{
+    int i;
+
+    for (i = 0; i < MAX_SURFACES; i++) {
+        if (surface && gr_surfaces[i].surface == surface)
+            return i;
+    }
+    return -1;
+}
+
+// Sources whose pixels are copied as they are: the offscreen surfaces,
+// and the images in the draw format without alpha (as the opaque ones of
+// the asset pack) drawn with an opaque color.
+static int gr_blit_copies(const GGLSurface *src)
+{
+    if (src->format != gr_draw->format)
+        return 0;
+    if (gr_find_surface(src) >= 0)
+        return 1;
+    return gr_state()->color.a == 255
+        && (src->format == GGL_PIXEL_FORMAT_RGB_565 || src->format == GGL_PIXEL_FORMAT_RGBX_8888);
+}
+
+struct UiColor gr_get_color(void) {
+    return gr_state()->color;
 }
 
 void gr_set_uicolor(struct UiColor c) {
@@ -316,14 +760,16 @@ struct UiColor gr_make_uicolor(unsigned char r, unsigned char g, unsigned char b
 
 int gr_measure(const char *s)
 {
-    return FONTS[selectedFont].gr_font->cwidth * strlen(s);
+    return FONTS[gr_state()->font].gr_font->cwidth * strlen(s);
 }
 
 void gr_font_size(int *x, int *y)
 {
-    if (FONTS[selectedFont].gr_font != NULL) {
-        *x = FONTS[selectedFont].gr_font->cwidth;
-        *y = FONTS[selectedFont].gr_font->cheight;
+    struct gr_state *st = gr_state();
+
+    if (FONTS[st->font].gr_font != NULL) {
+        *x = FONTS[st->font].gr_font->cwidth;
+        *y = FONTS[st->font].gr_font->cheight;
     }
 }
 
@@ -333,12 +779,46 @@ int gr_text(int x, int y, const char *s)
 }
 
 int gr_text_cut(int _x, int _y, const char *s, int minx, int maxx, int miny, int maxy) {
-    GGLContext *gl = gr_context;
-    GRFont *font = FONTS[selectedFont].gr_font;
+    struct gr_state *st = gr_state();
+    GGLContext *gl;
+    GRFont *font = FONTS[st->font].gr_font;
+    GGLSurface *ftex;
     unsigned off;
-    _y -= font->ascent;
+    int end = _x + font->cwidth * strlen(s);
 
-    gl->bindTexture(gl, &font->texture);
+    if (gr_recording()) {
+        gr_dl_text(_x, _y, s, minx, maxx, miny, maxy);
+        return end;
+    }
+
+    _x -= gr_target_x;
+    _y -= gr_target_y + font->ascent;
+    minx = gr_target_bound(minx, gr_target_x);
+    maxx = gr_target_bound(maxx, gr_target_x);
+    miny = gr_target_bound(miny, gr_target_y);
+    maxy = gr_target_bound(maxy, gr_target_y);
+
+    // whole string at once from the glyph span cache, clipped once
+    if (gr_native) {
+        int left = minx >= 0 ? minx : 0;
+        int top = miny >= 0 ? miny : 0;
+        int right = maxx >= 0 ? maxx : (int) gr_draw->width;
+        int bottom = maxy >= 0 ? maxy : (int) gr_draw->height;
+
+        if (gr_clip_rect(&left, &top, &right, &bottom))
+            span_text(gr_draw, &gr_font_slots[st->font]->spans, _x, _y, s,
+                      left, top, right, bottom, &st->span_color);
+        return end;
+    }
+
+    gl = gr_gl_begin(st);
+    ftex = gr_font_texture(gr_font_slots[st->font]);
+    if (ftex == NULL) {
+        gr_gl_end();
+        return end;
+    }
+
+    gl->bindTexture(gl, ftex);
     gl->texEnvi(gl, GGL_TEXTURE_ENV, GGL_TEXTURE_ENV_MODE, GGL_REPLACE);
     gl->texGeni(gl, GGL_S, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
     gl->texGeni(gl, GGL_T, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
@@ -384,25 +864,82 @@ int gr_text_cut(int _x, int _y, const char *s, int minx, int maxx, int miny, int
       }
       _x += font->cwidth;
     }
+    gr_gl_end();
 
-    return _x;
+    return end;
 }
 
 void gr_fill(int x, int y, int w, int h)
 {
-    GGLContext *gl = gr_context;
+    struct gr_state *st = gr_state();
+    GGLContext *gl;
+
+    if (gr_recording()) {
+        gr_dl_fill(x, y, w, h);
+        return;
+    }
+
+    x -= gr_target_x;
+    w -= gr_target_x;
+    y -= gr_target_y;
+    h -= gr_target_y;
+
+    if (gr_native) {
+        if (gr_clip_rect(&x, &y, &w, &h))
+            span_fill_rect(gr_draw, x, y, w - x, h - y, &st->span_color);
+        return;
+    }
+
+    gl = gr_gl_begin(st);
     gl->disable(gl, GGL_TEXTURE_2D);
     gl->recti(gl, x, y, w, h);
+    gr_gl_end();
 }
 
 void gr_drawLine(int ax, int ay, int bx, int by, int width)
 {
-    GGLContext *gl = gr_context;
+    struct gr_state *st = gr_state();
+    GGLContext *gl;
+
+    if (gr_recording()) {
+        gr_dl_line(ax, ay, bx, by, width);
+        return;
+    }
+
+    ax -= gr_target_x;
+    bx -= gr_target_x;
+    ay -= gr_target_y;
+    by -= gr_target_y;
+
+    // axis aligned lines are rectangles: pixelflinger offsets both ends
+    // by width/2 on the minor axis and samples the pixel centers.
+    if (gr_native && (ax == bx || ay == by)) {
+        int w = width ? abs(width) : 1;
+        int x1, y1, x2, y2;
+
+        if (ay == by) {
+            x1 = ax < bx ? ax : bx;
+            x2 = ax < bx ? bx : ax;
+            y1 = ay - (w + 1) / 2;
+            y2 = y1 + w;
+        } else {
+            y1 = ay < by ? ay : by;
+            y2 = ay < by ? by : ay;
+            x1 = ax - (w + 1) / 2;
+            x2 = x1 + w;
+        }
+        if (gr_clip_rect(&x1, &y1, &x2, &y2))
+            span_fill_rect(gr_draw, x1, y1, x2 - x1, y2 - y1, &st->span_color);
+        return;
+    }
+
+    gl = gr_gl_begin(st);
     gl->disable(gl, GGL_TEXTURE_2D);
 
     int v0[] = {ax*16,ay*16};
     int v1[] = {bx*16,by*16};
     gl->linex(gl, v0, v1, width*16);
+    gr_gl_end();
 }
 
 void gr_drawRect(int ax, int ay, int bx, int by, int width)
@@ -414,11 +951,36 @@ void gr_drawRect(int ax, int ay, int bx, int by, int width)
 }
 
 void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
+    struct gr_state *st = gr_state();
+    GGLContext *gl;
+
     if (gr_context == NULL) {
         return;
     }
-    GGLContext *gl = gr_context;
 
+    if (gr_recording()) {
+        gr_dl_blit(source, sx, sy, w, h, dx, dy);
+        return;
+    }
+
+    dx -= gr_target_x;
+    dy -= gr_target_y;
+
+    if (gr_native) {
+        GGLSurface *src = (GGLSurface*) source;
+        int csx = sx, csy = sy, cw = w, ch = h, cdx = dx, cdy = dy;
+
+        if (src == NULL || !gr_clip_blit(src, &csx, &csy, &cw, &ch, &cdx, &cdy))
+            return;
+        if (gr_blit_copies(src)) {
+            span_copy_rect(gr_draw, cdx, cdy, src, csx, csy, cw, ch);
+            return;
+        }
+        if (span_blit_rect(gr_draw, cdx, cdy, src, csx, csy, cw, ch, &st->span_color) == 0)
+            return;
+    }
+
+    gl = gr_gl_begin(st);
     gl->bindTexture(gl, (GGLSurface*) source);
     gl->texEnvi(gl, GGL_TEXTURE_ENV, GGL_TEXTURE_ENV_MODE, GGL_REPLACE);
     gl->texGeni(gl, GGL_S, GGL_TEXTURE_GEN_MODE, GGL_ONE_TO_ONE);
@@ -426,6 +988,7 @@ void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
     gl->enable(gl, GGL_TEXTURE_2D);
     gl->texCoord2i(gl, sx - dx, sy - dy);
     gl->recti(gl, dx, dy, dx + w, dy + h);
+    gr_gl_end();
 }
 
 unsigned int gr_get_width(gr_surface surface) {
@@ -442,69 +1005,193 @@ unsigned int gr_get_height(gr_surface surface) {
     return ((GGLSurface*) surface)->height;
 }
 
-static struct UiFont gr_init_font(struct CFont *font_p)
+gr_surface gr_create_surface(int width, int height)
 {
-    struct UiFont uifont;
-    GGLSurface *ftex;
-    unsigned char *bits, *rle;
-    unsigned char *in, data;
+    GGLSurface *s;
     int i;
 
-    uifont.gr_font = calloc(sizeof(*uifont.gr_font), 1);
-    uifont.cfont = font_p;
-    ftex = &uifont.gr_font->texture;
+    if (width <= 0 || height <= 0)
+        return NULL;
+
+    for (i = 0; i < MAX_SURFACES && gr_surfaces[i].surface; i++) {}
+    if (i == MAX_SURFACES)
+        return NULL;
+
+    s = calloc(1, sizeof(GGLSurface) + width * height * PIXEL_SIZE);
+    if (s == NULL)
+        return NULL;
+
+    s->version = sizeof(*s);
+    s->width = width;
+    s->height = height;
+    s->stride = width;
+    s->data = (unsigned char*) (s + 1);
+    s->format = PIXEL_FORMAT;
+
+    gr_surfaces[i].surface = s;
+    gr_surfaces[i].generation = ++gr_generation;
+    return (gr_surface) s;
+}
+
+void gr_free_surface(gr_surface surface)
+{
+    int i = gr_find_surface(surface);
+
+    if (i < 0)
+        return;
+    if (gr_target == surface)
+        gr_set_target(NULL, 0, 0);
 
-    bits = malloc(font_p->width * font_p->height);
-    uifont.gr_fontmem = (void *) bits;
+    free(gr_surfaces[i].surface);
+    gr_surfaces[i].surface = NULL;
+}
+
+void gr_set_target(gr_surface surface, int x, int y)
+{
+    int i = gr_find_surface(gr_target);
+
+    // whatever was drawn, the old target has new contents
+    if (i >= 0)
+        gr_surfaces[i].generation = ++gr_generation;
+
+    if (gr_find_surface(surface) < 0) {
+        surface = NULL;
+        x = y = 0;
+    }
+    gr_target = surface;
+    gr_target_x = x;
+    gr_target_y = y;
+
+    if (gr_context)
+        gr_set_draw_surface();
+}
+
+gr_surface gr_capture_surface(void)
+{
+    return (gr_surface) &gr_framebuffer[gr_active_fb];
+}
+
+unsigned gr_surface_generation(gr_surface surface)
+{
+    int i = gr_find_surface(surface);
+
+    return i >= 0 ? gr_surfaces[i].generation : 0;
+}
+
+int gr_save_screen(gr_surface surface)
+{
+    GGLSurface *dst = (GGLSurface*) surface;
+    GGLSurface *src = &gr_framebuffer[gr_active_fb];
+    int i = gr_find_surface(dst);
+    unsigned y;
+
+    if (i < 0 || dst->width != src->width || dst->height != src->height)
+        return -1;
+
+    for (y = 0; y < src->height; y++)
+        memcpy(dst->data + y * dst->stride * PIXEL_SIZE,
+               src->data + y * src->stride * PIXEL_SIZE, src->width * PIXEL_SIZE);
+    gr_surfaces[i].generation = ++gr_generation;
+    return dst->stride * dst->height * PIXEL_SIZE;
+}
+
+// A_8 atlas of all the glyphs for pixelflinger, only expanded if some
+// text is drawn without the span kernels.
+static GGLSurface *gr_font_texture(struct gr_font *f)
+{
+    const struct CFont *cf = f->cfont;
+    GGLSurface *ftex = &f->font.texture;
+    unsigned width = cf->cwidth * CFONT_GLYPHS;
+    unsigned char *bits;
+    unsigned i, x, y;
+
+    if (ftex->data != NULL)
+        return ftex;
+
+    bits = calloc(width * cf->cheight, 1);
+    if (bits == NULL)
+        return NULL;
+
+    for (i = 0; i < CFONT_GLYPHS; i++) {
+        const struct CGlyph *g = &cf->glyphs[i];
+        const unsigned char *in = cf->bits + g->offset;
+        unsigned pitch = (g->w + 7) / 8;
+
+        for (y = 0; y < g->h; y++, in += pitch) {
+            unsigned char *out = bits + (g->y + y) * width + i * cf->cwidth + g->x;
+            for (x = 0; x < g->w; x++) {
+                if (in[x / 8] & (0x80 >> (x % 8)))
+                    out[x] = 255;
+            }
+        }
+    }
 
     ftex->version = sizeof(*ftex);
-    ftex->width = font_p->width;
-    ftex->height = font_p->height;
-    ftex->stride = font_p->width;
+    ftex->width = width;
+    ftex->height = cf->cheight;
+    ftex->stride = width;
     ftex->data = (void*) bits;
     ftex->format = GGL_PIXEL_FORMAT_A_8;
+    return ftex;
+}
+
+static struct UiFont gr_init_font(int slot, const struct CFont *font_p)
+{
+    struct UiFont uifont;
+    struct gr_font *f = NULL;
+    int i;
 
-    in = font_p->rundata;
-    while((data = *in++)) {
-        memset(bits, (data & 0x80) ? 255 : 0, data & 0x7f);
-        bits += (data & 0x7f);
+    // the glyphs are read from the packed font, nothing to decode
+    for (i = 0; i < 3; i++) {
+        if (gr_fonts[i].cfont == font_p || gr_fonts[i].cfont == NULL) {
+            f = &gr_fonts[i];
+            break;
+        }
     }
 
-    uifont.gr_font->cwidth = font_p->cwidth;
-    uifont.gr_font->cheight = font_p->cheight;
-    uifont.gr_font->ascent = font_p->cheight - 2;
+    if (f->cfont == NULL) {
+        memset(f, 0, sizeof(*f));
+        f->cfont = font_p;
+        f->font.cwidth = font_p->cwidth;
+        f->font.cheight = font_p->cheight;
+        f->font.ascent = font_p->cheight - 2;
+        span_font_init(&f->spans, font_p);
+    }
 
+    gr_font_slots[slot] = f;
+    uifont.cfont = font_p;
+    uifont.gr_font = &f->font;
     return uifont;
 }
 
 static void gr_init_fonts(void)
 {
-    FONTS[FONT_HEAD] = gr_init_font(&bigfont);
-    FONTS[FONT_ITEM] = gr_init_font(&bigfont);
-    FONTS[FONT_LOGS] = gr_init_font(&font);
-}
-
-static void gr_free_font(struct UiFont *uifont)
-{
-    // free font allocs
-    if (uifont->gr_fontmem) free(uifont->gr_fontmem);
-    uifont->gr_fontmem = NULL;
-
-    if (uifont->gr_font) free(uifont->gr_font);
-    uifont->gr_font = NULL;
+    FONTS[FONT_HEAD] = gr_init_font(FONT_HEAD, &bigfont);
+    FONTS[FONT_ITEM] = gr_init_font(FONT_ITEM, &bigfont);
+    FONTS[FONT_LOGS] = gr_init_font(FONT_LOGS, &font);
 }
 
 static void gr_free_fonts(void)
 {
-    gr_free_font(&FONTS[FONT_HEAD]);
-    gr_free_font(&FONTS[FONT_ITEM]);
-    gr_free_font(&FONTS[FONT_LOGS]);
+    int i;
+
+    for (i = 0; i < 3; i++) {
+        free(gr_fonts[i].font.texture.data);
+        span_font_free(&gr_fonts[i].spans);
+        memset(&gr_fonts[i], 0, sizeof(gr_fonts[i]));
+        gr_font_slots[i] = NULL;
+        FONTS[i].gr_font = NULL;
+    }
+    gr_fonts_expanded = 0;
 }
 
 int gr_init(void)
 {
+    int i;
+
     gglInit(&gr_context);
     GGLContext *gl = gr_context;
+    gr_gl_state = NULL;
 
     gr_mem_surface.data = NULL;
 
@@ -533,7 +1220,15 @@ int gr_init(void)
         return -1;
     }
 
-    get_memory_surface(&gr_mem_surface);
+    /* the in-memory surface is only needed without a second page */
+    if (num_buffers < 2)
+        get_memory_surface(&gr_mem_surface);
+
+    for (i = 0; i < (int) num_buffers; i++) {
+        gr_stale_rows[i] = malloc(vi.yres);
+    }
+    gr_mark_stale(0, vi.yres);
+    gr_frame_invalidate();
 
     fprintf(stderr, "framebuffer: fd %d (%d x %d)\n",
             gr_fb_fd, gr_framebuffer[0].width, gr_framebuffer[0].height);
@@ -541,7 +1236,7 @@ int gr_init(void)
     /* start with 0 as front (displayed) and 1 as back (drawing) */
     gr_active_fb = 0;
     set_active_framebuffer(0);
-    gl->colorBuffer(gl, &gr_mem_surface);
+    gr_set_draw_surface();
 
     gl->activeTexture(gl, 0);
     gl->enable(gl, GGL_BLEND);
@@ -550,11 +1245,19 @@ int gr_init(void)
     gr_fb_blank(true);
     gr_fb_blank(false);
 
+#ifdef GR_PARALLEL_RASTER
+    gr_raster_start(sysconf(_SC_NPROCESSORS_CONF));
+#endif
     return 0;
 }
 
 void gr_exit(void)
 {
+    int i;
+
+    gr_capture_stop();
+    gr_raster_stop();
+
     // restore original vt mode (text or graphic)
     if (gr_vt_mode != -1)
         ioctl(gr_vt_fd, KDSETMODE, &gr_vt_mode);
@@ -566,9 +1269,9 @@ void gr_exit(void)
     }
 
     // black screen before resolution change by bootanimation.
-    // both are required to prevent some weird bunnies display
-    gr_fb_clear(&gr_framebuffer[0]);
-    gr_fb_clear(&gr_framebuffer[1]);
+    // all pages are required to prevent some weird bunnies display
+    for (i = 0; i < (int) num_buffers; i++)
+        gr_fb_clear(&gr_framebuffer[i]);
 
     set_final_framebuffer();
 
@@ -578,27 +1281,67 @@ void gr_exit(void)
         gr_mem_surface.data = NULL;
     }
 
+    for (i = 0; i < MAX_BUFFERS; i++) {
+        free(gr_stale_rows[i]);
+        gr_stale_rows[i] = NULL;
+    }
+
+    gr_frame_free();
     gr_free_fonts();
 
+    for (i = 0; i < MAX_SURFACES; i++)
+        gr_free_surface(gr_surfaces[i].surface);
+
     // un-mmap
     release_framebuffer(gr_framebuffer);
 
     gglUninit(gr_context);
 }
 
+// The size of the mode, for the touches read before gr_init() (the virtual
+// keys of the boot key check)
+static int gr_mode_width = 0;
+static int gr_mode_height = 0;
+
+static void gr_mode_size(void)
+{
+    struct fb_var_screeninfo mode;
+    int fd;
+
+    if (gr_mode_width > 0)
+        return;
+    fd = open("/dev/graphics/fb0", O_RDONLY);
+    if (fd < 0)
+        return;
+    memset(&mode, 0, sizeof(mode));
+    if (ioctl(fd, FBIOGET_VSCREENINFO, &mode) >= 0) {
+        gr_mode_width = mode.xres;
+        gr_mode_height = mode.yres;
+    }
+    close(fd);
+}
+
 int gr_fb_width(void)
 {
+    if (gr_framebuffer[0].width == 0) {
+        gr_mode_size();
+        return gr_mode_width;
+    }
     return gr_framebuffer[0].width;
 }
 
 int gr_fb_height(void)
 {
+    if (gr_framebuffer[0].height == 0) {
+        gr_mode_size();
+        return gr_mode_height;
+    }
     return gr_framebuffer[0].height;
 }
 
 gr_pixel *gr_fb_data(void)
 {
-    return (unsigned short *) gr_mem_surface.data;
+    return (unsigned short *) gr_draw->data;
 }
 
 void gr_fb_blank(bool blank)
@@ -611,17 +1354,21 @@ void gr_fb_blank(bool blank)
 }
 
 void gr_setfont(int i) {
-    selectedFont = i;
+    gr_state()->font = i;
+}
+
+int gr_getfont(void) {
+    return gr_state()->font;
 }
 
 int gr_getfont_cwidth() {
-    return FONTS[selectedFont].gr_font->cwidth;
+    return FONTS[gr_state()->font].gr_font->cwidth;
 }
 
 int gr_getfont_cheight() {
-    return FONTS[selectedFont].gr_font->cheight;
+    return FONTS[gr_state()->font].gr_font->cheight;
 }
 
 int gr_getfont_cheightfix() {
-    return FONTS[selectedFont].cfont->cheightfix;
+    return FONTS[gr_state()->font].cfont->cheightfix;
 }
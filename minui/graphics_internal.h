@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _MINUI_GRAPHICS_INTERNAL_H_
+#define _MINUI_GRAPHICS_INTERNAL_H_
+
+#include "minui.h"
+
+/*
+ * Glue between the graphics backend (graphics.c or a board's
+ * BOARD_CUSTOM_BOOTMENU_GRAPHICS) and the retained display list.
+ * Not part of the public minui API.
+ */
+
+// half-open screen rectangle: [left, right) x [top, bottom)
+struct gr_rect {
+    int left;
+    int top;
+    int right;
+    int bottom;
+};
+
+// implemented by the backend
+struct UiColor gr_get_color(void);
+int gr_getfont(void);
+void gr_set_clip(const struct gr_rect *clip);
+void gr_prepare_damage(const struct gr_rect *rects, int count);
+// move the pixels of area - dy to area, after gr_prepare_damage()
+void gr_scroll_rect(const struct gr_rect *area, int dy);
+void gr_flip_damage(const struct gr_rect *rects, int count);
+// changes each time an offscreen surface is drawn into, 0 for the others
+unsigned gr_surface_generation(gr_surface surface);
+// copy the page on screen into an offscreen surface of its size, returns
+// the bytes of the surface or -1
+int gr_save_screen(gr_surface surface);
+// the page on screen, not drawn into until the next flip
+gr_surface gr_capture_surface(void);
+
+// implemented by capture.c, around the changes of the page on screen:
+// the rows of rects changed (all of them if NULL).
+void gr_capture_changing(void);
+void gr_capture_changed(const struct gr_rect *rects, int count);
+
+// implemented by render_stats.c
+void gr_make_parent_dir(const char *path);
+
+// implemented by the backend: 1 if the ops of the screen can be replayed
+// from several threads at once, each one in its own rows
+int gr_raster_ready(void);
+
+// implemented by raster.c, the pool of threads rasterizing the bands of
+// a frame on SMP boards (GR_PARALLEL_RASTER). gr_raster_worker() is the
+// index of the calling thread in the pool, 0 outside of it.
+#define GR_RASTER_MAX_THREADS 4
+int gr_raster_start(int threads);
+void gr_raster_stop(void);
+int gr_raster_threads(void);
+int gr_raster_worker(void);
+int gr_raster_busy(void);
+void gr_raster_run(int count, void (*fn)(int job, void *data), void *data);
+
+// implemented by displaylist.c, the primitives record instead of
+// rasterizing while a frame is open.
+int gr_dl_recording(void);
+void gr_dl_fill(int x1, int y1, int x2, int y2);
+void gr_dl_line(int ax, int ay, int bx, int by, int width);
+void gr_dl_text(int x, int y, const char *s, int minx, int maxx, int miny, int maxy);
+void gr_dl_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy);
+
+// screens kept by the page cache of the display list
+struct gr_page_stats {
+    unsigned pages;
+    unsigned bytes;
+    unsigned hits;      // pages shown again from their kept screen
+    unsigned misses;    // drawn again
+};
+void gr_frame_page_stats(struct gr_page_stats *st);
+
+// headless backend (graphics_mem.c), the mode must be set before gr_init()
+struct gr_mem_stats {
+    unsigned long long written; // bytes stored into the screen and layers
+    unsigned long long read;    // bytes read back by blending, and from blit sources
+    unsigned frames;            // flips
+};
+int gr_mem_set_mode(int width, int height, int format);
+void gr_mem_get_stats(struct gr_mem_stats *stats, int reset);
+
+#endif /* _MINUI_GRAPHICS_INTERNAL_H_ */
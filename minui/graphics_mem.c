@@ -0,0 +1,689 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Headless graphics backend
+ *
+ * The minui graphics API over a plain memory surface, rasterized with the
+ * span kernels only: no framebuffer, no tty and no pixelflinger. It can
+ * replace graphics.c on a board with
+ *
+ *   BOARD_CUSTOM_BOOTMENU_GRAPHICS := graphics_mem.c
+ *
+ * and is used on the host by bench_render. The size and pixel format are
+ * set by gr_mem_set_mode() before gr_init(), 480x854 RGB_565 by default.
+ * The bytes read and written by the primitives are counted.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pixelflinger/pixelflinger.h>
+
+#include "minui.h"
+#include "graphics_internal.h"
+#include "spans.h"
+#include "font_10x18.h"
+#include "roboto_15x24.h"
+
+static struct UiFont FONTS[3];
+
+struct gr_font {
+    const struct CFont *cfont;
+    GRFont font;
+    struct span_font spans;
+};
+static struct gr_font gr_fonts[3];
+static struct gr_font *gr_font_slots[3];
+
+static int gr_width = 480;
+static int gr_height = 854;
+static int gr_format = GGL_PIXEL_FORMAT_RGB_565;
+static int gr_bpp = 2;
+
+static GGLSurface gr_screen;
+static GGLSurface *gr_draw = &gr_screen;
+
+// raster state, one per thread of the raster pool
+struct gr_state {
+    struct UiColor color;
+    struct span_color span_color;
+    struct gr_rect clip;
+    int clip_enabled;
+    int font;
+};
+static struct gr_state gr_states[GR_RASTER_MAX_THREADS];
+static int gr_fonts_expanded = 0;
+
+static struct gr_mem_stats gr_stats;
+
+// offscreen surfaces, the generation changes each time one is drawn into
+#define MAX_SURFACES 8
+static struct {
+    GGLSurface *surface;
+    unsigned generation;
+} gr_surfaces[MAX_SURFACES];
+static unsigned gr_generation = 0;
+static GGLSurface *gr_target = NULL;
+static int gr_target_x = 0;
+static int gr_target_y = 0;
+
+static int format_bpp(int format)
+{
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        return 2;
+    case GGL_PIXEL_FORMAT_RGBA_8888:
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        return 4;
+    }
+    return 0;
+}
+
+int gr_mem_set_mode(int width, int height, int format)
+{
+    if (width <= 0 || height <= 0 || !span_supported(format))
+        return -1;
+    if (gr_screen.data != NULL)
+        return -1;
+
+    gr_width = width;
+    gr_height = height;
+    gr_format = format;
+    gr_bpp = format_bpp(format);
+    return 0;
+}
+
+void gr_mem_get_stats(struct gr_mem_stats *stats, int reset)
+{
+    if (stats)
+        *stats = gr_stats;
+    if (reset)
+        memset(&gr_stats, 0, sizeof(gr_stats));
+}
+
+static inline struct gr_state *gr_state(void)
+{
+    return &gr_states[gr_raster_worker()];
+}
+
+// bytes read, counted from all the threads of the raster pool
+static inline void gr_count_read(unsigned long long bytes)
+{
+    __sync_fetch_and_add(&gr_stats.read, bytes);
+}
+
+// a w x h rect of the draw surface is stored, and read first if blended
+static inline void gr_count(int w, int h, int blend)
+{
+    unsigned long long bytes = (unsigned long long) w * h * gr_bpp;
+
+    __sync_fetch_and_add(&gr_stats.written, bytes);
+    if (blend)
+        gr_count_read(bytes);
+}
+
+static inline int gr_recording(void)
+{
+    return gr_target == NULL && gr_dl_recording();
+}
+
+static inline int gr_target_bound(int v, int origin)
+{
+    if (v < 0)
+        return v;
+    return v > origin ? v - origin : 0;
+}
+
+static int gr_find_surface(const GGLSurface *surface)
+{
+    int i;
+
+    for (i = 0; i < MAX_SURFACES; i++) {
+        if (surface && gr_surfaces[i].surface == surface)
+            return i;
+    }
+    return -1;
+}
+
+// Sources whose pixels are copied as they are: the offscreen surfaces,
+// and the images in the draw format without alpha (as the opaque ones of
+// the asset pack) drawn with an opaque color.
+static int gr_blit_copies(const GGLSurface *src)
+{
+    if (src->format != gr_draw->format)
+        return 0;
+    if (gr_find_surface(src) >= 0)
+        return 1;
+    return gr_state()->color.a == 255
+        && (src->format == GGL_PIXEL_FORMAT_RGB_565 || src->format == GGL_PIXEL_FORMAT_RGBX_8888);
+}
+
+static int gr_clip_rect(int *x1, int *y1, int *x2, int *y2)
+{
+    struct gr_state *st = gr_state();
+    int left = 0, top = 0;
+    int right = gr_draw->width, bottom = gr_draw->height;
+
+    if (st->clip_enabled) {
+        if (st->clip.left > left) left = st->clip.left;
+        if (st->clip.top > top) top = st->clip.top;
+        if (st->clip.right < right) right = st->clip.right;
+        if (st->clip.bottom < bottom) bottom = st->clip.bottom;
+    }
+    if (*x1 < left) *x1 = left;
+    if (*y1 < top) *y1 = top;
+    if (*x2 > right) *x2 = right;
+    if (*y2 > bottom) *y2 = bottom;
+
+    return *x1 < *x2 && *y1 < *y2;
+}
+
+static int gr_clip_blit(const GGLSurface *src, int *sx, int *sy, int *w, int *h,
+                        int *dx, int *dy)
+{
+    int x1 = *dx, y1 = *dy, x2 = *dx + *w, y2 = *dy + *h;
+
+    if (*sx < 0) x1 -= *sx;
+    if (*sy < 0) y1 -= *sy;
+    if (*sx + *w > (int) src->width) x2 -= *sx + *w - src->width;
+    if (*sy + *h > (int) src->height) y2 -= *sy + *h - src->height;
+
+    if (!gr_clip_rect(&x1, &y1, &x2, &y2))
+        return 0;
+
+    *sx += x1 - *dx;
+    *sy += y1 - *dy;
+    *dx = x1;
+    *dy = y1;
+    *w = x2 - x1;
+    *h = y2 - y1;
+    return 1;
+}
+
+int gr_fb_test(void)
+{
+    return 0;
+}
+
+// drawn in place: changes can only be bracketed for the display list
+void gr_flip(void)
+{
+    gr_capture_changing();
+    gr_stats.frames++;
+    gr_capture_changed(NULL, 0);
+}
+
+// flips are instant
+int gr_flip_delay(void)
+{
+    return 0;
+}
+
+void gr_prepare_damage(const struct gr_rect *rects, int count)
+{
+    // one surface, always up to date, drawn from now on
+    gr_capture_changing();
+}
+
+void gr_scroll_rect(const struct gr_rect *area, int dy)
+{
+    int w = area->right - area->left, h = area->bottom - area->top;
+
+    span_copy_rect(gr_draw, area->left, area->top, gr_draw, area->left, area->top - dy, w, h);
+    gr_count(w, h, 1);
+}
+
+void gr_flip_damage(const struct gr_rect *rects, int count)
+{
+    gr_stats.frames++;
+    gr_capture_changed(rects, count);
+}
+
+// all the primitives are span kernels, the glyphs are only expanded
+// before, span_text() would do it from several threads
+int gr_raster_ready(void)
+{
+    int i;
+
+    if (gr_target != NULL)
+        return 0;
+    if (!gr_fonts_expanded) {
+        for (i = 0; i < 3; i++) {
+            if (gr_fonts[i].cfont)
+                span_font_expand(&gr_fonts[i].spans);
+        }
+        gr_fonts_expanded = 1;
+    }
+    return 1;
+}
+
+void gr_set_clip(const struct gr_rect *clip)
+{
+    struct gr_state *st = gr_state();
+
+    if (clip == NULL) {
+        st->clip_enabled = 0;
+        return;
+    }
+    st->clip = *clip;
+    st->clip_enabled = 1;
+}
+
+void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    struct gr_state *st = gr_state();
+
+    span_set_color(&st->span_color, gr_format, r, g, b, a);
+    st->color = gr_make_uicolor(r, g, b, a);
+}
+
+struct UiColor gr_get_color(void) {
+    return gr_state()->color;
+}
+
+void gr_set_uicolor(struct UiColor c) {
+    gr_color(c.r, c.g, c.b, c.a);
+}
+
+struct UiColor gr_make_uicolor(unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+    struct UiColor c = {r, g, b, a};
+    return c;
+}
+
+int gr_measure(const char *s)
+{
+    return FONTS[gr_state()->font].gr_font->cwidth * strlen(s);
+}
+
+void gr_font_size(int *x, int *y)
+{
+    struct gr_state *st = gr_state();
+
+    if (FONTS[st->font].gr_font != NULL) {
+        *x = FONTS[st->font].gr_font->cwidth;
+        *y = FONTS[st->font].gr_font->cheight;
+    }
+}
+
+int gr_text(int x, int y, const char *s)
+{
+    return gr_text_cut(x,y,s,-1,-1,-1,-1);
+}
+
+int gr_text_cut(int _x, int _y, const char *s, int minx, int maxx, int miny, int maxy) {
+    struct gr_state *st = gr_state();
+    GRFont *font = FONTS[st->font].gr_font;
+    int end = _x + font->cwidth * strlen(s);
+    int left, top, right, bottom;
+
+    if (gr_recording()) {
+        gr_dl_text(_x, _y, s, minx, maxx, miny, maxy);
+        return end;
+    }
+
+    _x -= gr_target_x;
+    _y -= gr_target_y + font->ascent;
+    minx = gr_target_bound(minx, gr_target_x);
+    maxx = gr_target_bound(maxx, gr_target_x);
+    miny = gr_target_bound(miny, gr_target_y);
+    maxy = gr_target_bound(maxy, gr_target_y);
+
+    // the box of the string, so that only what is drawn is counted
+    left = minx >= 0 && minx > _x ? minx : _x;
+    top = miny >= 0 && miny > _y ? miny : _y;
+    right = _x + font->cwidth * strlen(s);
+    bottom = _y + font->cheight;
+    if (maxx >= 0 && maxx < right) right = maxx;
+    if (maxy >= 0 && maxy < bottom) bottom = maxy;
+
+    if (gr_clip_rect(&left, &top, &right, &bottom)) {
+        span_text(gr_draw, &gr_font_slots[st->font]->spans, _x, _y, s,
+                  left, top, right, bottom, &st->span_color);
+        gr_count(right - left, bottom - top, st->span_color.a != 255);
+    }
+    return end;
+}
+
+void gr_fill(int x, int y, int w, int h)
+{
+    struct gr_state *st = gr_state();
+
+    if (gr_recording()) {
+        gr_dl_fill(x, y, w, h);
+        return;
+    }
+
+    x -= gr_target_x;
+    w -= gr_target_x;
+    y -= gr_target_y;
+    h -= gr_target_y;
+
+    if (gr_clip_rect(&x, &y, &w, &h)) {
+        span_fill_rect(gr_draw, x, y, w - x, h - y, &st->span_color);
+        gr_count(w - x, h - y, st->span_color.a != 255);
+    }
+}
+
+static void gr_fill_span(int x1, int y1, int x2, int y2)
+{
+    struct gr_state *st = gr_state();
+
+    if (gr_clip_rect(&x1, &y1, &x2, &y2)) {
+        span_fill_rect(gr_draw, x1, y1, x2 - x1, y2 - y1, &st->span_color);
+        gr_count(x2 - x1, y2 - y1, st->span_color.a != 255);
+    }
+}
+
+void gr_drawLine(int ax, int ay, int bx, int by, int width)
+{
+    int w = width ? abs(width) : 1;
+    int dx, dy, steps, i;
+
+    if (gr_recording()) {
+        gr_dl_line(ax, ay, bx, by, width);
+        return;
+    }
+
+    ax -= gr_target_x;
+    bx -= gr_target_x;
+    ay -= gr_target_y;
+    by -= gr_target_y;
+
+    // same pixels as pixelflinger for axis aligned lines
+    if (ay == by) {
+        int y1 = ay - (w + 1) / 2;
+        gr_fill_span(ax < bx ? ax : bx, y1, ax < bx ? bx : ax, y1 + w);
+        return;
+    }
+    if (ax == bx) {
+        int x1 = ax - (w + 1) / 2;
+        gr_fill_span(x1, ay < by ? ay : by, x1 + w, ay < by ? by : ay);
+        return;
+    }
+
+    // others, a run of width pixels across the major axis at each step
+    dx = bx - ax;
+    dy = by - ay;
+    steps = abs(dx) > abs(dy) ? abs(dx) : abs(dy);
+    for (i = 0; i < steps; i++) {
+        int x = ax + dx * i / steps;
+        int y = ay + dy * i / steps;
+        if (abs(dx) > abs(dy))
+            gr_fill_span(x, y - (w + 1) / 2, x + 1, y - (w + 1) / 2 + w);
+        else
+            gr_fill_span(x - (w + 1) / 2, y, x - (w + 1) / 2 + w, y + 1);
+    }
+}
+
+void gr_drawRect(int ax, int ay, int bx, int by, int width)
+{
+    gr_drawLine(ax, ay, bx, ay, width); //top
+    gr_drawLine(bx-abs(width/2)-((width % 2)?1:0), ay, bx-abs(width/2)-((width % 2)?1:0), by, width); //right
+    gr_drawLine(bx, by-abs(width/2), ax, by-abs(width/2), width); //bottom
+    gr_drawLine(ax+abs(width/2), by, ax+abs(width/2), ay, width); //left
+}
+
+void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy) {
+    struct gr_state *st = gr_state();
+    GGLSurface *src = (GGLSurface*) source;
+    int src_bpp;
+
+    if (gr_recording()) {
+        gr_dl_blit(source, sx, sy, w, h, dx, dy);
+        return;
+    }
+
+    dx -= gr_target_x;
+    dy -= gr_target_y;
+
+    if (src == NULL || !gr_clip_blit(src, &sx, &sy, &w, &h, &dx, &dy))
+        return;
+
+    if (gr_blit_copies(src)) {
+        span_copy_rect(gr_draw, dx, dy, src, sx, sy, w, h);
+        gr_count(w, h, 0);
+        gr_count_read((unsigned long long) w * h * gr_bpp);
+        return;
+    }
+
+    if (span_blit_rect(gr_draw, dx, dy, src, sx, sy, w, h, &st->span_color) < 0)
+        return;
+
+    src_bpp = src->format == GGL_PIXEL_FORMAT_A_8 ? 1 : 4;
+    gr_count(w, h, 1);
+    gr_count_read((unsigned long long) w * h * src_bpp);
+}
+
+unsigned int gr_get_width(gr_surface surface) {
+    if (surface == NULL) {
+        return 0;
+    }
+    return ((GGLSurface*) surface)->width;
+}
+
+unsigned int gr_get_height(gr_surface surface) {
+    if (surface == NULL) {
+        return 0;
+    }
+    return ((GGLSurface*) surface)->height;
+}
+
+gr_surface gr_create_surface(int width, int height)
+{
+    GGLSurface *s;
+    int i;
+
+    if (width <= 0 || height <= 0)
+        return NULL;
+
+    for (i = 0; i < MAX_SURFACES && gr_surfaces[i].surface; i++) {}
+    if (i == MAX_SURFACES)
+        return NULL;
+
+    s = calloc(1, sizeof(GGLSurface) + width * height * gr_bpp);
+    if (s == NULL)
+        return NULL;
+
+    s->version = sizeof(*s);
+    s->width = width;
+    s->height = height;
+    s->stride = width;
+    s->data = (unsigned char*) (s + 1);
+    s->format = gr_format;
+
+    gr_surfaces[i].surface = s;
+    gr_surfaces[i].generation = ++gr_generation;
+    return (gr_surface) s;
+}
+
+void gr_free_surface(gr_surface surface)
+{
+    int i = gr_find_surface(surface);
+
+    if (i < 0)
+        return;
+    if (gr_target == surface)
+        gr_set_target(NULL, 0, 0);
+
+    free(gr_surfaces[i].surface);
+    gr_surfaces[i].surface = NULL;
+}
+
+void gr_set_target(gr_surface surface, int x, int y)
+{
+    int i = gr_find_surface(gr_target);
+
+    if (i >= 0)
+        gr_surfaces[i].generation = ++gr_generation;
+
+    if (gr_find_surface(surface) < 0) {
+        surface = NULL;
+        x = y = 0;
+    }
+    gr_target = surface;
+    gr_target_x = x;
+    gr_target_y = y;
+    gr_draw = gr_target ? gr_target : &gr_screen;
+}
+
+gr_surface gr_capture_surface(void)
+{
+    return (gr_surface) &gr_screen;
+}
+
+unsigned gr_surface_generation(gr_surface surface)
+{
+    int i = gr_find_surface(surface);
+
+    return i >= 0 ? gr_surfaces[i].generation : 0;
+}
+
+int gr_save_screen(gr_surface surface)
+{
+    GGLSurface *dst = (GGLSurface*) surface;
+    int i = gr_find_surface(dst);
+
+    if (i < 0 || dst->width != gr_screen.width || dst->height != gr_screen.height)
+        return -1;
+
+    memcpy(dst->data, gr_screen.data, gr_screen.width * gr_screen.height * gr_bpp);
+    gr_surfaces[i].generation = ++gr_generation;
+    gr_count(gr_screen.width, gr_screen.height, 0);
+    gr_count_read((unsigned long long) gr_screen.width * gr_screen.height * gr_bpp);
+    return dst->stride * dst->height * gr_bpp;
+}
+
+static struct UiFont gr_init_font(int slot, const struct CFont *font_p)
+{
+    struct UiFont uifont;
+    struct gr_font *f = NULL;
+    int i;
+
+    for (i = 0; i < 3; i++) {
+        if (gr_fonts[i].cfont == font_p || gr_fonts[i].cfont == NULL) {
+            f = &gr_fonts[i];
+            break;
+        }
+    }
+
+    if (f->cfont == NULL) {
+        memset(f, 0, sizeof(*f));
+        f->cfont = font_p;
+        f->font.cwidth = font_p->cwidth;
+        f->font.cheight = font_p->cheight;
+        f->font.ascent = font_p->cheight - 2;
+        span_font_init(&f->spans, font_p);
+    }
+
+    gr_font_slots[slot] = f;
+    uifont.cfont = font_p;
+    uifont.gr_font = &f->font;
+    return uifont;
+}
+
+int gr_init(void)
+{
+    gr_screen.version = sizeof(gr_screen);
+    gr_screen.width = gr_width;
+    gr_screen.height = gr_height;
+    gr_screen.stride = gr_width;
+    gr_screen.format = gr_format;
+    gr_screen.data = calloc(gr_width * gr_height, gr_bpp);
+    if (gr_screen.data == NULL) {
+        perror("unable to allocate the screen");
+        return -1;
+    }
+
+    FONTS[FONT_HEAD] = gr_init_font(FONT_HEAD, &bigfont);
+    FONTS[FONT_ITEM] = gr_init_font(FONT_ITEM, &bigfont);
+    FONTS[FONT_LOGS] = gr_init_font(FONT_LOGS, &font);
+
+    gr_draw = &gr_screen;
+    gr_frame_invalidate();
+    memset(&gr_stats, 0, sizeof(gr_stats));
+
+    fprintf(stderr, "framebuffer: memory (%d x %d)\n", gr_width, gr_height);
+
+#ifdef GR_PARALLEL_RASTER
+    gr_raster_start(sysconf(_SC_NPROCESSORS_CONF));
+#endif
+    return 0;
+}
+
+void gr_exit(void)
+{
+    int i;
+
+    gr_capture_stop();
+    gr_raster_stop();
+    gr_frame_free();
+
+    for (i = 0; i < MAX_SURFACES; i++)
+        gr_free_surface(gr_surfaces[i].surface);
+
+    for (i = 0; i < 3; i++) {
+        span_font_free(&gr_fonts[i].spans);
+        memset(&gr_fonts[i], 0, sizeof(gr_fonts[i]));
+        gr_font_slots[i] = NULL;
+        FONTS[i].gr_font = NULL;
+    }
+    gr_fonts_expanded = 0;
+
+    free(gr_screen.data);
+    gr_screen.data = NULL;
+}
+
+int gr_fb_width(void)
+{
+    return gr_screen.width;
+}
+
+int gr_fb_height(void)
+{
+    return gr_screen.height;
+}
+
+gr_pixel *gr_fb_data(void)
+{
+    return (unsigned short *) gr_draw->data;
+}
+
+void gr_fb_blank(bool blank)
+{
+}
+
+void gr_setfont(int i) {
+    gr_state()->font = i;
+}
+
+int gr_getfont(void) {
+    return gr_state()->font;
+}
+
+int gr_getfont_cwidth() {
+    return FONTS[gr_state()->font].gr_font->cwidth;
+}
+
+int gr_getfont_cheight() {
+    return FONTS[gr_state()->font].gr_font->cheight;
+}
+
+int gr_getfont_cheightfix() {
+    return FONTS[gr_state()->font].cfont->cheightfix;
+}
@@ -18,6 +18,7 @@
 #define _MINUI_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <pixelflinger/pixelflinger.h>
 
 #ifdef __cplusplus
@@ -43,6 +44,33 @@ gr_pixel *gr_fb_data(void);
 void gr_flip(void);
 void gr_fb_blank(bool blank);
 
+// Retained display list: the draw calls made between gr_frame_begin()
+// and gr_frame_end() are recorded and compared to the previous frame,
+// only the damaged areas are rasterized and flipped. gr_frame_end()
+// returns the number of damaged rects, 0 if the frame was unchanged,
+// -1 if it was skipped because the previous one is not on screen yet:
+// it must be drawn again after gr_flip_delay() milliseconds.
+void gr_frame_begin(void);
+int gr_frame_end(void);
+int gr_flip_delay(void);
+// the screen content was lost, repaint everything on next frame
+void gr_frame_invalidate(void);
+void gr_frame_free(void);
+// The ops drawn between gr_frame_list_begin() and gr_frame_list_end()
+// are a scrollable list. When it only moved by dy since the previous
+// frame and covers x1,y1-x2,y2 (new position) opaquely in both frames,
+// gr_frame_list_scroll() lets gr_frame_end() move these pixels and only
+// draw the exposed rows. The list must look the same on both sides of
+// x1-x2 in both frames.
+void gr_frame_list_begin(void);
+void gr_frame_list_end(void);
+void gr_frame_list_scroll(int x1, int y1, int x2, int y2, int dy);
+// The frame drawn after gr_frame_page(page) belongs to that page (a tab),
+// 0 to GR_FRAME_PAGES - 1. The screen of a page left is kept while memory
+// allows: when the page is shown again, only what changed since is drawn.
+#define GR_FRAME_PAGES 3
+void gr_frame_page(int page);
+
 void gr_color(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
 void gr_set_uicolor(struct UiColor c);
 struct UiColor gr_make_uicolor(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
@@ -57,6 +85,16 @@ void gr_font_size(int *x, int *y);
 void gr_blit(gr_surface source, int sx, int sy, int w, int h, int dx, int dy);
 unsigned int gr_get_width(gr_surface surface);
 unsigned int gr_get_height(gr_surface surface);
+
+// Offscreen surfaces in the pixel format of the screen, created cleared
+// to black. Between gr_set_target(surface, x, y) and gr_set_target(NULL,
+// 0, 0) the primitives draw into the surface, its top left corner being
+// (x, y) of the screen, and are never recorded in the display list.
+// Blitting one is a plain copy: everything drawn into it must be opaque.
+gr_surface gr_create_surface(int width, int height);
+void gr_free_surface(gr_surface surface);
+void gr_set_target(gr_surface surface, int x, int y);
+
 void gr_setfont(int i);
 int gr_getfont_cwidth();
 int gr_getfont_cheight();
@@ -67,21 +105,71 @@ int gr_getfont_cheightfix();
 // see http://www.mjmwired.net/kernel/Documentation/input/ for info.
 struct input_event;
 
-int ev_init(void);
+typedef int (*ev_callback)(int fd, uint32_t epevents, void *data);
+
+// Input devices and other fds (timers...) are watched by a single epoll
+// loop: ev_wait() then ev_dispatch() calls the callback of each ready fd.
+int ev_init(ev_callback input_cb, void *data);
 void ev_exit(void);
-int ev_get(struct input_event *ev, unsigned dont_wait);
+int ev_add_fd(int fd, ev_callback cb, void *data);
+int ev_wait(int timeout);
+void ev_dispatch(void);
+// from the callback of an input device, until it returns -1: the first
+// call reads the events waiting, 0 is an event to handle, 1 one to skip
+int ev_get_input(int fd, uint32_t epevents, struct input_event *ev);
+// without the loop: the first of codes held or pressed, 0 after timeout ms,
+// any key newly pressed if count is 0
+int ev_wait_key(const int *codes, int count, int timeout);
+int ev_key_held(int code);
 
 // Resources
 #ifndef RES_IMAGES_FOLDER
 #define RES_IMAGES_FOLDER "/system/bootmenu/images"
 #endif
+// images pre-converted by mkassets, the png files are only decoded
+// without it
+#ifndef RES_ASSET_PACK
+#define RES_ASSET_PACK RES_IMAGES_FOLDER "/assets.bin"
+#endif
 
-// Returns 0 if no error, else negative.
+// Returns 0 if no error, else negative. The surfaces of the asset pack
+// point into its read-only mapping, and are shared by all the callers
+// asking for the same image.
 int res_create_surface(const char* name, gr_surface* pSurface);
 void res_free_surface(gr_surface* pSurface);
 
 int gr_fb_test(void);
 
+// Render statistics: histograms of the frame timings, kept by the display
+// list. Percentiles are in microseconds.
+enum {
+    GR_STAT_DRAW,       // recording and rasterizing a frame
+    GR_STAT_FLIP,       // showing it
+    GR_STAT_FRAME,      // both
+    GR_STAT_INTERVAL,   // between two flips of an animation
+    GR_STAT_COUNT
+};
+uint64_t gr_stats_now(void);
+void gr_stats_add(int stat, uint64_t ns);
+void gr_stats_flipped(uint64_t now);
+void gr_stats_skipped(unsigned frames);
+unsigned gr_stats_percentile(int stat, unsigned pct);
+unsigned gr_stats_fps(void);
+void gr_stats_reset(void);
+int gr_stats_dump(const char *path);
+
+// Screen capture. The snapshot is a png of the screen as shown. The stream
+// is served to one client at a time on a unix socket: a header, then at most
+// CAPTURE_FPS frames per second, each one made of the rectangles that changed
+// since the previous one, run-length encoded (see capture.c). Capturing never
+// delays the drawing: it reads the shown page from its own thread. The
+// socket is only served between gr_capture_start() and gr_capture_stop().
+#define GR_CAPTURE_SOCKET "/tmp/bootmenu-capture"
+int gr_capture_snapshot(const char *path);
+int gr_capture_start(const char *socket_path);
+void gr_capture_stop(void);
+int gr_capture_started(void);
+
 typedef struct {
   GGLSurface texture;
   unsigned cwidth;
@@ -89,20 +177,30 @@ typedef struct {
   unsigned ascent;
 } GRFont;
 
+// Packed font, as generated by mkfont: 96 glyphs (' ' to 127), each one
+// is its bounding box in the cwidth x cheight cell and the 1bpp rows of
+// that box at bits[offset], (w + 7) / 8 bytes per row, msb first.
+#define CFONT_GLYPHS 96
+
+struct CGlyph {
+  unsigned char x;
+  unsigned char y;
+  unsigned char w;
+  unsigned char h;
+  unsigned short offset;
+};
+
 struct CFont {
-  unsigned width;
-  unsigned height;
   unsigned cwidth;
   unsigned cheight;
   unsigned cheightfix;
-  unsigned char rundata[];
+  struct CGlyph glyphs[CFONT_GLYPHS];
+  unsigned char bits[];
 };
 
 struct UiFont {
-  struct CFont *cfont;
+  const struct CFont *cfont;
   GRFont *gr_font;
-  void * gr_fontmem;
-  unsigned char rundata[];
 };
 
 #define FONT_HEAD 0
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Packs png images into the asset pack of asset_pack.h, with the pixels
+ * converted to the format of the board: the bootmenu maps the pack and
+ * blits straight from it, without any decoding at startup.
+ *
+ *   mkassets -f RGB_565|RGBA_8888|RGBX_8888|BGRA_8888 -o assets.bin image.png...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <png.h>
+#include <pixelflinger/pixelflinger.h>
+
+#include "asset_pack.h"
+
+struct image {
+    char name[ASSET_NAME_MAX];
+    unsigned width;
+    unsigned height;
+    unsigned char *rgba;
+    int opaque;
+};
+
+static const struct {
+    const char *name;
+    int format;
+} formats[] = {
+    { "RGB_565",   GGL_PIXEL_FORMAT_RGB_565 },
+    { "RGBA_8888", GGL_PIXEL_FORMAT_RGBA_8888 },
+    { "RGBX_8888", GGL_PIXEL_FORMAT_RGBX_8888 },
+    { "BGRA_8888", GGL_PIXEL_FORMAT_BGRA_8888 },
+};
+
+// decode any 8 bits png to rgba rows
+static int load_png(const char *path, struct image *img)
+{
+    png_structp png_ptr = NULL;
+    png_infop info_ptr = NULL;
+    unsigned char header[8];
+    const char *base, *dot;
+    unsigned y, len;
+    FILE *fp;
+    int result = -1;
+
+    base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    dot = strrchr(base, '.');
+    len = dot ? (unsigned) (dot - base) : strlen(base);
+    if (len == 0 || len >= ASSET_NAME_MAX) {
+        fprintf(stderr, "%s: bad image name\n", path);
+        return -1;
+    }
+    memset(img, 0, sizeof(*img));
+    memcpy(img->name, base, len);
+
+    fp = fopen(path, "rb");
+    if (fp == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    if (fread(header, 1, sizeof(header), fp) != sizeof(header)
+     || png_sig_cmp(header, 0, sizeof(header))) {
+        fprintf(stderr, "%s: not a png\n", path);
+        goto exit;
+    }
+
+    png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (png_ptr == NULL)
+        goto exit;
+    info_ptr = png_create_info_struct(png_ptr);
+    if (info_ptr == NULL)
+        goto exit;
+    if (setjmp(png_jmpbuf(png_ptr))) {
+        fprintf(stderr, "%s: decoding failed\n", path);
+        goto exit;
+    }
+
+    png_init_io(png_ptr, fp);
+    png_set_sig_bytes(png_ptr, sizeof(header));
+    png_read_info(png_ptr, info_ptr);
+
+    // palette, gray and tRNS to rgba
+    png_set_expand(png_ptr);
+    png_set_strip_16(png_ptr);
+    png_set_gray_to_rgb(png_ptr);
+    png_set_filler(png_ptr, 0xff, PNG_FILLER_AFTER);
+    png_read_update_info(png_ptr, info_ptr);
+
+    img->width = png_get_image_width(png_ptr, info_ptr);
+    img->height = png_get_image_height(png_ptr, info_ptr);
+    if (png_get_rowbytes(png_ptr, info_ptr) != img->width * 4) {
+        fprintf(stderr, "%s: unsupported png\n", path);
+        goto exit;
+    }
+
+    img->rgba = malloc(img->width * img->height * 4);
+    if (img->rgba == NULL)
+        goto exit;
+    for (y = 0; y < img->height; y++)
+        png_read_row(png_ptr, img->rgba + y * img->width * 4, NULL);
+
+    img->opaque = 1;
+    for (y = 0; y < img->width * img->height; y++) {
+        if (img->rgba[y * 4 + 3] != 0xff) {
+            img->opaque = 0;
+            break;
+        }
+    }
+    result = 0;
+
+exit:
+    if (png_ptr)
+        png_destroy_read_struct(&png_ptr, info_ptr ? &info_ptr : NULL, NULL);
+    fclose(fp);
+    return result;
+}
+
+// format an image is stored in for a board format: opaque images are
+// copied to the screen, the others are blended from 8888
+static int image_format(const struct image *img, int board)
+{
+    if (board == GGL_PIXEL_FORMAT_BGRA_8888)
+        return GGL_PIXEL_FORMAT_BGRA_8888;
+    if (!img->opaque)
+        return GGL_PIXEL_FORMAT_RGBA_8888;
+    if (board == GGL_PIXEL_FORMAT_RGB_565)
+        return GGL_PIXEL_FORMAT_RGB_565;
+    return GGL_PIXEL_FORMAT_RGBX_8888;
+}
+
+static void convert(const struct image *img, int format, unsigned char *out)
+{
+    const unsigned char *p = img->rgba;
+    unsigned i, n = img->width * img->height;
+
+    for (i = 0; i < n; i++, p += 4) {
+        switch (format) {
+        case GGL_PIXEL_FORMAT_RGB_565: {
+            unsigned v = ((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3);
+            *out++ = v & 0xff;
+            *out++ = v >> 8;
+            break;
+        }
+        case GGL_PIXEL_FORMAT_BGRA_8888:
+            *out++ = p[2];
+            *out++ = p[1];
+            *out++ = p[0];
+            *out++ = p[3];
+            break;
+        default:
+            memcpy(out, p, 4);
+            out += 4;
+            break;
+        }
+    }
+}
+
+static void put32(unsigned char *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static int write_pack(const char *path, struct image *images, unsigned count, int board)
+{
+    unsigned index_size = sizeof(struct asset_pack_header) + count * sizeof(struct asset_pack_entry);
+    unsigned char *index, *p;
+    unsigned offset, i;
+    FILE *fp;
+
+    index = calloc(1, index_size);
+    if (index == NULL)
+        return -1;
+
+    fp = fopen(path, "wb");
+    if (fp == NULL) {
+        perror(path);
+        free(index);
+        return -1;
+    }
+
+    put32(index, ASSET_PACK_MAGIC);
+    put32(index + 4, ASSET_PACK_VERSION);
+    put32(index + 8, count);
+
+    // index first, the pixels are written after it
+    fseek(fp, index_size, SEEK_SET);
+    offset = index_size;
+    p = index + sizeof(struct asset_pack_header);
+    for (i = 0; i < count; i++, p += sizeof(struct asset_pack_entry)) {
+        struct image *img = &images[i];
+        int format = image_format(img, board);
+        unsigned bpp = format == GGL_PIXEL_FORMAT_RGB_565 ? 2 : 4;
+        unsigned size = img->width * img->height * bpp;
+        unsigned char *pixels;
+
+        while (offset % ASSET_ALIGN) {
+            fputc(0, fp);
+            offset++;
+        }
+
+        pixels = malloc(size);
+        if (pixels == NULL)
+            goto fail;
+        convert(img, format, pixels);
+        if (fwrite(pixels, 1, size, fp) != size) {
+            free(pixels);
+            goto fail;
+        }
+        free(pixels);
+
+        memcpy(p, img->name, ASSET_NAME_MAX);
+        put32(p + ASSET_NAME_MAX, img->width);
+        put32(p + ASSET_NAME_MAX + 4, img->height);
+        put32(p + ASSET_NAME_MAX + 8, img->width);
+        put32(p + ASSET_NAME_MAX + 12, format);
+        put32(p + ASSET_NAME_MAX + 16, offset);
+        put32(p + ASSET_NAME_MAX + 20, size);
+        offset += size;
+
+        fprintf(stderr, "%-24s %4ux%-4u %s\n", img->name, img->width, img->height,
+                format == GGL_PIXEL_FORMAT_RGB_565 ? "RGB_565" :
+                format == GGL_PIXEL_FORMAT_RGBX_8888 ? "RGBX_8888" :
+                format == GGL_PIXEL_FORMAT_BGRA_8888 ? "BGRA_8888" : "RGBA_8888");
+    }
+
+    fseek(fp, 0, SEEK_SET);
+    if (fwrite(index, 1, index_size, fp) != index_size)
+        goto fail;
+    free(index);
+    return fclose(fp) == 0 ? 0 : -1;
+
+fail:
+    perror(path);
+    free(index);
+    fclose(fp);
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = NULL;
+    struct image *images;
+    unsigned count = 0, f;
+    int board = -1;
+    int i;
+
+    images = calloc(argc, sizeof(*images));
+    if (images == NULL)
+        return 1;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+            i++;
+            // accept the quoted values of TARGET_RECOVERY_PIXEL_FORMAT
+            for (f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+                if (strstr(argv[i], formats[f].name))
+                    board = formats[f].format;
+            }
+        } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            output = argv[++i];
+        } else if (argv[i][0] == '-') {
+            output = NULL;
+            break;
+        } else {
+            if (load_png(argv[i], &images[count]) < 0)
+                return 1;
+            count++;
+        }
+    }
+
+    if (output == NULL || board < 0) {
+        fprintf(stderr, "usage: %s -f RGB_565|RGBA_8888|RGBX_8888|BGRA_8888"
+                        " -o assets.bin image.png...\n", argv[0]);
+        return 1;
+    }
+
+    if (write_pack(output, images, count, board) < 0) {
+        unlink(output);
+        return 1;
+    }
+    return 0;
+}
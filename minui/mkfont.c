@@ -1,3 +1,15 @@
+/*
+ * Converts a font image exported by gimp as C source (ExportedFont.h) into
+ * the packed CFont format of minui.h.
+ *
+ * The image holds the 96 glyphs from ' ' to 127 side by side, black on
+ * white. Each glyph is stored as its bounding box in the cell and the 1bpp
+ * rows of that box, so blank rows and columns take no space.
+ *
+ *   mkfont [name [cheightfix]] > font.h
+ */
+
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -6,48 +18,95 @@ typedef unsigned char guint8;
 
 #include "ExportedFont.h"
 
-int main(int argc, char **argv)
+#define GLYPHS 96
+
+struct box {
+    unsigned x, y, w, h, offset;
+};
+
+static void emit_font(const char *name, const unsigned char *pixels,
+                      unsigned width, unsigned height, unsigned bpp,
+                      unsigned cheightfix)
 {
-    unsigned n;
-    unsigned char *x;
-    unsigned m;
-    unsigned run_val;
-    unsigned run_count;
-
-    n = gimp_image.width * gimp_image.height;
-    m = 0;
-    x = gimp_image.pixel_data;
-
-    printf("struct CFont font = {\n");
-    printf("  .width = %d,\n  .height = %d,\n  .cwidth = %d,\n  .cheight = %d,\n  .cheightfix = 0,\n", gimp_image.width, gimp_image.height,
-           gimp_image.width / 96, gimp_image.height);
-    printf("  .rundata = {\n");
-
-    run_val = (*x ? 0 : 255);
-    run_count = 1;
-    n--;
-    x+=3;
-
-    while(n-- > 0) {
-        unsigned val = (*x ? 0 : 255);
-        x+=3;
-        if((val == run_val) && (run_count < 127)) {
-            run_count++;
-        } else {
-eject:
-            printf("0x%02x,",run_count | (run_val ? 0x80 : 0x00));
-            run_val = val;
-            run_count = 1;
-            m += 5;
-            if(m >= 75) {
-                printf("\n");
-                m = 0;
+    unsigned cwidth = width / GLYPHS;
+    unsigned cheight = height;
+    struct box boxes[GLYPHS];
+    unsigned char *bits;
+    unsigned nbits = 0;
+    unsigned g, x, y, m;
+
+    // worst case, no blank at all
+    bits = calloc(GLYPHS * cheight * ((cwidth + 7) / 8) + 1, 1);
+    if (bits == NULL)
+        exit(1);
+
+    for (g = 0; g < GLYPHS; g++) {
+        unsigned minx = cwidth, miny = cheight, maxx = 0, maxy = 0;
+        struct box *b = &boxes[g];
+
+        for (y = 0; y < cheight; y++) {
+            for (x = 0; x < cwidth; x++) {
+                if (pixels[(y * width + g * cwidth + x) * bpp] == 0) {
+                    if (x < minx) minx = x;
+                    if (x > maxx) maxx = x;
+                    if (y < miny) miny = y;
+                    if (y > maxy) maxy = y;
+                }
             }
         }
+
+        b->offset = nbits;
+        if (minx > maxx) {
+            b->x = b->y = b->w = b->h = 0;
+            continue;
+        }
+        b->x = minx;
+        b->y = miny;
+        b->w = maxx - minx + 1;
+        b->h = maxy - miny + 1;
+
+        // rows of (w + 7) / 8 bytes, msb first
+        for (y = 0; y < b->h; y++) {
+            for (x = 0; x < b->w; x++) {
+                unsigned px = g * cwidth + b->x + x;
+                unsigned py = b->y + y;
+                if (pixels[(py * width + px) * bpp] == 0)
+                    bits[nbits + x / 8] |= 0x80 >> (x % 8);
+            }
+            nbits += (b->w + 7) / 8;
+        }
+    }
+
+    printf("static const struct CFont %s = {\n", name);
+    printf("  .cwidth = %u,\n  .cheight = %u,\n  .cheightfix = %u,\n",
+           cwidth, cheight, cheightfix);
+    printf("  .glyphs = {\n");
+    for (g = 0; g < GLYPHS; g++) {
+        struct box *b = &boxes[g];
+        printf("    { %2u, %2u, %2u, %2u, %5u },", b->x, b->y, b->w, b->h, b->offset);
+        if (isprint(g + 32))
+            printf(" /* '%c' */\n", g + 32);
+        else
+            printf(" /* 0x%02x */\n", g + 32);
+    }
+    printf("  },\n");
+    printf("  .bits = {\n");
+    for (m = 0; m < nbits; m++) {
+        printf("0x%02x,", bits[m]);
+        if (m % 15 == 14 || m == nbits - 1)
+            printf("\n");
     }
-    printf("0x%02x,",run_count | (run_val ? 0x80 : 0x00));
-    printf("\n0x00,");
-    printf("\n");
     printf("  }\n};\n");
+
+    free(bits);
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = argc > 1 ? argv[1] : "font";
+    unsigned cheightfix = argc > 2 ? atoi(argv[2]) : 0;
+
+    emit_font(name, gimp_image.pixel_data, gimp_image.width, gimp_image.height,
+              gimp_image.bytes_per_pixel, cheightfix);
     return 0;
 }
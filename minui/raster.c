@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Parallel raster pool
+ *
+ * On SMP boards the damage of a large frame is cut into horizontal bands
+ * by the display list, and the bands are rasterized by the calling thread
+ * and a few workers, each one pinned to another core. gr_raster_run()
+ * returns once all the bands are drawn, before the flip.
+ *
+ * The bands are taken in order from a shared counter, a worker which got
+ * cheap ones takes more. Each thread of the pool has its own index: the
+ * backends keep their raster state (color, font, clip) per index, 0 being
+ * the one of all the threads outside of the pool.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "minui.h"
+#include "graphics_internal.h"
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+
+static pthread_t workers[GR_RASTER_MAX_THREADS];
+static int thread_count = 1;
+static int stopping = 0;
+
+static pthread_key_t worker_key;
+static pthread_once_t worker_key_once = PTHREAD_ONCE_INIT;
+
+// current run, workers start it when the generation changes
+static unsigned generation = 0;
+static int pending = 0;
+static volatile int busy = 0;
+static void (*job_fn)(int job, void *data);
+static void *job_data;
+static int job_count;
+static int job_next;
+
+static void make_worker_key(void)
+{
+    pthread_key_create(&worker_key, NULL);
+}
+
+static void run_jobs(void)
+{
+    int job;
+
+    while ((job = __sync_fetch_and_add(&job_next, 1)) < job_count)
+        job_fn(job, job_data);
+}
+
+static void *worker_thread(void *arg)
+{
+    int index = (int) (intptr_t) arg;
+    long cpus = sysconf(_SC_NPROCESSORS_CONF);
+    unsigned seen = 0;
+    cpu_set_t set;
+
+    pthread_setspecific(worker_key, arg);
+
+    // the caller keeps its core, core 0 on most boards
+    if (cpus > 1) {
+        CPU_ZERO(&set);
+        CPU_SET(index % cpus, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) < 0)
+            perror("raster worker affinity");
+    }
+
+    pthread_mutex_lock(&pool_mutex);
+    for (;;) {
+        while (!stopping && seen == generation)
+            pthread_cond_wait(&work_cond, &pool_mutex);
+        if (stopping)
+            break;
+        seen = generation;
+        pthread_mutex_unlock(&pool_mutex);
+
+        run_jobs();
+
+        pthread_mutex_lock(&pool_mutex);
+        if (--pending == 0)
+            pthread_cond_signal(&done_cond);
+    }
+    pthread_mutex_unlock(&pool_mutex);
+    return NULL;
+}
+
+// start threads - 1 workers, returns the count of threads rasterizing
+int gr_raster_start(int threads)
+{
+    int i;
+
+    if (thread_count > 1)
+        return thread_count;
+    if (threads > GR_RASTER_MAX_THREADS)
+        threads = GR_RASTER_MAX_THREADS;
+
+    pthread_once(&worker_key_once, make_worker_key);
+    stopping = 0;
+    for (i = 1; i < threads; i++) {
+        if (pthread_create(&workers[i], NULL, worker_thread, (void*) (intptr_t) i)) {
+            perror("raster worker");
+            break;
+        }
+    }
+    thread_count = i;
+    return thread_count;
+}
+
+void gr_raster_stop(void)
+{
+    int i;
+
+    if (thread_count < 2)
+        return;
+
+    pthread_mutex_lock(&pool_mutex);
+    stopping = 1;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    for (i = 1; i < thread_count; i++)
+        pthread_join(workers[i], NULL);
+    thread_count = 1;
+}
+
+int gr_raster_threads(void)
+{
+    return thread_count;
+}
+
+int gr_raster_worker(void)
+{
+    if (thread_count < 2)
+        return 0;
+    return (int) (intptr_t) pthread_getspecific(worker_key);
+}
+
+int gr_raster_busy(void)
+{
+    return busy;
+}
+
+// fn(job, data) for each job in [0, count), returns when all are done
+void gr_raster_run(int count, void (*fn)(int job, void *data), void *data)
+{
+    int i;
+
+    if (thread_count < 2 || count < 2) {
+        for (i = 0; i < count; i++)
+            fn(i, data);
+        return;
+    }
+
+    pthread_mutex_lock(&pool_mutex);
+    job_fn = fn;
+    job_data = data;
+    job_count = count;
+    job_next = 0;
+    pending = thread_count - 1;
+    busy = 1;
+    generation++;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&pool_mutex);
+
+    run_jobs();
+
+    pthread_mutex_lock(&pool_mutex);
+    while (pending > 0)
+        pthread_cond_wait(&done_cond, &pool_mutex);
+    busy = 0;
+    pthread_mutex_unlock(&pool_mutex);
+}
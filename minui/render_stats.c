@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Render statistics
+ *
+ * Fixed size histograms of the draw, flip and total time of the frames
+ * and of their interval, in microseconds. The buckets are log-linear: 16 per power of
+ * two, so every value is known within 1/16 of itself, from 1us to ~1s,
+ * in a few hundred counters and without any allocation.
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "minui.h"
+#include "graphics_internal.h"
+
+#define SUB_BUCKETS 16
+#define BUCKETS     (18 * SUB_BUCKETS)
+
+// longer intervals are pauses between animations, not frames
+#define MAX_FRAME_INTERVAL_US 250000
+
+// flips remembered for the current fps
+#define FPS_WINDOW 128
+
+struct histogram {
+    unsigned count[BUCKETS];
+    unsigned total;
+    unsigned max;
+};
+
+static const char *stat_names[GR_STAT_COUNT] = {
+    "draw", "flip", "frame", "interval",
+};
+
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct histogram hists[GR_STAT_COUNT];
+static unsigned frames_skipped = 0;
+static uint64_t flip_times[FPS_WINDOW];
+static unsigned flip_count = 0;
+
+static unsigned bucket_of(unsigned us)
+{
+    unsigned e = 0;
+
+    if (us < SUB_BUCKETS)
+        return us;
+    while ((us >> e) >= 2 * SUB_BUCKETS)
+        e++;
+    if (e + 1 >= BUCKETS / SUB_BUCKETS)
+        return BUCKETS - 1;
+    return (e + 1) * SUB_BUCKETS + (us >> e) - SUB_BUCKETS;
+}
+
+// lowest value of a bucket
+static unsigned bucket_value(unsigned b)
+{
+    if (b < SUB_BUCKETS)
+        return b;
+    return (b % SUB_BUCKETS + SUB_BUCKETS) << (b / SUB_BUCKETS - 1);
+}
+
+uint64_t gr_stats_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void hist_add(struct histogram *h, unsigned us)
+{
+    h->count[bucket_of(us)]++;
+    h->total++;
+    if (us > h->max)
+        h->max = us;
+}
+
+static unsigned hist_percentile(const struct histogram *h, unsigned pct)
+{
+    unsigned rank, seen = 0, b;
+
+    if (h->total == 0)
+        return 0;
+
+    rank = (h->total * pct + 99) / 100;
+    if (rank == 0)
+        rank = 1;
+    for (b = 0; b < BUCKETS; b++) {
+        seen += h->count[b];
+        if (seen >= rank)
+            return b == BUCKETS - 1 ? h->max : bucket_value(b);
+    }
+    return h->max;
+}
+
+void gr_stats_add(int stat, uint64_t ns)
+{
+    if (stat < 0 || stat >= GR_STAT_COUNT)
+        return;
+
+    pthread_mutex_lock(&stats_mutex);
+    hist_add(&hists[stat], ns / 1000);
+    pthread_mutex_unlock(&stats_mutex);
+}
+
+void gr_stats_flipped(uint64_t now)
+{
+    pthread_mutex_lock(&stats_mutex);
+    if (flip_count > 0) {
+        uint64_t last = flip_times[(flip_count - 1) % FPS_WINDOW];
+        unsigned us = (now - last) / 1000;
+        if (us < MAX_FRAME_INTERVAL_US)
+            hist_add(&hists[GR_STAT_INTERVAL], us);
+    }
+    flip_times[flip_count % FPS_WINDOW] = now;
+    flip_count++;
+    pthread_mutex_unlock(&stats_mutex);
+}
+
+void gr_stats_skipped(unsigned frames)
+{
+    pthread_mutex_lock(&stats_mutex);
+    frames_skipped += frames;
+    pthread_mutex_unlock(&stats_mutex);
+}
+
+unsigned gr_stats_percentile(int stat, unsigned pct)
+{
+    unsigned us;
+
+    if (stat < 0 || stat >= GR_STAT_COUNT)
+        return 0;
+
+    pthread_mutex_lock(&stats_mutex);
+    us = hist_percentile(&hists[stat], pct);
+    pthread_mutex_unlock(&stats_mutex);
+    return us;
+}
+
+// flips during the last second
+unsigned gr_stats_fps(void)
+{
+    uint64_t now = gr_stats_now();
+    unsigned i, n = 0;
+
+    pthread_mutex_lock(&stats_mutex);
+    for (i = 0; i < FPS_WINDOW && i < flip_count; i++) {
+        if (now - flip_times[(flip_count - 1 - i) % FPS_WINDOW] > 1000000000ULL)
+            break;
+        n++;
+    }
+    pthread_mutex_unlock(&stats_mutex);
+    return n;
+}
+
+void gr_stats_reset(void)
+{
+    pthread_mutex_lock(&stats_mutex);
+    memset(hists, 0, sizeof(hists));
+    frames_skipped = 0;
+    flip_count = 0;
+    pthread_mutex_unlock(&stats_mutex);
+}
+
+// create the parent directory of path if needed
+void gr_make_parent_dir(const char *path)
+{
+    char dir[PATH_MAX];
+    char *slash;
+
+    strncpy(dir, path, sizeof(dir) - 1);
+    dir[sizeof(dir) - 1] = '\0';
+    slash = strrchr(dir, '/');
+    if (slash == NULL || slash == dir)
+        return;
+    *slash = '\0';
+    if (mkdir(dir, 0755) < 0 && errno != EEXIST)
+        perror(dir);
+}
+
+int gr_stats_dump(const char *path)
+{
+    struct gr_page_stats pages;
+    FILE *f;
+    int s;
+    unsigned b;
+
+    gr_make_parent_dir(path);
+    f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+
+    pthread_mutex_lock(&stats_mutex);
+
+    fprintf(f, "# times in microseconds\n");
+    fprintf(f, "frames %u\n", flip_count);
+    fprintf(f, "skipped %u\n", frames_skipped);
+    gr_frame_page_stats(&pages);
+    fprintf(f, "page cache pages %u bytes %u hits %u misses %u\n",
+            pages.pages, pages.bytes, pages.hits, pages.misses);
+    for (s = 0; s < GR_STAT_COUNT; s++) {
+        const struct histogram *h = &hists[s];
+        fprintf(f, "%s count %u p50 %u p90 %u p99 %u max %u\n", stat_names[s], h->total,
+                hist_percentile(h, 50), hist_percentile(h, 90), hist_percentile(h, 99), h->max);
+    }
+
+    // non empty buckets, by their lowest value
+    for (s = 0; s < GR_STAT_COUNT; s++) {
+        fprintf(f, "\n%s histogram\n", stat_names[s]);
+        for (b = 0; b < BUCKETS; b++) {
+            if (hists[s].count[b])
+                fprintf(f, "%u %u\n", bucket_value(b), hists[s].count[b]);
+        }
+    }
+
+    pthread_mutex_unlock(&stats_mutex);
+
+    fclose(f);
+    return 0;
+}
@@ -15,11 +15,13 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <linux/fb.h>
 #include <linux/kd.h>
@@ -27,6 +29,7 @@
 #include <png.h>
 
 #include "minui.h"
+#include "asset_pack.h"
 
 // libpng gives "undefined reference to 'pow'" errors, and I have no
 // idea how to convince the build system to link with -lm.  We don't
@@ -36,7 +39,99 @@ double pow(double x, double y) {
     return x;
 }
 
-int res_create_surface(const char* name, gr_surface* pSurface) {
+// the asset pack, mapped on first use and unmapped with its last surface
+static struct {
+    const unsigned char *map;
+    size_t size;
+    const struct asset_pack_entry *entries;
+    GGLSurface *surfaces;
+    unsigned count;
+    unsigned refs;
+    int missing;
+} pack;
+
+static void res_pack_close(void) {
+    if (pack.map)
+        munmap((void*) pack.map, pack.size);
+    free(pack.surfaces);
+    memset(&pack, 0, sizeof(pack));
+}
+
+static int res_pack_open(void) {
+    const struct asset_pack_header *header;
+    struct stat st;
+    unsigned i;
+    void *map;
+    int fd;
+
+    if (pack.map)
+        return 0;
+    if (pack.missing)
+        return -1;
+
+    fd = open(RES_ASSET_PACK, O_RDONLY);
+    if (fd < 0) {
+        // no pack, the png files are decoded
+        pack.missing = 1;
+        return -1;
+    }
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t) sizeof(*header)) {
+        close(fd);
+        goto bad;
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror(RES_ASSET_PACK);
+        pack.missing = 1;
+        return -1;
+    }
+
+    pack.map = map;
+    pack.size = st.st_size;
+    header = map;
+    if (header->magic != ASSET_PACK_MAGIC || header->version != ASSET_PACK_VERSION
+     || header->count > (pack.size - sizeof(*header)) / sizeof(struct asset_pack_entry))
+        goto bad;
+
+    pack.count = header->count;
+    pack.entries = (const struct asset_pack_entry*) (header + 1);
+    pack.surfaces = calloc(pack.count, sizeof(GGLSurface));
+    if (pack.surfaces == NULL)
+        goto bad;
+
+    for (i = 0; i < pack.count; i++) {
+        const struct asset_pack_entry *e = &pack.entries[i];
+        GGLSurface *surface = &pack.surfaces[i];
+        unsigned bpp = e->format == GGL_PIXEL_FORMAT_RGB_565 ? 2 : 4;
+
+        if (e->name[ASSET_NAME_MAX - 1] != '\0' || e->width > e->stride
+         || e->offset % ASSET_ALIGN || e->offset > pack.size || e->size > pack.size - e->offset
+         || (uint64_t) e->stride * e->height * bpp > e->size)
+            goto bad;
+
+        surface->version = sizeof(GGLSurface);
+        surface->width = e->width;
+        surface->height = e->height;
+        surface->stride = e->stride;
+        surface->format = e->format;
+        // never written to, the mapping is read-only
+        surface->data = (GGLubyte*) (pack.map + e->offset);
+    }
+    return 0;
+
+bad:
+    fprintf(stderr, "%s: bad asset pack, using the png files\n", RES_ASSET_PACK);
+    res_pack_close();
+    pack.missing = 1;
+    return -1;
+}
+
+static int res_pack_surface(const GGLSurface *surface) {
+    return pack.surfaces && surface >= pack.surfaces && surface < pack.surfaces + pack.count;
+}
+
+static int res_decode_png(const char* name, gr_surface* pSurface) {
     char resPath[256];
     GGLSurface* surface = NULL;
     int result = 0;
@@ -182,6 +277,21 @@ exit:
     return result;
 }
 
+int res_create_surface(const char* name, gr_surface* pSurface) {
+    unsigned i;
+
+    if (res_pack_open() == 0) {
+        for (i = 0; i < pack.count; i++) {
+            if (!strcmp(pack.entries[i].name, name)) {
+                pack.refs++;
+                *pSurface = (gr_surface) &pack.surfaces[i];
+                return 0;
+            }
+        }
+    }
+    return res_decode_png(name, pSurface);
+}
+
 void res_free_surface(gr_surface* pSurface) {
     GGLSurface* surface;
     if (pSurface && *pSurface) {
@@ -197,8 +307,12 @@ void res_free_surface(gr_surface* pSurface) {
         //ui_print("pSurface ptr     = %x\n", (unsigned) pSurface);
 #endif
 
-        //doesnt works :(
-        //free(surface);
+        if (res_pack_surface(surface)) {
+            if (--pack.refs == 0)
+                res_pack_close();
+        } else {
+            free(surface);
+        }
 
         *pSurface=NULL;
     }
@@ -1,192 +1,174 @@
-struct CFont font = {
-  .width = 960,
-  .height = 18,
+static const struct CFont font = {
   .cwidth = 10,
   .cheight = 18,
   .cheightfix = 0,
-  .rundata = {
-0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,
-0x3b,0x81,0x29,0x81,0x06,0x81,0x3f,0x81,0x7f,0x7f,0x7f,0x37,0x83,0x05,0x81,
-0x0a,0x83,0x7f,0x7f,0x2f,0x81,0x0e,0x81,0x29,0x82,0x07,0x81,0x01,0x82,0x07,
-0x81,0x02,0x81,0x05,0x83,0x05,0x82,0x0a,0x82,0x09,0x82,0x09,0x81,0x08,0x81,
-0x3e,0x81,0x05,0x84,0x06,0x84,0x06,0x83,0x06,0x84,0x09,0x82,0x05,0x85,0x06,
-0x84,0x04,0x87,0x04,0x84,0x07,0x84,0x39,0x83,0x06,0x84,0x07,0x81,0x06,0x86,
-0x06,0x84,0x04,0x86,0x04,0x87,0x04,0x87,0x04,0x84,0x04,0x82,0x04,0x82,0x03,
-0x86,0x08,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x07,0x82,0x05,0x82,0x02,0x82,
-0x05,0x81,0x04,0x84,0x04,0x86,0x06,0x84,0x04,0x86,0x06,0x84,0x04,0x88,0x02,
-0x82,0x05,0x81,0x01,0x82,0x06,0x81,0x01,0x81,0x07,0x81,0x02,0x81,0x05,0x82,
-0x02,0x82,0x04,0x82,0x02,0x87,0x06,0x81,0x07,0x82,0x0b,0x81,0x08,0x81,0x12,
-0x82,0x10,0x82,0x18,0x82,0x10,0x83,0x0d,0x82,0x0b,0x82,0x08,0x82,0x06,0x82,
-0x09,0x83,0x4c,0x82,0x48,0x81,0x07,0x82,0x07,0x81,0x28,0x82,0x07,0x81,0x01,
-0x82,0x07,0x81,0x02,0x81,0x04,0x82,0x01,0x82,0x03,0x81,0x02,0x81,0x08,0x81,
-0x02,0x81,0x08,0x82,0x08,0x82,0x08,0x82,0x3c,0x82,0x04,0x82,0x02,0x82,0x04,
-0x85,0x05,0x82,0x01,0x82,0x04,0x82,0x02,0x82,0x07,0x83,0x05,0x85,0x05,0x82,
-0x02,0x81,0x09,0x82,0x03,0x82,0x02,0x82,0x05,0x82,0x02,0x82,0x37,0x82,0x01,
-0x82,0x04,0x81,0x03,0x82,0x06,0x82,0x05,0x82,0x03,0x82,0x04,0x83,0x01,0x82,
-0x03,0x82,0x03,0x82,0x03,0x82,0x09,0x82,0x08,0x82,0x02,0x82,0x03,0x82,0x04,
-0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x07,0x82,0x05,0x82,
-0x02,0x82,0x05,0x81,0x03,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x02,
-0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x06,0x82,0x05,0x82,0x05,0x81,
-0x02,0x81,0x05,0x82,0x01,0x81,0x07,0x81,0x02,0x82,0x04,0x81,0x03,0x82,0x04,
-0x82,0x07,0x82,0x06,0x81,0x08,0x81,0x0b,0x81,0x07,0x82,0x13,0x81,0x10,0x82,
-0x18,0x82,0x0f,0x84,0x0d,0x82,0x1d,0x82,0x0a,0x82,0x4c,0x82,0x47,0x82,0x07,
-0x82,0x07,0x82,0x27,0x82,0x07,0x81,0x01,0x82,0x06,0x81,0x02,0x81,0x04,0x82,
-0x03,0x82,0x02,0x81,0x02,0x81,0x02,0x81,0x04,0x82,0x02,0x82,0x08,0x81,0x08,
-0x81,0x0a,0x81,0x12,0x82,0x28,0x81,0x05,0x81,0x04,0x81,0x07,0x82,0x04,0x82,
-0x03,0x82,0x03,0x81,0x04,0x81,0x07,0x83,0x05,0x81,0x08,0x82,0x0c,0x82,0x04,
-0x81,0x04,0x82,0x04,0x81,0x04,0x81,0x36,0x82,0x03,0x81,0x03,0x81,0x05,0x82,
-0x04,0x83,0x05,0x82,0x04,0x81,0x03,0x83,0x03,0x82,0x02,0x82,0x04,0x82,0x02,
-0x82,0x09,0x82,0x07,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,
-0x03,0x82,0x02,0x82,0x04,0x82,0x07,0x83,0x03,0x83,0x02,0x83,0x04,0x81,0x02,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x81,
-0x03,0x82,0x04,0x81,0x06,0x82,0x05,0x82,0x05,0x81,0x02,0x81,0x05,0x82,0x01,
-0x82,0x02,0x81,0x02,0x82,0x03,0x82,0x02,0x82,0x04,0x81,0x03,0x82,0x08,0x81,
-0x07,0x81,0x08,0x81,0x0b,0x81,0x07,0x83,0x13,0x81,0x0f,0x82,0x18,0x82,0x0e,
-0x82,0x10,0x82,0x1d,0x82,0x0a,0x82,0x4c,0x82,0x47,0x81,0x08,0x82,0x08,0x81,
-0x27,0x82,0x07,0x81,0x01,0x81,0x05,0x88,0x02,0x82,0x07,0x81,0x02,0x81,0x01,
-0x82,0x05,0x81,0x02,0x81,0x08,0x81,0x08,0x82,0x0a,0x82,0x07,0x81,0x09,0x82,
-0x27,0x82,0x04,0x82,0x04,0x82,0x06,0x82,0x0a,0x81,0x08,0x81,0x06,0x81,0x01,
-0x82,0x05,0x81,0x08,0x82,0x0c,0x81,0x05,0x81,0x04,0x82,0x04,0x81,0x04,0x81,
-0x05,0x82,0x08,0x82,0x2a,0x81,0x03,0x81,0x02,0x81,0x03,0x81,0x04,0x81,0x01,
-0x82,0x04,0x82,0x04,0x81,0x03,0x82,0x04,0x82,0x02,0x82,0x05,0x81,0x02,0x82,
-0x09,0x82,0x07,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,
-0x82,0x02,0x81,0x05,0x82,0x07,0x83,0x03,0x83,0x02,0x84,0x03,0x81,0x02,0x82,
-0x05,0x81,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,
-0x82,0x0b,0x82,0x05,0x82,0x05,0x81,0x02,0x82,0x04,0x81,0x03,0x81,0x02,0x82,
-0x01,0x82,0x04,0x81,0x01,0x82,0x05,0x82,0x01,0x82,0x08,0x82,0x07,0x81,0x08,
-0x82,0x0a,0x81,0x06,0x82,0x01,0x81,0x1a,0x85,0x04,0x82,0x01,0x83,0x06,0x84,
-0x06,0x83,0x01,0x82,0x04,0x84,0x06,0x82,0x07,0x85,0x04,0x82,0x01,0x83,0x06,
-0x83,0x08,0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x05,0x81,0x01,0x82,0x01,0x82,
-0x03,0x82,0x01,0x84,0x05,0x84,0x04,0x82,0x01,0x83,0x06,0x83,0x01,0x82,0x03,
-0x82,0x01,0x84,0x04,0x84,0x04,0x86,0x04,0x82,0x04,0x82,0x02,0x82,0x04,0x81,
-0x02,0x82,0x06,0x81,0x02,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x03,0x86,0x07,
-0x81,0x08,0x82,0x08,0x81,0x27,0x82,0x11,0x81,0x02,0x81,0x05,0x82,0x06,0x84,
-0x01,0x81,0x06,0x83,0x12,0x82,0x0a,0x82,0x05,0x81,0x01,0x81,0x01,0x81,0x07,
-0x82,0x27,0x81,0x05,0x82,0x04,0x82,0x06,0x82,0x09,0x82,0x07,0x82,0x05,0x82,
-0x01,0x82,0x04,0x85,0x05,0x81,0x01,0x83,0x08,0x82,0x06,0x81,0x02,0x82,0x05,
-0x81,0x04,0x81,0x05,0x82,0x08,0x82,0x0a,0x83,0x04,0x86,0x04,0x82,0x0c,0x82,
-0x02,0x81,0x02,0x81,0x01,0x81,0x02,0x81,0x04,0x81,0x01,0x82,0x04,0x82,0x03,
-0x82,0x03,0x82,0x08,0x82,0x05,0x81,0x02,0x82,0x09,0x82,0x07,0x81,0x09,0x82,
-0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x01,0x82,0x05,0x82,0x07,0x84,0x02,
-0x83,0x02,0x82,0x01,0x81,0x03,0x81,0x02,0x82,0x05,0x81,0x02,0x82,0x04,0x82,
-0x02,0x81,0x06,0x81,0x02,0x82,0x03,0x82,0x04,0x82,0x0a,0x82,0x05,0x82,0x05,
-0x81,0x03,0x81,0x03,0x82,0x03,0x81,0x01,0x81,0x01,0x81,0x01,0x81,0x05,0x83,
-0x07,0x84,0x07,0x82,0x08,0x81,0x09,0x81,0x0a,0x81,0x06,0x81,0x02,0x81,0x19,
-0x82,0x02,0x83,0x03,0x83,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x83,
-0x03,0x82,0x02,0x82,0x04,0x85,0x04,0x83,0x01,0x83,0x03,0x83,0x02,0x82,0x06,
-0x82,0x08,0x82,0x06,0x82,0x02,0x81,0x07,0x82,0x05,0x82,0x01,0x82,0x01,0x82,
-0x02,0x83,0x03,0x82,0x03,0x82,0x02,0x82,0x03,0x83,0x02,0x82,0x04,0x82,0x02,
-0x83,0x03,0x83,0x03,0x81,0x03,0x82,0x02,0x82,0x04,0x82,0x07,0x82,0x04,0x82,
-0x03,0x81,0x03,0x82,0x02,0x82,0x02,0x82,0x02,0x81,0x03,0x82,0x02,0x81,0x05,
-0x81,0x04,0x82,0x07,0x81,0x08,0x81,0x08,0x82,0x08,0x81,0x27,0x82,0x11,0x81,
-0x02,0x81,0x06,0x83,0x08,0x81,0x07,0x82,0x13,0x82,0x0a,0x82,0x05,0x85,0x04,
-0x88,0x23,0x82,0x05,0x82,0x04,0x82,0x06,0x82,0x08,0x82,0x06,0x83,0x06,0x81,
-0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x07,0x81,0x08,0x83,0x06,
-0x82,0x02,0x82,0x19,0x83,0x11,0x83,0x09,0x82,0x03,0x81,0x01,0x81,0x02,0x81,
-0x02,0x81,0x03,0x82,0x02,0x81,0x04,0x86,0x04,0x82,0x08,0x82,0x05,0x81,0x02,
-0x86,0x05,0x86,0x03,0x81,0x09,0x88,0x05,0x82,0x0a,0x82,0x03,0x84,0x06,0x82,
-0x07,0x82,0x01,0x81,0x01,0x81,0x01,0x82,0x02,0x82,0x01,0x82,0x02,0x81,0x02,
-0x82,0x05,0x81,0x02,0x82,0x03,0x82,0x03,0x81,0x06,0x81,0x02,0x86,0x06,0x83,
-0x08,0x82,0x05,0x82,0x05,0x81,0x03,0x82,0x02,0x81,0x04,0x81,0x01,0x81,0x01,
-0x81,0x01,0x81,0x06,0x82,0x08,0x82,0x08,0x81,0x09,0x81,0x09,0x82,0x09,0x81,
-0x06,0x81,0x02,0x82,0x1d,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x04,0x81,0x03,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x04,0x82,0x06,0x82,0x03,0x82,0x03,0x82,
-0x04,0x82,0x05,0x82,0x08,0x82,0x06,0x82,0x01,0x81,0x08,0x82,0x05,0x82,0x01,
-0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x02,0x82,0x04,0x82,0x03,0x82,0x08,0x81,0x09,0x82,0x07,0x82,0x04,0x82,0x03,
-0x82,0x02,0x81,0x04,0x81,0x02,0x82,0x02,0x81,0x04,0x81,0x01,0x82,0x05,0x82,
-0x02,0x82,0x07,0x82,0x08,0x81,0x08,0x82,0x08,0x81,0x07,0x83,0x03,0x81,0x19,
-0x82,0x11,0x81,0x02,0x81,0x08,0x82,0x07,0x81,0x01,0x82,0x03,0x82,0x01,0x81,
-0x02,0x82,0x0e,0x81,0x0c,0x81,0x06,0x82,0x06,0x88,0x0d,0x86,0x10,0x81,0x06,
-0x82,0x04,0x82,0x06,0x82,0x07,0x82,0x09,0x82,0x04,0x82,0x02,0x82,0x09,0x82,
-0x03,0x81,0x04,0x82,0x05,0x82,0x06,0x82,0x03,0x81,0x06,0x85,0x18,0x82,0x15,
-0x83,0x06,0x82,0x04,0x81,0x01,0x81,0x02,0x81,0x02,0x81,0x03,0x81,0x03,0x82,
-0x03,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x05,0x81,0x02,0x82,0x09,0x82,0x07,
-0x81,0x03,0x84,0x02,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x01,0x82,
-0x05,0x82,0x07,0x82,0x01,0x81,0x01,0x81,0x01,0x82,0x02,0x82,0x02,0x82,0x01,
-0x81,0x02,0x82,0x05,0x81,0x02,0x86,0x04,0x81,0x06,0x81,0x02,0x82,0x03,0x82,
-0x07,0x82,0x07,0x82,0x05,0x82,0x05,0x81,0x03,0x82,0x02,0x81,0x04,0x83,0x01,
-0x83,0x05,0x83,0x08,0x82,0x07,0x82,0x09,0x81,0x0a,0x81,0x09,0x81,0x25,0x85,
-0x03,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x88,0x04,0x82,0x06,
-0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x08,0x82,0x06,0x84,0x08,0x82,
-0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x08,0x83,0x07,0x82,0x07,0x82,
-0x04,0x82,0x04,0x81,0x02,0x81,0x04,0x81,0x02,0x82,0x02,0x81,0x05,0x82,0x06,
-0x82,0x02,0x82,0x06,0x82,0x07,0x82,0x09,0x82,0x09,0x82,0x04,0x82,0x01,0x82,
-0x01,0x82,0x2a,0x87,0x08,0x82,0x05,0x81,0x01,0x81,0x02,0x81,0x02,0x81,0x02,
-0x82,0x01,0x82,0x0e,0x81,0x0c,0x81,0x05,0x82,0x01,0x82,0x07,0x82,0x26,0x81,
-0x06,0x82,0x04,0x82,0x06,0x82,0x06,0x82,0x0b,0x82,0x03,0x87,0x08,0x82,0x03,
-0x81,0x04,0x82,0x05,0x82,0x06,0x81,0x04,0x82,0x09,0x81,0x18,0x82,0x08,0x86,
-0x08,0x82,0x06,0x82,0x04,0x81,0x01,0x81,0x02,0x81,0x02,0x81,0x03,0x86,0x03,
-0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x05,0x81,0x02,0x82,0x09,0x82,0x07,0x82,
-0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x0a,0x82,0x03,0x82,0x02,0x82,0x04,
-0x82,0x07,0x82,0x01,0x83,0x01,0x82,0x02,0x82,0x03,0x81,0x01,0x81,0x02,0x82,
-0x05,0x81,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x81,0x08,0x82,0x06,
-0x82,0x05,0x82,0x05,0x81,0x04,0x81,0x01,0x82,0x05,0x82,0x02,0x82,0x05,0x81,
-0x01,0x82,0x07,0x82,0x06,0x82,0x0a,0x81,0x0a,0x81,0x09,0x81,0x24,0x82,0x02,
-0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x0a,0x82,
-0x06,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x05,0x82,0x08,0x82,0x06,0x84,0x08,
-0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x0b,0x83,0x04,0x82,0x07,
-0x82,0x04,0x82,0x04,0x81,0x01,0x82,0x04,0x81,0x01,0x81,0x01,0x81,0x01,0x82,
-0x05,0x82,0x07,0x81,0x02,0x82,0x06,0x81,0x0a,0x81,0x08,0x82,0x08,0x81,0x06,
-0x81,0x03,0x83,0x2c,0x81,0x02,0x81,0x05,0x81,0x04,0x82,0x04,0x81,0x02,0x81,
-0x02,0x81,0x01,0x82,0x03,0x83,0x0f,0x82,0x0a,0x82,0x11,0x82,0x25,0x82,0x07,
-0x81,0x04,0x81,0x07,0x82,0x05,0x82,0x07,0x81,0x04,0x82,0x03,0x87,0x03,0x81,
-0x04,0x82,0x03,0x81,0x04,0x82,0x05,0x81,0x07,0x81,0x04,0x82,0x08,0x82,0x19,
-0x84,0x10,0x83,0x0e,0x81,0x01,0x81,0x02,0x81,0x01,0x82,0x02,0x82,0x04,0x81,
-0x03,0x82,0x04,0x82,0x02,0x83,0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x09,
-0x82,0x07,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x05,0x82,0x05,0x81,0x04,0x82,
-0x03,0x82,0x03,0x81,0x04,0x82,0x07,0x82,0x02,0x81,0x02,0x82,0x02,0x82,0x03,
-0x83,0x02,0x82,0x04,0x82,0x02,0x82,0x08,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x02,0x81,0x05,0x81,0x06,0x82,0x05,0x83,0x03,0x82,0x04,0x83,0x06,0x82,0x02,
-0x82,0x04,0x82,0x02,0x81,0x07,0x82,0x06,0x81,0x0b,0x81,0x0a,0x82,0x08,0x81,
-0x23,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x04,0x81,0x03,0x82,0x04,
-0x82,0x02,0x82,0x0a,0x82,0x06,0x82,0x03,0x82,0x03,0x82,0x04,0x82,0x05,0x82,
-0x08,0x82,0x06,0x82,0x01,0x82,0x07,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x04,0x82,
-0x03,0x82,0x0d,0x81,0x04,0x82,0x07,0x82,0x03,0x83,0x04,0x83,0x06,0x82,0x02,
-0x82,0x05,0x81,0x01,0x82,0x06,0x84,0x06,0x81,0x0b,0x81,0x08,0x82,0x08,0x81,
-0x27,0x82,0x10,0x81,0x02,0x81,0x05,0x82,0x02,0x83,0x04,0x81,0x02,0x81,0x02,
-0x81,0x02,0x81,0x04,0x82,0x0f,0x82,0x0a,0x82,0x11,0x82,0x07,0x82,0x12,0x82,
-0x08,0x81,0x08,0x82,0x02,0x82,0x07,0x82,0x05,0x81,0x08,0x82,0x03,0x81,0x08,
-0x82,0x04,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x06,0x81,0x07,0x82,0x02,0x82,
-0x08,0x82,0x06,0x82,0x08,0x82,0x0b,0x82,0x0e,0x82,0x0a,0x82,0x04,0x81,0x01,
-0x83,0x01,0x82,0x03,0x81,0x05,0x82,0x02,0x82,0x04,0x82,0x03,0x83,0x01,0x82,
-0x03,0x82,0x03,0x82,0x03,0x82,0x09,0x82,0x08,0x82,0x03,0x82,0x02,0x82,0x04,
-0x82,0x05,0x82,0x05,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x03,0x82,0x07,0x82,
-0x05,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,0x82,0x09,0x82,0x02,
-0x82,0x03,0x82,0x04,0x82,0x02,0x82,0x03,0x82,0x06,0x82,0x06,0x82,0x03,0x82,
-0x05,0x82,0x06,0x82,0x02,0x81,0x04,0x82,0x03,0x82,0x06,0x82,0x05,0x82,0x0b,
-0x81,0x0b,0x81,0x08,0x81,0x23,0x82,0x02,0x83,0x03,0x83,0x02,0x82,0x04,0x82,
-0x02,0x82,0x04,0x82,0x02,0x83,0x03,0x82,0x03,0x82,0x04,0x82,0x06,0x83,0x01,
-0x83,0x03,0x82,0x04,0x82,0x05,0x82,0x08,0x82,0x06,0x82,0x02,0x82,0x06,0x82,
-0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x03,
-0x83,0x02,0x82,0x04,0x82,0x02,0x83,0x03,0x82,0x08,0x82,0x02,0x82,0x04,0x82,
-0x03,0x81,0x03,0x83,0x01,0x84,0x05,0x82,0x06,0x82,0x02,0x82,0x04,0x82,0x02,
-0x81,0x07,0x83,0x05,0x82,0x0b,0x81,0x08,0x82,0x08,0x81,0x27,0x82,0x10,0x81,
-0x02,0x81,0x06,0x85,0x09,0x82,0x04,0x84,0x01,0x82,0x0f,0x81,0x0a,0x81,0x1b,
-0x82,0x12,0x82,0x08,0x81,0x09,0x84,0x08,0x82,0x04,0x87,0x04,0x84,0x09,0x82,
-0x05,0x84,0x06,0x84,0x07,0x81,0x08,0x84,0x06,0x84,0x07,0x82,0x08,0x82,0x27,
-0x82,0x04,0x82,0x09,0x81,0x06,0x81,0x02,0x87,0x05,0x84,0x04,0x86,0x04,0x87,
-0x04,0x82,0x09,0x85,0x03,0x82,0x04,0x82,0x03,0x86,0x04,0x84,0x05,0x82,0x04,
-0x82,0x02,0x87,0x02,0x82,0x05,0x82,0x02,0x82,0x05,0x81,0x04,0x84,0x04,0x82,
-0x0a,0x86,0x02,0x82,0x04,0x82,0x03,0x85,0x07,0x82,0x07,0x85,0x06,0x82,0x06,
-0x82,0x02,0x81,0x04,0x82,0x04,0x82,0x05,0x82,0x05,0x87,0x06,0x81,0x0b,0x82,
-0x07,0x81,0x23,0x84,0x01,0x82,0x03,0x82,0x01,0x83,0x06,0x84,0x06,0x83,0x01,
-0x82,0x04,0x85,0x05,0x82,0x07,0x83,0x01,0x82,0x03,0x82,0x04,0x82,0x03,0x86,
-0x06,0x82,0x06,0x82,0x03,0x81,0x04,0x86,0x03,0x82,0x01,0x82,0x01,0x82,0x02,
-0x82,0x04,0x82,0x04,0x84,0x04,0x82,0x01,0x83,0x06,0x83,0x01,0x82,0x03,0x82,
-0x09,0x84,0x06,0x84,0x05,0x84,0x01,0x82,0x05,0x82,0x06,0x81,0x03,0x82,0x03,
-0x82,0x03,0x82,0x07,0x82,0x05,0x86,0x07,0x81,0x08,0x82,0x08,0x81,0x45,0x81,
-0x27,0x81,0x0a,0x81,0x1c,0x81,0x1b,0x82,0x78,0x81,0x2e,0x82,0x7f,0x30,0x82,
-0x5e,0x81,0x0c,0x81,0x07,0x81,0x0f,0x88,0x4d,0x82,0x1a,0x82,0x37,0x82,0x0e,
-0x82,0x4b,0x82,0x13,0x82,0x07,0x82,0x07,0x82,0x45,0x81,0x28,0x81,0x08,0x81,
-0x1c,0x81,0x1c,0x81,0x78,0x81,0x30,0x84,0x7f,0x7f,0x0e,0x83,0x0a,0x81,0x05,
-0x83,0x64,0x82,0x1a,0x82,0x37,0x82,0x0e,0x82,0x4b,0x82,0x14,0x81,0x07,0x82,
-0x07,0x81,0x70,0x81,0x06,0x81,0x7f,0x7f,0x7f,0x7f,0x6e,0x85,0x1a,0x82,0x38,
-0x82,0x0e,0x82,0x4a,0x82,0x16,0x81,0x0e,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,
-0x7f,0x62,
-0x00,
+  .glyphs = {
+    {  0,  0,  0,  0,     0 }, /* ' ' */
+    {  4,  3,  2, 11,     0 }, /* '!' */
+    {  3,  3,  4,  4,    11 }, /* '"' */
+    {  1,  3,  8, 11,    15 }, /* '#' */
+    {  1,  2,  7, 14,    26 }, /* '$' */
+    {  0,  3,  9, 11,    40 }, /* '%' */
+    {  0,  3,  9, 11,    62 }, /* '&' */
+    {  4,  3,  2,  4,    84 }, /* ''' */
+    {  3,  2,  4, 15,    88 }, /* '(' */
+    {  3,  2,  4, 15,   103 }, /* ')' */
+    {  2,  6,  5,  5,   118 }, /* '*' */
+    {  1,  5,  8,  8,   123 }, /* '+' */
+    {  3, 12,  2,  4,   131 }, /* ',' */
+    {  2,  9,  6,  1,   135 }, /* '-' */
+    {  3, 12,  2,  2,   136 }, /* '.' */
+    {  2,  2,  6, 14,   138 }, /* '/' */
+    {  1,  3,  8, 11,   152 }, /* '0' */
+    {  2,  3,  5, 11,   163 }, /* '1' */
+    {  1,  3,  7, 11,   174 }, /* '2' */
+    {  1,  3,  7, 11,   185 }, /* '3' */
+    {  1,  3,  7, 11,   196 }, /* '4' */
+    {  1,  3,  7, 11,   207 }, /* '5' */
+    {  1,  3,  7, 11,   218 }, /* '6' */
+    {  1,  3,  7, 11,   229 }, /* '7' */
+    {  1,  3,  7, 11,   240 }, /* '8' */
+    {  2,  3,  6, 11,   251 }, /* '9' */
+    {  3,  6,  2,  8,   262 }, /* ':' */
+    {  3,  6,  2, 10,   270 }, /* ';' */
+    {  2,  7,  6,  6,   280 }, /* '<' */
+    {  2,  7,  6,  4,   286 }, /* '=' */
+    {  2,  7,  6,  6,   290 }, /* '>' */
+    {  2,  3,  6, 11,   296 }, /* '?' */
+    {  0,  3,  9, 13,   307 }, /* '@' */
+    {  1,  3,  8, 11,   333 }, /* 'A' */
+    {  1,  3,  8, 11,   344 }, /* 'B' */
+    {  1,  3,  8, 11,   355 }, /* 'C' */
+    {  1,  3,  8, 11,   366 }, /* 'D' */
+    {  1,  3,  7, 11,   377 }, /* 'E' */
+    {  2,  3,  7, 11,   388 }, /* 'F' */
+    {  1,  3,  8, 11,   399 }, /* 'G' */
+    {  1,  3,  8, 11,   410 }, /* 'H' */
+    {  2,  3,  6, 11,   421 }, /* 'I' */
+    {  1,  3,  7, 11,   432 }, /* 'J' */
+    {  1,  3,  8, 11,   443 }, /* 'K' */
+    {  1,  3,  7, 11,   454 }, /* 'L' */
+    {  0,  3,  9, 11,   465 }, /* 'M' */
+    {  1,  3,  8, 11,   487 }, /* 'N' */
+    {  1,  3,  8, 11,   498 }, /* 'O' */
+    {  1,  3,  8, 11,   509 }, /* 'P' */
+    {  1,  3,  9, 12,   520 }, /* 'Q' */
+    {  1,  3,  8, 11,   544 }, /* 'R' */
+    {  1,  3,  7, 11,   555 }, /* 'S' */
+    {  1,  3,  8, 11,   566 }, /* 'T' */
+    {  1,  3,  8, 11,   577 }, /* 'U' */
+    {  0,  3,  9, 11,   588 }, /* 'V' */
+    {  0,  3,  9, 11,   610 }, /* 'W' */
+    {  1,  3,  8, 11,   632 }, /* 'X' */
+    {  1,  3,  8, 11,   643 }, /* 'Y' */
+    {  1,  3,  7, 11,   654 }, /* 'Z' */
+    {  4,  2,  3, 14,   665 }, /* '[' */
+    {  2,  2,  6, 14,   679 }, /* '\' */
+    {  3,  2,  3, 14,   693 }, /* ']' */
+    {  2,  3,  5,  6,   707 }, /* '^' */
+    {  1, 14,  8,  1,   713 }, /* '_' */
+    {  3,  3,  3,  3,   714 }, /* '`' */
+    {  1,  6,  7,  8,   717 }, /* 'a' */
+    {  1,  3,  8, 11,   725 }, /* 'b' */
+    {  1,  6,  7,  8,   736 }, /* 'c' */
+    {  1,  3,  8, 11,   744 }, /* 'd' */
+    {  1,  6,  8,  8,   755 }, /* 'e' */
+    {  2,  3,  6, 11,   763 }, /* 'f' */
+    {  1,  6,  7, 11,   774 }, /* 'g' */
+    {  1,  3,  8, 11,   785 }, /* 'h' */
+    {  2,  3,  6, 11,   796 }, /* 'i' */
+    {  3,  3,  3, 14,   807 }, /* 'j' */
+    {  2,  3,  6, 11,   821 }, /* 'k' */
+    {  2,  3,  6, 11,   832 }, /* 'l' */
+    {  1,  6,  8,  8,   843 }, /* 'm' */
+    {  1,  6,  8,  8,   851 }, /* 'n' */
+    {  1,  6,  8,  8,   859 }, /* 'o' */
+    {  1,  6,  8, 11,   867 }, /* 'p' */
+    {  1,  6,  8, 11,   878 }, /* 'q' */
+    {  2,  6,  7,  8,   889 }, /* 'r' */
+    {  2,  6,  6,  8,   897 }, /* 's' */
+    {  1,  3,  7, 11,   905 }, /* 't' */
+    {  1,  6,  8,  8,   916 }, /* 'u' */
+    {  1,  6,  7,  8,   924 }, /* 'v' */
+    {  0,  6,  9,  8,   932 }, /* 'w' */
+    {  1,  6,  7,  8,   948 }, /* 'x' */
+    {  1,  6,  8, 11,   956 }, /* 'y' */
+    {  2,  6,  6,  8,   967 }, /* 'z' */
+    {  3,  2,  5, 15,   975 }, /* '{' */
+    {  4,  3,  2, 13,   990 }, /* '|' */
+    {  2,  2,  5, 15,  1003 }, /* '}' */
+    {  1,  8,  8,  3,  1018 }, /* '~' */
+    {  0,  0,  0,  0,  1021 }, /* 0x7f */
+  },
+  .bits = {
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xb0,0xb0,0xb0,0xa0,
+0x12,0x12,0x24,0xff,0x24,0x24,0x24,0xfe,0x48,0x48,0x48,0x10,0x38,0x6c,0xc6,
+0xc0,0x60,0x38,0x0c,0x06,0x86,0xce,0x7c,0x10,0x10,0x60,0x00,0x90,0x00,0x92,
+0x00,0x96,0x00,0xf4,0x00,0x08,0x00,0x0b,0x00,0x14,0x80,0x24,0x80,0x24,0x80,
+0x03,0x00,0x18,0x00,0x24,0x00,0x66,0x00,0x24,0x00,0x38,0x00,0x30,0x00,0x69,
+0x80,0x4d,0x80,0xc7,0x00,0x43,0x00,0x3d,0x80,0xc0,0xc0,0x40,0x80,0x10,0x20,
+0x60,0x40,0xc0,0xc0,0xc0,0x80,0x80,0xc0,0xc0,0x40,0x40,0x20,0x10,0x80,0x40,
+0x60,0x20,0x30,0x30,0x30,0x10,0x10,0x30,0x30,0x20,0x20,0x40,0x80,0x20,0xa8,
+0xf8,0x60,0xd8,0x18,0x18,0x18,0xff,0xff,0x18,0x18,0x18,0xc0,0xc0,0x40,0x80,
+0xfc,0xc0,0xc0,0x04,0x04,0x0c,0x08,0x18,0x10,0x30,0x20,0x20,0x60,0x40,0x40,
+0xc0,0x80,0x3c,0x66,0x42,0xc3,0xc3,0xc3,0xc3,0xc3,0x42,0x66,0x3c,0x78,0xf8,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x38,0x6c,0xc6,0x02,0x06,0x0c,
+0x18,0x30,0x60,0x40,0xfe,0x78,0xcc,0x84,0x04,0x0c,0x38,0x0c,0x06,0x86,0xc4,
+0x78,0x0c,0x1c,0x1c,0x2c,0x6c,0x4c,0xcc,0xfe,0xfe,0x0c,0x0c,0x7c,0x7c,0x40,
+0x40,0xf8,0xcc,0x06,0x06,0x86,0xcc,0x78,0x3c,0x64,0xc0,0xc0,0xb8,0xcc,0x86,
+0x86,0x86,0xcc,0x78,0xfe,0x06,0x0c,0x08,0x18,0x10,0x30,0x30,0x20,0x20,0x20,
+0x78,0xcc,0x86,0x86,0x4c,0x38,0xc4,0x86,0x86,0xcc,0x78,0x78,0xcc,0x84,0x84,
+0x84,0xcc,0x7c,0x04,0x0c,0x18,0xf0,0xc0,0xc0,0x00,0x00,0x00,0x00,0xc0,0xc0,
+0xc0,0xc0,0x00,0x00,0x00,0x00,0xc0,0xc0,0x40,0x80,0x1c,0x70,0xc0,0xc0,0x78,
+0x0c,0xfc,0x00,0x00,0xfc,0xc0,0x70,0x1c,0x0c,0x70,0xc0,0x38,0x6c,0xc4,0x04,
+0x0c,0x18,0x30,0x30,0x00,0x30,0x30,0x1e,0x00,0x23,0x00,0x41,0x80,0x48,0x80,
+0x94,0x80,0xa4,0x80,0xa4,0x80,0xa4,0x80,0xa5,0x80,0xbb,0x00,0xc0,0x00,0x60,
+0x00,0x3c,0x00,0x10,0x18,0x38,0x2c,0x2c,0x64,0x46,0x7e,0xc2,0x83,0x81,0xfc,
+0xc6,0xc2,0xc2,0xc6,0xfc,0xc3,0xc3,0xc3,0xc3,0xfe,0x3c,0x76,0xe3,0xc3,0xc0,
+0xc0,0xc0,0xc0,0xe3,0x76,0x3c,0xfc,0xc6,0xc3,0xc1,0xc1,0xc1,0xc1,0xc1,0xc3,
+0xc6,0xfc,0xfe,0xc0,0xc0,0xc0,0xc0,0xfc,0xc0,0xc0,0xc0,0xc0,0xfe,0xfe,0xc0,
+0xc0,0xc0,0xc0,0xfc,0xc0,0xc0,0xc0,0xc0,0xc0,0x3c,0x66,0xc3,0xc3,0x80,0x80,
+0x8f,0xc3,0xc3,0x63,0x3e,0xc3,0xc3,0xc3,0xc3,0xc3,0xff,0xc3,0xc3,0xc3,0xc3,
+0xc3,0xfc,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xfc,0x06,0x06,0x06,
+0x06,0x06,0x06,0x06,0x06,0x86,0xcc,0x78,0xc3,0xc6,0xcc,0xc8,0xd8,0xf0,0xd8,
+0xcc,0xc4,0xc6,0xc3,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xfe,
+0xc1,0x80,0xc1,0x80,0xe3,0x80,0xe3,0x80,0xf3,0x80,0xd5,0x80,0xd5,0x80,0xdd,
+0x80,0xc9,0x80,0xc1,0x80,0xc1,0x80,0xc1,0xc1,0xe1,0xf1,0xd1,0xd9,0xcd,0xc5,
+0xc7,0xc3,0xc1,0x3c,0x66,0xc3,0xc1,0xc1,0xc1,0xc1,0xc1,0xc3,0x66,0x3c,0xfc,
+0xc6,0xc3,0xc3,0xc3,0xc6,0xfc,0xc0,0xc0,0xc0,0xc0,0x3c,0x00,0x66,0x00,0xc3,
+0x00,0xc3,0x00,0x81,0x00,0x81,0x00,0x81,0x00,0xc3,0x00,0xc3,0x00,0x66,0x00,
+0x3f,0x00,0x01,0x80,0xfc,0xc6,0xc2,0xc3,0xc6,0xfc,0xc6,0xc2,0xc3,0xc3,0xc3,
+0x3c,0x66,0xc2,0xc0,0x60,0x38,0x0c,0x06,0x82,0xc6,0x7c,0xff,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,
+0xe3,0x63,0x3e,0xc0,0x80,0x41,0x80,0x41,0x80,0x61,0x00,0x23,0x00,0x32,0x00,
+0x32,0x00,0x16,0x00,0x1c,0x00,0x0c,0x00,0x0c,0x00,0x80,0x80,0x80,0x80,0xc9,
+0x80,0x4d,0x80,0x55,0x00,0x55,0x00,0x77,0x00,0x33,0x00,0x33,0x00,0x32,0x00,
+0x32,0x00,0x83,0xc2,0x66,0x2c,0x38,0x18,0x38,0x2c,0x64,0xc6,0xc3,0xc3,0xc3,
+0x46,0x6c,0x3c,0x18,0x18,0x18,0x18,0x18,0x18,0xfe,0x06,0x04,0x0c,0x18,0x10,
+0x30,0x60,0x40,0xc0,0xfe,0xe0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+0x80,0x80,0x80,0xe0,0x80,0xc0,0x40,0x40,0x60,0x20,0x30,0x10,0x10,0x18,0x08,
+0x0c,0x04,0x04,0xe0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0xe0,0x20,0x60,0x70,0xd0,0x90,0x98,0xff,0xc0,0x40,0x20,0x7c,0xce,0x06,
+0x3e,0x66,0xc6,0xce,0xf6,0xc0,0xc0,0xc0,0xdc,0xe6,0xc3,0xc3,0xc3,0xc3,0xe6,
+0xdc,0x3c,0x66,0xc2,0xc0,0xc0,0xc2,0x66,0x3c,0x03,0x03,0x03,0x3b,0x67,0xc3,
+0xc3,0xc3,0xc3,0x67,0x3b,0x3c,0x66,0xc3,0xff,0xc0,0xc0,0x63,0x3e,0x1c,0x3c,
+0x60,0x60,0xf8,0x60,0x60,0x60,0x60,0x60,0x60,0x7c,0xee,0xc6,0xc6,0xc6,0xc6,
+0xee,0x76,0x06,0x06,0x7c,0xc0,0xc0,0xc0,0xdc,0xe6,0xc3,0xc3,0xc3,0xc3,0xc3,
+0xc3,0x30,0x00,0x00,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0xfc,0x60,0x00,0x00,
+0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xc0,0xc0,0xc0,0xc0,0xcc,
+0xc8,0xd0,0xf0,0xf0,0xd8,0xcc,0xc4,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0xfc,0xb6,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xde,0xe3,0xc3,0xc3,
+0xc3,0xc3,0xc3,0xc3,0x3c,0x66,0xc3,0xc3,0xc3,0xc3,0x66,0x3c,0xdc,0xe6,0xc3,
+0xc3,0xc3,0xc3,0xe6,0xdc,0xc0,0xc0,0xc0,0x3b,0x67,0xc3,0xc3,0xc3,0xc3,0x67,
+0x3b,0x03,0x03,0x03,0xde,0xe2,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x78,0xcc,0x80,
+0xe0,0x1c,0x04,0xcc,0x78,0x60,0x60,0x60,0xfc,0x60,0x60,0x60,0x60,0x60,0x62,
+0x3c,0xc3,0xc3,0xc3,0xc3,0xc3,0xc7,0xef,0x7b,0xc2,0x46,0x64,0x24,0x2c,0x38,
+0x18,0x18,0xc0,0x80,0xcc,0x80,0x4c,0x80,0x4c,0x80,0x55,0x80,0x33,0x00,0x33,
+0x00,0x23,0x00,0xc6,0x64,0x2c,0x18,0x18,0x2c,0x64,0xc6,0xc3,0x43,0x66,0x66,
+0x26,0x3c,0x1c,0x0c,0x18,0x18,0x30,0xfc,0x08,0x18,0x30,0x20,0x40,0xc0,0xfc,
+0x08,0x10,0x30,0x20,0x20,0x20,0x20,0xc0,0x20,0x20,0x20,0x20,0x30,0x10,0x08,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x40,
+0x60,0x20,0x20,0x20,0x20,0x18,0x20,0x20,0x20,0x20,0x60,0x40,0x80,0x71,0xdb,
+0x8e,
   }
 };
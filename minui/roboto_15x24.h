@@ -1,276 +1,264 @@
-struct CFont bigfont = {
-  .width = 1440,
-  .height = 24,
+static const struct CFont bigfont = {
   .cwidth = 15,
   .cheight = 24,
   .cheightfix = 0,
-  .rundata = {
-0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x6e,0x81,0x3e,0x81,
-0x07,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x76,0x84,0x17,0x84,0x7f,0x7f,0x7f,0x7f,
-0x4c,0x81,0x3d,0x82,0x07,0x82,0x5f,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x15,0x84,
-0x07,0x82,0x0e,0x84,0x45,0x82,0x24,0x82,0x1a,0x83,0x16,0x82,0x10,0x82,0x0e,
-0x82,0x0a,0x82,0x0d,0x84,0x7f,0x62,0x82,0x0b,0x82,0x0b,0x82,0x3b,0x82,0x0c,
-0x82,0x02,0x82,0x0a,0x82,0x03,0x81,0x0a,0x84,0x08,0x83,0x0e,0x84,0x0b,0x82,
-0x10,0x82,0x09,0x82,0x5e,0x81,0x09,0x84,0x0b,0x84,0x0b,0x84,0x0b,0x84,0x0e,
-0x83,0x08,0x88,0x09,0x84,0x07,0x8a,0x08,0x84,0x0b,0x84,0x56,0x84,0x1c,0x82,
-0x08,0x87,0x0b,0x85,0x07,0x87,0x09,0x89,0x06,0x8a,0x07,0x85,0x06,0x82,0x08,
-0x82,0x06,0x86,0x0f,0x82,0x06,0x82,0x07,0x82,0x04,0x82,0x0a,0x83,0x09,0x82,
-0x03,0x82,0x08,0x82,0x06,0x85,0x07,0x87,0x0b,0x85,0x07,0x87,0x0c,0x84,0x06,
-0x8d,0x03,0x82,0x07,0x82,0x02,0x83,0x08,0x83,0x01,0x82,0x0a,0x82,0x02,0x82,
-0x08,0x82,0x03,0x82,0x08,0x82,0x04,0x8b,0x09,0x82,0x09,0x82,0x10,0x82,0x0d,
-0x81,0x1d,0x82,0x18,0x82,0x24,0x82,0x19,0x84,0x16,0x82,0x10,0x82,0x0e,0x82,
-0x0a,0x82,0x0d,0x84,0x7f,0x61,0x82,0x0c,0x82,0x0c,0x82,0x3a,0x82,0x0c,0x82,
-0x02,0x82,0x0a,0x82,0x03,0x81,0x08,0x87,0x06,0x82,0x01,0x82,0x0c,0x86,0x0a,
-0x82,0x0f,0x82,0x0b,0x82,0x5c,0x82,0x08,0x87,0x07,0x86,0x0a,0x87,0x08,0x87,
-0x0c,0x83,0x08,0x88,0x07,0x87,0x06,0x8a,0x07,0x87,0x07,0x87,0x54,0x87,0x08,
-0x86,0x0c,0x82,0x08,0x89,0x07,0x88,0x06,0x89,0x07,0x89,0x06,0x8a,0x05,0x88,
-0x05,0x82,0x08,0x82,0x06,0x86,0x0f,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x0a,
-0x83,0x08,0x83,0x03,0x83,0x07,0x82,0x04,0x88,0x06,0x89,0x07,0x88,0x06,0x89,
-0x08,0x88,0x04,0x8d,0x03,0x82,0x07,0x82,0x03,0x82,0x08,0x82,0x02,0x82,0x04,
-0x81,0x05,0x82,0x03,0x82,0x06,0x82,0x04,0x82,0x07,0x83,0x04,0x8b,0x09,0x82,
-0x0a,0x82,0x0f,0x82,0x0c,0x83,0x1d,0x82,0x17,0x82,0x24,0x82,0x18,0x83,0x18,
-0x82,0x2c,0x82,0x0f,0x82,0x7f,0x60,0x83,0x0c,0x82,0x0d,0x82,0x39,0x82,0x0c,
-0x82,0x02,0x82,0x0a,0x82,0x02,0x82,0x07,0x83,0x03,0x83,0x04,0x82,0x03,0x81,
-0x04,0x81,0x06,0x83,0x03,0x82,0x09,0x82,0x0f,0x82,0x0b,0x82,0x5c,0x82,0x07,
-0x82,0x04,0x82,0x0a,0x83,0x09,0x82,0x04,0x83,0x06,0x82,0x04,0x83,0x0a,0x84,
-0x08,0x82,0x0d,0x82,0x13,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x04,0x82,0x52,
-0x82,0x04,0x82,0x07,0x82,0x05,0x82,0x09,0x84,0x07,0x82,0x05,0x83,0x06,0x82,
-0x05,0x82,0x05,0x82,0x05,0x83,0x06,0x82,0x0d,0x82,0x0d,0x82,0x05,0x82,0x04,
-0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,0x05,0x82,0x06,0x82,0x0a,0x83,
-0x08,0x83,0x03,0x83,0x07,0x82,0x04,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x06,
-0x82,0x05,0x82,0x05,0x82,0x05,0x83,0x06,0x83,0x04,0x83,0x08,0x83,0x08,0x82,
-0x07,0x82,0x03,0x82,0x08,0x82,0x02,0x82,0x03,0x83,0x04,0x82,0x03,0x83,0x04,
-0x83,0x05,0x82,0x06,0x82,0x0d,0x82,0x0a,0x82,0x0a,0x82,0x0f,0x82,0x0c,0x83,
-0x1e,0x81,0x17,0x82,0x24,0x82,0x18,0x82,0x19,0x82,0x2c,0x82,0x0f,0x82,0x74,
-0x82,0x69,0x82,0x0d,0x82,0x0d,0x82,0x39,0x82,0x0c,0x82,0x02,0x82,0x0a,0x82,
-0x02,0x82,0x07,0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x02,0x82,0x06,0x82,0x04,
-0x82,0x09,0x82,0x0e,0x82,0x0d,0x82,0x1c,0x82,0x3c,0x82,0x08,0x82,0x05,0x82,
-0x09,0x83,0x09,0x82,0x05,0x82,0x05,0x83,0x05,0x82,0x09,0x85,0x07,0x82,0x0d,
-0x82,0x13,0x82,0x07,0x82,0x05,0x82,0x05,0x82,0x05,0x83,0x51,0x82,0x04,0x82,
-0x06,0x82,0x07,0x82,0x08,0x84,0x07,0x82,0x06,0x82,0x05,0x82,0x07,0x82,0x04,
-0x82,0x06,0x83,0x05,0x82,0x0d,0x82,0x0c,0x82,0x07,0x82,0x03,0x82,0x08,0x82,
-0x08,0x82,0x11,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x0a,0x84,0x06,0x84,0x03,
-0x84,0x06,0x82,0x03,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x07,0x82,
-0x04,0x82,0x06,0x82,0x06,0x82,0x06,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x03,
-0x83,0x06,0x83,0x02,0x82,0x03,0x83,0x03,0x82,0x05,0x82,0x04,0x82,0x06,0x82,
-0x05,0x83,0x0c,0x83,0x0a,0x82,0x0b,0x82,0x0e,0x82,0x0c,0x81,0x01,0x82,0x35,
-0x82,0x24,0x82,0x18,0x82,0x19,0x82,0x2c,0x82,0x0f,0x82,0x74,0x82,0x69,0x82,
-0x0d,0x82,0x0d,0x83,0x38,0x82,0x0c,0x82,0x02,0x81,0x0b,0x81,0x03,0x82,0x07,
-0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x02,0x81,0x07,0x82,0x04,0x82,0x09,0x82,
-0x0e,0x82,0x0d,0x82,0x0d,0x82,0x0d,0x82,0x3c,0x82,0x07,0x82,0x06,0x82,0x09,
-0x83,0x08,0x83,0x05,0x82,0x0d,0x82,0x09,0x85,0x07,0x82,0x0d,0x82,0x12,0x83,
-0x07,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x57,0x83,0x04,0x82,0x09,0x81,0x08,
-0x84,0x07,0x82,0x06,0x82,0x05,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x05,0x82,
-0x0d,0x82,0x0c,0x82,0x07,0x82,0x03,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,
-0x82,0x03,0x83,0x07,0x82,0x0a,0x84,0x06,0x84,0x03,0x85,0x05,0x82,0x03,0x82,
-0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x06,0x83,0x05,
-0x82,0x06,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x04,0x82,0x06,0x82,0x03,0x82,
-0x03,0x83,0x03,0x82,0x05,0x83,0x02,0x83,0x07,0x82,0x04,0x82,0x0d,0x82,0x0b,
-0x82,0x0b,0x82,0x0e,0x82,0x0b,0x82,0x01,0x82,0x29,0x84,0x08,0x82,0x01,0x84,
-0x0a,0x86,0x0a,0x83,0x02,0x82,0x08,0x84,0x0a,0x86,0x0a,0x83,0x02,0x82,0x06,
-0x82,0x01,0x84,0x09,0x84,0x0e,0x82,0x0a,0x82,0x04,0x83,0x08,0x82,0x07,0x81,
-0x02,0x83,0x03,0x83,0x05,0x81,0x02,0x84,0x0b,0x84,0x09,0x81,0x02,0x84,0x0a,
-0x83,0x02,0x82,0x08,0x81,0x02,0x84,0x08,0x84,0x08,0x88,0x07,0x82,0x06,0x82,
-0x05,0x82,0x06,0x82,0x03,0x82,0x03,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x04,
-0x83,0x05,0x83,0x06,0x89,0x09,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x0c,0x82,
-0x02,0x81,0x08,0x8b,0x05,0x82,0x0b,0x82,0x03,0x81,0x02,0x82,0x07,0x83,0x02,
-0x82,0x0a,0x81,0x0f,0x82,0x0d,0x82,0x0d,0x82,0x0d,0x82,0x3c,0x82,0x07,0x82,
-0x06,0x82,0x09,0x83,0x10,0x82,0x0d,0x82,0x08,0x82,0x01,0x83,0x07,0x82,0x0d,
-0x82,0x12,0x82,0x08,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0d,0x82,
-0x13,0x81,0x06,0x89,0x06,0x81,0x14,0x82,0x05,0x81,0x04,0x84,0x02,0x82,0x06,
-0x82,0x02,0x82,0x06,0x82,0x06,0x82,0x04,0x82,0x0e,0x82,0x07,0x82,0x05,0x82,
-0x0d,0x82,0x0b,0x82,0x0d,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,0x03,
-0x82,0x08,0x82,0x0a,0x82,0x01,0x82,0x05,0x84,0x03,0x82,0x01,0x82,0x05,0x82,
-0x02,0x82,0x09,0x82,0x03,0x82,0x07,0x82,0x03,0x82,0x09,0x82,0x03,0x82,0x06,
-0x83,0x05,0x82,0x10,0x83,0x08,0x82,0x07,0x82,0x04,0x82,0x06,0x82,0x03,0x82,
-0x03,0x81,0x01,0x82,0x02,0x82,0x06,0x82,0x02,0x82,0x08,0x82,0x03,0x83,0x0c,
-0x82,0x0c,0x82,0x0b,0x82,0x0e,0x82,0x0b,0x82,0x02,0x81,0x28,0x87,0x06,0x88,
-0x08,0x88,0x08,0x88,0x07,0x86,0x09,0x86,0x09,0x88,0x06,0x88,0x08,0x84,0x0e,
-0x82,0x0a,0x82,0x03,0x83,0x09,0x82,0x07,0x87,0x01,0x85,0x04,0x88,0x09,0x87,
-0x07,0x81,0x01,0x86,0x08,0x88,0x08,0x87,0x06,0x87,0x07,0x88,0x07,0x82,0x06,
-0x82,0x05,0x82,0x05,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x04,0x83,0x03,0x83,
-0x05,0x82,0x05,0x82,0x07,0x89,0x09,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1b,
-0x82,0x03,0x81,0x08,0x83,0x0b,0x85,0x01,0x82,0x09,0x85,0x1a,0x83,0x0d,0x83,
-0x09,0x81,0x02,0x82,0x01,0x81,0x0b,0x82,0x3b,0x82,0x08,0x82,0x06,0x82,0x09,
-0x83,0x0f,0x82,0x0d,0x82,0x09,0x82,0x01,0x83,0x07,0x87,0x07,0x83,0x01,0x84,
-0x0c,0x82,0x09,0x83,0x03,0x82,0x06,0x82,0x06,0x82,0x08,0x82,0x0d,0x82,0x11,
-0x83,0x06,0x89,0x06,0x83,0x12,0x82,0x05,0x81,0x03,0x82,0x02,0x82,0x02,0x81,
-0x06,0x82,0x02,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x0e,0x82,0x07,0x83,0x04,
-0x82,0x0d,0x82,0x0b,0x82,0x0d,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,
-0x02,0x82,0x09,0x82,0x0a,0x82,0x01,0x82,0x04,0x82,0x01,0x82,0x03,0x82,0x02,
-0x82,0x04,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x07,0x82,0x03,0x82,0x09,0x82,
-0x03,0x82,0x06,0x82,0x06,0x83,0x0f,0x83,0x08,0x82,0x07,0x82,0x05,0x82,0x04,
-0x82,0x05,0x81,0x02,0x82,0x01,0x82,0x02,0x82,0x07,0x84,0x0a,0x82,0x02,0x82,
-0x0c,0x83,0x0c,0x82,0x0c,0x82,0x0d,0x82,0x0a,0x82,0x03,0x82,0x26,0x82,0x04,
-0x82,0x06,0x83,0x03,0x83,0x07,0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x06,0x82,
-0x04,0x82,0x0a,0x82,0x0a,0x83,0x03,0x83,0x06,0x82,0x04,0x83,0x09,0x82,0x0e,
-0x82,0x0a,0x82,0x03,0x82,0x0a,0x82,0x07,0x82,0x03,0x84,0x02,0x82,0x04,0x82,
-0x04,0x83,0x07,0x82,0x04,0x83,0x06,0x82,0x04,0x83,0x06,0x82,0x04,0x83,0x08,
-0x83,0x0a,0x82,0x04,0x82,0x08,0x82,0x0b,0x82,0x06,0x82,0x05,0x82,0x05,0x82,
-0x04,0x82,0x03,0x83,0x03,0x82,0x06,0x82,0x03,0x82,0x06,0x82,0x05,0x82,0x0d,
-0x82,0x0a,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1b,0x82,0x02,0x82,0x09,0x85,
-0x0e,0x81,0x0b,0x83,0x1b,0x82,0x0f,0x82,0x09,0x87,0x0b,0x82,0x3b,0x82,0x08,
-0x82,0x06,0x82,0x09,0x83,0x0e,0x83,0x09,0x85,0x09,0x82,0x02,0x83,0x07,0x88,
-0x06,0x89,0x0b,0x82,0x0a,0x86,0x07,0x82,0x06,0x82,0x27,0x85,0x17,0x84,0x0f,
-0x82,0x05,0x82,0x03,0x81,0x03,0x82,0x02,0x81,0x06,0x82,0x02,0x82,0x06,0x88,
-0x06,0x82,0x0e,0x82,0x07,0x83,0x04,0x88,0x07,0x88,0x05,0x82,0x0d,0x8c,0x08,
-0x82,0x11,0x82,0x06,0x85,0x0a,0x82,0x0a,0x82,0x01,0x82,0x04,0x82,0x01,0x82,
-0x03,0x82,0x02,0x82,0x04,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x06,0x82,0x04,
-0x82,0x09,0x82,0x03,0x82,0x04,0x83,0x08,0x85,0x0c,0x83,0x08,0x82,0x07,0x82,
-0x05,0x82,0x04,0x82,0x05,0x82,0x01,0x82,0x01,0x82,0x02,0x81,0x08,0x84,0x0a,
-0x86,0x0c,0x82,0x0d,0x82,0x0c,0x82,0x0d,0x82,0x0a,0x82,0x03,0x82,0x26,0x82,
-0x04,0x83,0x05,0x82,0x05,0x82,0x06,0x83,0x05,0x82,0x05,0x83,0x05,0x82,0x05,
-0x83,0x04,0x82,0x0a,0x82,0x0a,0x82,0x05,0x82,0x06,0x82,0x05,0x82,0x09,0x82,
-0x0e,0x82,0x0a,0x82,0x02,0x82,0x0b,0x82,0x07,0x82,0x03,0x83,0x03,0x83,0x03,
-0x82,0x05,0x82,0x06,0x83,0x05,0x82,0x06,0x82,0x05,0x82,0x05,0x83,0x05,0x82,
-0x08,0x82,0x0b,0x82,0x04,0x82,0x08,0x82,0x0b,0x82,0x06,0x82,0x06,0x82,0x04,
-0x82,0x04,0x82,0x02,0x84,0x03,0x82,0x07,0x82,0x01,0x82,0x07,0x83,0x03,0x83,
-0x0c,0x83,0x0a,0x82,0x0d,0x82,0x0e,0x82,0x0a,0x82,0x2c,0x82,0x1b,0x82,0x02,
-0x82,0x0b,0x85,0x0b,0x82,0x09,0x85,0x1b,0x82,0x0f,0x82,0x0b,0x83,0x09,0x8b,
-0x36,0x81,0x09,0x82,0x06,0x82,0x09,0x83,0x0e,0x82,0x0a,0x86,0x07,0x82,0x03,
-0x83,0x07,0x82,0x04,0x83,0x05,0x84,0x03,0x83,0x09,0x82,0x0b,0x87,0x07,0x82,
-0x04,0x83,0x25,0x85,0x1b,0x85,0x0b,0x82,0x06,0x82,0x02,0x82,0x03,0x82,0x02,
-0x81,0x05,0x82,0x04,0x82,0x05,0x8a,0x04,0x82,0x0e,0x82,0x07,0x83,0x04,0x88,
-0x07,0x88,0x05,0x82,0x04,0x86,0x03,0x8c,0x08,0x82,0x11,0x82,0x06,0x86,0x09,
-0x82,0x0a,0x82,0x02,0x82,0x02,0x82,0x02,0x82,0x03,0x82,0x03,0x82,0x03,0x82,
-0x02,0x82,0x09,0x82,0x03,0x8a,0x04,0x82,0x09,0x82,0x03,0x89,0x0a,0x85,0x0a,
-0x83,0x08,0x82,0x07,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x01,0x82,0x02,0x81,
-0x01,0x82,0x09,0x82,0x0c,0x84,0x0c,0x82,0x0e,0x82,0x0d,0x82,0x0c,0x82,0x3d,
-0x83,0x05,0x82,0x05,0x82,0x06,0x82,0x0d,0x82,0x06,0x82,0x05,0x82,0x06,0x82,
-0x09,0x82,0x09,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,
-0x82,0x01,0x83,0x0b,0x82,0x07,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,
-0x06,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0b,
-0x82,0x0e,0x82,0x0b,0x82,0x06,0x82,0x06,0x82,0x03,0x82,0x06,0x82,0x01,0x82,
-0x01,0x81,0x03,0x82,0x07,0x82,0x01,0x82,0x08,0x82,0x03,0x82,0x0c,0x83,0x09,
-0x83,0x0e,0x82,0x0e,0x83,0x07,0x86,0x04,0x82,0x24,0x82,0x1b,0x81,0x03,0x82,
-0x0d,0x84,0x0a,0x81,0x02,0x84,0x03,0x83,0x01,0x83,0x03,0x82,0x15,0x82,0x0f,
-0x82,0x0b,0x84,0x08,0x8b,0x15,0x86,0x1a,0x82,0x09,0x82,0x06,0x82,0x09,0x83,
-0x0d,0x82,0x0f,0x83,0x06,0x82,0x03,0x83,0x0e,0x82,0x05,0x83,0x05,0x82,0x09,
-0x82,0x0a,0x82,0x04,0x83,0x06,0x89,0x24,0x83,0x21,0x84,0x08,0x82,0x07,0x81,
-0x03,0x82,0x03,0x81,0x03,0x81,0x05,0x82,0x04,0x82,0x05,0x82,0x06,0x83,0x03,
-0x82,0x0e,0x82,0x07,0x83,0x04,0x82,0x0d,0x82,0x0b,0x82,0x04,0x86,0x03,0x82,
-0x08,0x82,0x08,0x82,0x11,0x82,0x06,0x82,0x02,0x82,0x09,0x82,0x0a,0x82,0x02,
-0x82,0x02,0x82,0x02,0x82,0x03,0x82,0x03,0x83,0x02,0x82,0x02,0x82,0x09,0x82,
-0x03,0x88,0x06,0x82,0x09,0x82,0x03,0x82,0x05,0x83,0x0c,0x84,0x08,0x83,0x08,
-0x82,0x07,0x82,0x06,0x82,0x02,0x82,0x06,0x82,0x01,0x81,0x03,0x84,0x08,0x84,
-0x0b,0x83,0x0c,0x83,0x0e,0x82,0x0d,0x82,0x0c,0x82,0x39,0x87,0x05,0x82,0x05,
-0x82,0x06,0x82,0x0d,0x82,0x06,0x82,0x05,0x8a,0x09,0x82,0x09,0x82,0x06,0x82,
-0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,0x85,0x0c,0x82,0x07,0x82,0x04,
-0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x06,0x82,0x06,0x82,0x06,0x82,0x05,0x82,
-0x05,0x82,0x06,0x82,0x08,0x82,0x0b,0x85,0x0b,0x82,0x0b,0x82,0x06,0x82,0x06,
-0x82,0x03,0x82,0x06,0x82,0x01,0x82,0x01,0x82,0x02,0x82,0x08,0x83,0x09,0x82,
-0x03,0x82,0x0c,0x82,0x0a,0x82,0x0f,0x82,0x0f,0x83,0x06,0x82,0x02,0x83,0x02,
-0x82,0x25,0x82,0x18,0x8b,0x0d,0x82,0x09,0x82,0x01,0x82,0x02,0x82,0x02,0x82,
-0x03,0x83,0x02,0x82,0x15,0x82,0x0f,0x82,0x0a,0x82,0x01,0x82,0x0c,0x82,0x3a,
-0x82,0x09,0x82,0x06,0x82,0x09,0x83,0x0c,0x82,0x11,0x82,0x05,0x82,0x04,0x83,
-0x0e,0x82,0x05,0x83,0x05,0x82,0x09,0x82,0x09,0x82,0x06,0x82,0x08,0x83,0x02,
-0x82,0x24,0x83,0x0c,0x89,0x0d,0x83,0x08,0x82,0x07,0x81,0x03,0x82,0x03,0x81,
-0x03,0x81,0x04,0x89,0x05,0x82,0x07,0x82,0x03,0x82,0x0e,0x82,0x07,0x82,0x05,
-0x82,0x0d,0x82,0x0b,0x82,0x08,0x82,0x03,0x82,0x08,0x82,0x08,0x82,0x11,0x82,
-0x06,0x82,0x03,0x82,0x08,0x82,0x0a,0x82,0x03,0x81,0x02,0x81,0x03,0x82,0x03,
-0x82,0x04,0x82,0x02,0x82,0x02,0x82,0x09,0x82,0x03,0x82,0x0c,0x82,0x09,0x82,
-0x03,0x82,0x06,0x82,0x0e,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x06,0x82,0x02,
-0x82,0x06,0x84,0x03,0x84,0x07,0x86,0x0b,0x82,0x0c,0x82,0x0f,0x82,0x0d,0x82,
-0x0c,0x82,0x37,0x89,0x05,0x82,0x05,0x82,0x06,0x82,0x0d,0x82,0x06,0x82,0x05,
-0x8a,0x09,0x82,0x09,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,
-0x0a,0x85,0x0c,0x82,0x07,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x06,
-0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0d,0x85,
-0x09,0x82,0x0b,0x82,0x06,0x82,0x07,0x82,0x02,0x81,0x07,0x82,0x01,0x81,0x02,
-0x82,0x01,0x82,0x09,0x83,0x0a,0x82,0x01,0x83,0x0b,0x82,0x0c,0x82,0x0e,0x82,
-0x0e,0x82,0x07,0x82,0x04,0x86,0x3f,0x8b,0x05,0x82,0x06,0x82,0x08,0x82,0x02,
-0x81,0x04,0x81,0x02,0x82,0x04,0x85,0x16,0x82,0x0f,0x82,0x0e,0x81,0x0c,0x82,
-0x39,0x82,0x0a,0x82,0x06,0x82,0x09,0x83,0x0b,0x83,0x11,0x82,0x05,0x8b,0x0c,
-0x82,0x06,0x82,0x05,0x82,0x08,0x83,0x09,0x82,0x06,0x82,0x0d,0x82,0x25,0x85,
-0x09,0x89,0x0a,0x85,0x09,0x82,0x07,0x81,0x03,0x82,0x03,0x81,0x02,0x82,0x04,
-0x8a,0x04,0x82,0x07,0x82,0x03,0x83,0x07,0x82,0x04,0x82,0x07,0x82,0x05,0x82,
-0x0d,0x82,0x0b,0x83,0x07,0x82,0x03,0x82,0x08,0x82,0x08,0x82,0x11,0x82,0x06,
-0x82,0x03,0x83,0x07,0x82,0x0a,0x82,0x03,0x84,0x03,0x82,0x03,0x82,0x05,0x82,
-0x01,0x82,0x02,0x83,0x07,0x83,0x03,0x82,0x0c,0x83,0x07,0x83,0x03,0x82,0x06,
-0x83,0x04,0x82,0x07,0x82,0x08,0x83,0x08,0x82,0x07,0x82,0x06,0x82,0x01,0x83,
-0x07,0x83,0x03,0x84,0x07,0x82,0x02,0x82,0x0b,0x82,0x0b,0x82,0x10,0x82,0x0e,
-0x82,0x0b,0x82,0x36,0x83,0x04,0x83,0x05,0x82,0x05,0x82,0x06,0x82,0x0d,0x82,
-0x06,0x82,0x05,0x82,0x11,0x82,0x09,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x09,
-0x82,0x0e,0x82,0x0a,0x82,0x02,0x82,0x0b,0x82,0x07,0x82,0x04,0x82,0x04,0x82,
-0x03,0x82,0x05,0x82,0x06,0x82,0x06,0x82,0x06,0x82,0x05,0x82,0x05,0x82,0x06,
-0x82,0x08,0x82,0x10,0x83,0x08,0x82,0x0b,0x82,0x06,0x82,0x07,0x82,0x01,0x82,
-0x08,0x83,0x03,0x81,0x01,0x82,0x08,0x85,0x09,0x82,0x01,0x82,0x0b,0x83,0x0d,
-0x82,0x0d,0x82,0x0e,0x82,0x0f,0x82,0x43,0x82,0x02,0x82,0x08,0x83,0x05,0x82,
-0x08,0x81,0x03,0x81,0x04,0x81,0x02,0x82,0x05,0x84,0x16,0x82,0x0f,0x82,0x1b,
-0x82,0x39,0x82,0x0a,0x83,0x05,0x82,0x09,0x83,0x0a,0x83,0x0a,0x82,0x06,0x82,
-0x0b,0x83,0x07,0x82,0x05,0x82,0x06,0x82,0x05,0x82,0x08,0x82,0x0a,0x82,0x06,
-0x82,0x0c,0x83,0x27,0x85,0x18,0x84,0x15,0x82,0x02,0x82,0x02,0x82,0x02,0x81,
-0x05,0x82,0x06,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x07,0x82,0x04,0x82,0x06,
-0x83,0x05,0x82,0x0d,0x82,0x0c,0x82,0x07,0x82,0x03,0x82,0x08,0x82,0x08,0x82,
-0x0a,0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x0a,0x82,0x03,0x84,0x03,
-0x82,0x03,0x82,0x05,0x85,0x03,0x82,0x07,0x82,0x04,0x82,0x0d,0x82,0x05,0x81,
-0x01,0x82,0x04,0x82,0x06,0x83,0x04,0x83,0x06,0x82,0x08,0x83,0x08,0x82,0x07,
-0x82,0x07,0x84,0x08,0x83,0x04,0x82,0x07,0x82,0x04,0x82,0x0a,0x82,0x0a,0x83,
-0x10,0x82,0x0e,0x82,0x0b,0x82,0x36,0x82,0x05,0x83,0x05,0x82,0x05,0x82,0x06,
-0x83,0x05,0x82,0x05,0x82,0x06,0x82,0x05,0x83,0x10,0x82,0x09,0x83,0x05,0x82,
-0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,0x82,0x02,0x83,0x0a,0x82,0x07,
-0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x06,0x83,0x05,0x82,0x06,0x82,
-0x05,0x82,0x05,0x82,0x06,0x82,0x08,0x82,0x0a,0x82,0x05,0x82,0x08,0x82,0x0b,
-0x82,0x06,0x82,0x08,0x81,0x01,0x82,0x08,0x83,0x03,0x84,0x08,0x82,0x01,0x82,
-0x09,0x82,0x01,0x82,0x0b,0x82,0x0e,0x82,0x0d,0x82,0x0d,0x83,0x54,0x82,0x02,
-0x82,0x09,0x82,0x04,0x83,0x07,0x82,0x03,0x81,0x04,0x81,0x02,0x82,0x06,0x82,
-0x18,0x82,0x0d,0x82,0x1c,0x82,0x39,0x81,0x0c,0x82,0x04,0x83,0x09,0x83,0x09,
-0x83,0x0c,0x82,0x05,0x82,0x0b,0x83,0x07,0x82,0x04,0x83,0x06,0x83,0x04,0x82,
-0x08,0x82,0x0a,0x83,0x05,0x82,0x0c,0x82,0x2b,0x83,0x15,0x84,0x18,0x81,0x03,
-0x83,0x01,0x83,0x05,0x82,0x07,0x83,0x03,0x82,0x06,0x83,0x04,0x83,0x05,0x82,
-0x05,0x82,0x06,0x82,0x06,0x82,0x0d,0x82,0x0c,0x83,0x06,0x82,0x03,0x82,0x08,
-0x82,0x08,0x82,0x0a,0x82,0x05,0x82,0x06,0x82,0x05,0x83,0x05,0x82,0x0a,0x82,
-0x04,0x82,0x04,0x82,0x03,0x82,0x06,0x84,0x03,0x83,0x05,0x83,0x04,0x82,0x0d,
-0x83,0x05,0x83,0x04,0x82,0x06,0x83,0x05,0x82,0x06,0x82,0x08,0x83,0x08,0x83,
-0x05,0x83,0x07,0x84,0x08,0x82,0x05,0x82,0x06,0x83,0x04,0x83,0x09,0x82,0x0a,
-0x82,0x11,0x82,0x0e,0x82,0x0b,0x82,0x36,0x82,0x05,0x83,0x05,0x83,0x04,0x82,
-0x07,0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x06,0x82,0x10,0x82,0x0a,0x82,0x04,
-0x83,0x06,0x82,0x05,0x82,0x09,0x82,0x0e,0x82,0x0a,0x82,0x03,0x82,0x0a,0x82,
-0x07,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x07,0x82,0x04,0x83,0x06,
-0x82,0x05,0x82,0x06,0x82,0x04,0x83,0x08,0x82,0x0a,0x83,0x04,0x82,0x08,0x82,
-0x03,0x82,0x06,0x83,0x04,0x83,0x08,0x83,0x09,0x82,0x04,0x83,0x08,0x82,0x03,
-0x82,0x09,0x83,0x0b,0x82,0x0f,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1a,0x81,
-0x03,0x82,0x09,0x88,0x08,0x81,0x04,0x82,0x02,0x82,0x03,0x83,0x02,0x85,0x17,
-0x82,0x0d,0x82,0x29,0x82,0x1d,0x82,0x0c,0x82,0x0c,0x83,0x02,0x83,0x0a,0x83,
-0x09,0x89,0x06,0x84,0x01,0x83,0x0c,0x83,0x07,0x84,0x01,0x83,0x08,0x83,0x01,
-0x83,0x09,0x82,0x0b,0x84,0x01,0x83,0x07,0x82,0x02,0x84,0x09,0x82,0x0d,0x82,
-0x13,0x81,0x15,0x82,0x10,0x82,0x08,0x81,0x0f,0x82,0x08,0x82,0x03,0x8a,0x06,
-0x83,0x02,0x84,0x05,0x89,0x07,0x89,0x06,0x82,0x0d,0x84,0x02,0x84,0x03,0x82,
-0x08,0x82,0x06,0x86,0x09,0x83,0x01,0x83,0x07,0x82,0x06,0x83,0x04,0x8a,0x02,
-0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x07,0x83,0x04,0x89,0x05,0x82,0x0e,0x8a,
-0x04,0x82,0x07,0x82,0x05,0x84,0x02,0x83,0x09,0x83,0x09,0x84,0x01,0x84,0x08,
-0x83,0x09,0x82,0x05,0x82,0x06,0x82,0x06,0x82,0x09,0x82,0x09,0x8b,0x09,0x82,
-0x0f,0x82,0x0a,0x82,0x37,0x89,0x05,0x88,0x08,0x88,0x07,0x89,0x06,0x84,0x02,
-0x82,0x0a,0x82,0x0a,0x89,0x06,0x82,0x05,0x82,0x06,0x88,0x0b,0x82,0x0a,0x82,
-0x04,0x82,0x06,0x88,0x04,0x82,0x04,0x82,0x04,0x82,0x03,0x82,0x05,0x82,0x07,
-0x84,0x01,0x83,0x07,0x84,0x01,0x83,0x07,0x83,0x02,0x84,0x08,0x82,0x0b,0x83,
-0x02,0x83,0x08,0x87,0x06,0x8a,0x08,0x83,0x09,0x82,0x05,0x82,0x07,0x83,0x03,
-0x83,0x08,0x83,0x0a,0x89,0x09,0x82,0x0d,0x82,0x0d,0x83,0x38,0x82,0x1a,0x81,
-0x03,0x82,0x0a,0x86,0x0f,0x84,0x05,0x86,0x01,0x83,0x16,0x82,0x0d,0x82,0x29,
-0x82,0x1d,0x82,0x0c,0x82,0x0d,0x86,0x0b,0x83,0x09,0x89,0x07,0x86,0x0d,0x83,
-0x08,0x86,0x0a,0x85,0x0a,0x82,0x0c,0x86,0x08,0x86,0x0b,0x82,0x0d,0x82,0x3b,
-0x82,0x09,0x81,0x0e,0x82,0x08,0x82,0x03,0x89,0x08,0x86,0x07,0x88,0x08,0x89,
-0x06,0x82,0x0e,0x87,0x05,0x82,0x08,0x82,0x06,0x86,0x0a,0x85,0x08,0x82,0x07,
-0x82,0x04,0x8a,0x02,0x82,0x0a,0x82,0x03,0x82,0x07,0x83,0x05,0x86,0x07,0x82,
-0x0f,0x86,0x01,0x83,0x03,0x82,0x07,0x82,0x07,0x86,0x0a,0x83,0x0a,0x87,0x0a,
-0x82,0x09,0x82,0x06,0x81,0x05,0x83,0x06,0x83,0x08,0x82,0x09,0x8b,0x09,0x82,
-0x0f,0x82,0x0a,0x82,0x37,0x85,0x02,0x82,0x05,0x81,0x01,0x85,0x0b,0x85,0x09,
-0x85,0x01,0x82,0x08,0x86,0x0a,0x82,0x0b,0x85,0x01,0x82,0x06,0x82,0x05,0x82,
-0x06,0x88,0x0b,0x82,0x0a,0x82,0x04,0x83,0x05,0x88,0x04,0x82,0x04,0x82,0x04,
-0x82,0x03,0x82,0x05,0x82,0x09,0x85,0x08,0x87,0x09,0x85,0x01,0x82,0x08,0x82,
-0x0c,0x86,0x0a,0x84,0x09,0x86,0x01,0x82,0x09,0x82,0x0a,0x81,0x05,0x82,0x07,
-0x82,0x05,0x82,0x08,0x83,0x0a,0x89,0x09,0x82,0x0d,0x82,0x0d,0x82,0x68,0x81,
-0x3b,0x82,0x0b,0x82,0x2a,0x82,0x2a,0x82,0x7f,0x35,0x82,0x46,0x83,0x7f,0x7f,
-0x08,0x82,0x7f,0x10,0x82,0x10,0x82,0x09,0x82,0x18,0x8a,0x76,0x82,0x28,0x82,
-0x54,0x82,0x14,0x82,0x71,0x82,0x1d,0x82,0x0d,0x82,0x0d,0x82,0x68,0x81,0x3b,
-0x82,0x0b,0x82,0x2a,0x82,0x2a,0x82,0x7f,0x35,0x82,0x48,0x86,0x7f,0x7f,0x7f,
-0x15,0x84,0x0e,0x82,0x07,0x84,0x18,0x8a,0x76,0x82,0x28,0x82,0x54,0x82,0x14,
-0x82,0x71,0x82,0x1d,0x83,0x0c,0x82,0x0d,0x82,0x7f,0x26,0x82,0x09,0x82,0x2b,
-0x81,0x7f,0x62,0x81,0x7f,0x7f,0x7f,0x64,0x84,0x17,0x84,0x7f,0x12,0x82,0x04,
-0x82,0x28,0x83,0x54,0x82,0x14,0x82,0x70,0x83,0x1e,0x83,0x0b,0x82,0x0c,0x82,
-0x7f,0x28,0x82,0x07,0x82,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x27,0x88,0x26,
-0x84,0x55,0x82,0x14,0x82,0x6e,0x84,0x21,0x81,0x0b,0x82,0x0c,0x81,0x7f,0x2a,
-0x81,0x07,0x81,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x7f,0x2a,0x84,0x28,0x83,0x7f,
-0x5d,0x83,0x64,
-0x00,
+  .glyphs = {
+    {  0,  0,  0,  0,     0 }, /* ' ' */
+    {  5,  3,  2, 16,     0 }, /* '!' */
+    {  4,  3,  6,  6,    16 }, /* '"' */
+    {  1,  3, 12, 16,    22 }, /* '#' */
+    {  2,  1, 10, 20,    54 }, /* '$' */
+    {  1,  3, 14, 16,    94 }, /* '%' */
+    {  2,  3, 12, 16,   126 }, /* '&' */
+    {  5,  3,  2,  6,   158 }, /* ''' */
+    {  5,  1,  6, 23,   164 }, /* '(' */
+    {  3,  1,  6, 23,   187 }, /* ')' */
+    {  3,  7,  7,  8,   210 }, /* '*' */
+    {  2,  6, 11, 11,   218 }, /* '+' */
+    {  4, 17,  2,  5,   240 }, /* ',' */
+    {  4, 12,  6,  1,   245 }, /* '-' */
+    {  5, 17,  2,  2,   246 }, /* '.' */
+    {  3,  2,  8, 19,   248 }, /* '/' */
+    {  2,  3, 10, 16,   267 }, /* '0' */
+    {  3,  3,  6, 16,   299 }, /* '1' */
+    {  2,  3, 10, 16,   315 }, /* '2' */
+    {  2,  3, 10, 16,   347 }, /* '3' */
+    {  2,  3, 11, 16,   379 }, /* '4' */
+    {  3,  3,  9, 16,   411 }, /* '5' */
+    {  2,  3, 10, 16,   443 }, /* '6' */
+    {  2,  3, 10, 16,   475 }, /* '7' */
+    {  2,  3, 10, 16,   507 }, /* '8' */
+    {  2,  3, 10, 16,   539 }, /* '9' */
+    {  5,  8,  2, 11,   571 }, /* ':' */
+    {  5,  8,  2, 14,   582 }, /* ';' */
+    {  3,  8,  9, 10,   596 }, /* '<' */
+    {  3,  8,  9,  7,   616 }, /* '=' */
+    {  3,  8, 10, 10,   630 }, /* '>' */
+    {  3,  3,  9, 16,   650 }, /* '?' */
+    {  0,  4, 14, 17,   682 }, /* '@' */
+    {  2,  3, 12, 16,   716 }, /* 'A' */
+    {  2,  3, 11, 16,   748 }, /* 'B' */
+    {  1,  3, 12, 16,   780 }, /* 'C' */
+    {  2,  3, 12, 16,   812 }, /* 'D' */
+    {  3,  3,  9, 16,   844 }, /* 'E' */
+    {  3,  3, 10, 16,   876 }, /* 'F' */
+    {  1,  3, 12, 16,   908 }, /* 'G' */
+    {  1,  3, 12, 16,   940 }, /* 'H' */
+    {  4,  3,  6, 16,   972 }, /* 'I' */
+    {  3,  3,  9, 16,   988 }, /* 'J' */
+    {  3,  3, 11, 16,  1020 }, /* 'K' */
+    {  3,  3, 10, 16,  1052 }, /* 'L' */
+    {  0,  3, 14, 16,  1084 }, /* 'M' */
+    {  2,  3, 12, 16,  1116 }, /* 'N' */
+    {  1,  3, 13, 16,  1148 }, /* 'O' */
+    {  2,  3, 11, 16,  1180 }, /* 'P' */
+    {  1,  3, 13, 17,  1212 }, /* 'Q' */
+    {  2,  3, 11, 16,  1246 }, /* 'R' */
+    {  2,  3, 11, 16,  1278 }, /* 'S' */
+    {  1,  3, 13, 16,  1310 }, /* 'T' */
+    {  2,  3, 11, 16,  1342 }, /* 'U' */
+    {  0,  3, 14, 16,  1374 }, /* 'V' */
+    {  0,  3, 14, 16,  1406 }, /* 'W' */
+    {  1,  3, 12, 16,  1438 }, /* 'X' */
+    {  1,  3, 12, 16,  1470 }, /* 'Y' */
+    {  2,  3, 11, 16,  1502 }, /* 'Z' */
+    {  7,  1,  4, 21,  1534 }, /* '[' */
+    {  3,  2,  9, 19,  1555 }, /* '\' */
+    {  4,  1,  4, 21,  1593 }, /* ']' */
+    {  3,  3,  7,  8,  1614 }, /* '^' */
+    {  2, 19, 10,  2,  1622 }, /* '_' */
+    {  6,  3,  3,  3,  1626 }, /* '`' */
+    {  2,  7, 10, 12,  1629 }, /* 'a' */
+    {  2,  2,  9, 17,  1653 }, /* 'b' */
+    {  2,  7, 10, 12,  1687 }, /* 'c' */
+    {  2,  2, 10, 17,  1711 }, /* 'd' */
+    {  2,  7, 10, 12,  1745 }, /* 'e' */
+    {  4,  2,  7, 17,  1769 }, /* 'f' */
+    {  2,  7, 10, 17,  1786 }, /* 'g' */
+    {  3,  2,  9, 17,  1820 }, /* 'h' */
+    {  3,  2,  8, 17,  1854 }, /* 'i' */
+    {  4,  2,  5, 22,  1871 }, /* 'j' */
+    {  4,  2,  9, 17,  1893 }, /* 'k' */
+    {  3,  2,  8, 17,  1927 }, /* 'l' */
+    {  0,  7, 14, 12,  1944 }, /* 'm' */
+    {  2,  7,  9, 12,  1968 }, /* 'n' */
+    {  2,  7, 10, 12,  1992 }, /* 'o' */
+    {  3,  7,  9, 16,  2016 }, /* 'p' */
+    {  2,  7, 10, 16,  2048 }, /* 'q' */
+    {  5,  7,  7, 12,  2080 }, /* 'r' */
+    {  2,  7,  9, 12,  2092 }, /* 's' */
+    {  2,  5,  9, 14,  2116 }, /* 't' */
+    {  2,  7, 10, 12,  2144 }, /* 'u' */
+    {  2,  7, 10, 12,  2168 }, /* 'v' */
+    {  0,  7, 14, 12,  2192 }, /* 'w' */
+    {  3,  7,  9, 12,  2216 }, /* 'x' */
+    {  1,  7, 11, 17,  2240 }, /* 'y' */
+    {  3,  7,  9, 12,  2274 }, /* 'z' */
+    {  4,  2,  6, 21,  2298 }, /* '{' */
+    {  6,  2,  2, 21,  2319 }, /* '|' */
+    {  4,  2,  7, 21,  2340 }, /* '}' */
+    {  1, 10, 13,  5,  2361 }, /* '~' */
+    {  0,  0,  0,  0,  2371 }, /* 0x7f */
+  },
+  .bits = {
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0xc0,
+0xc0,0xcc,0xcc,0xcc,0xcc,0xc8,0xc8,0x0c,0x40,0x0c,0x40,0x0c,0xc0,0x0c,0xc0,
+0x08,0xc0,0x7f,0xf0,0x18,0x80,0x19,0x80,0x19,0x80,0x11,0x80,0xff,0xe0,0xff,
+0xe0,0x33,0x00,0x33,0x00,0x23,0x00,0x23,0x00,0x04,0x00,0x04,0x00,0x0f,0x00,
+0x3f,0x80,0x71,0xc0,0x60,0xc0,0x60,0xc0,0x60,0x00,0x70,0x00,0x3e,0x00,0x0f,
+0x80,0x03,0xc0,0x00,0xc0,0xc0,0xc0,0xe0,0xc0,0x61,0xc0,0x7f,0x80,0x3f,0x00,
+0x04,0x00,0x04,0x00,0x38,0x00,0x6c,0x00,0xc4,0x20,0xc6,0x60,0xc6,0x40,0xc4,
+0xc0,0x7d,0x80,0x01,0x00,0x03,0x00,0x02,0x78,0x06,0xcc,0x0c,0x84,0x08,0x84,
+0x18,0x84,0x10,0xcc,0x00,0x78,0x1e,0x00,0x3f,0x00,0x71,0x80,0x61,0x80,0x61,
+0x80,0x73,0x00,0x3e,0x00,0x1c,0x00,0x7c,0x00,0xee,0x30,0xc7,0x30,0xc3,0xe0,
+0xc1,0xe0,0xc0,0xc0,0x73,0xe0,0x3f,0x70,0xc0,0xc0,0xc0,0xc0,0xc0,0x80,0x04,
+0x0c,0x18,0x30,0x30,0x60,0x60,0x60,0xe0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x60,
+0x60,0x60,0x30,0x30,0x18,0x0c,0x04,0x80,0xc0,0x60,0x30,0x30,0x18,0x18,0x18,
+0x1c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x18,0x18,0x18,0x30,0x30,0x60,0xc0,0x80,
+0x18,0x18,0x9a,0xfe,0x38,0x3c,0x6c,0x04,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,
+0x00,0x0c,0x00,0xff,0xe0,0xff,0xe0,0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0c,0x00,
+0xc0,0xc0,0xc0,0xc0,0x80,0xfc,0xc0,0xc0,0x01,0x01,0x03,0x03,0x06,0x06,0x06,
+0x0c,0x0c,0x08,0x18,0x18,0x30,0x30,0x20,0x60,0x60,0xc0,0xc0,0x1e,0x00,0x3f,
+0x80,0x61,0x80,0x60,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xe0,0xc0,0x61,0xc0,0x73,0x80,0x3f,0x00,0x3c,
+0xfc,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,
+0x1e,0x00,0x3f,0x80,0x61,0xc0,0x60,0xc0,0xe0,0xc0,0x00,0xc0,0x01,0x80,0x03,
+0x80,0x03,0x00,0x06,0x00,0x0c,0x00,0x1c,0x00,0x38,0x00,0x70,0x00,0x7f,0xc0,
+0x7f,0xc0,0x1e,0x00,0x3f,0x80,0x61,0xc0,0xe0,0xc0,0x00,0xc0,0x00,0xc0,0x01,
+0x80,0x1f,0x00,0x1f,0x80,0x01,0xc0,0x00,0xc0,0x00,0xc0,0xc0,0xc0,0x60,0xc0,
+0x7b,0x80,0x3f,0x00,0x03,0x80,0x03,0x80,0x07,0x80,0x0f,0x80,0x0f,0x80,0x1b,
+0x80,0x1b,0x80,0x33,0x80,0x63,0x80,0x63,0x80,0xc3,0x80,0xff,0xe0,0x03,0x80,
+0x03,0x80,0x03,0x80,0x03,0x80,0x7f,0x80,0x7f,0x80,0x60,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xfe,0x00,0xff,0x00,0xc3,0x80,0x01,0x80,0x01,0x80,0x01,0x80,
+0xc1,0x80,0xc3,0x80,0xf7,0x00,0x7e,0x00,0x0f,0x00,0x3f,0x80,0x30,0x00,0x60,
+0x00,0x60,0x00,0x60,0x00,0xef,0x00,0xff,0x80,0xf1,0xc0,0xe0,0xc0,0xe0,0xc0,
+0x60,0xc0,0x60,0xc0,0x70,0xc0,0x3b,0x80,0x1f,0x00,0xff,0xc0,0xff,0xc0,0x00,
+0xc0,0x01,0x80,0x03,0x80,0x03,0x00,0x06,0x00,0x06,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x1c,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1e,0x00,0x3f,
+0x80,0x61,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x71,0x80,0x3f,0x00,0x3f,0x80,
+0x61,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xe0,0xc0,0x7b,0x80,0x3f,0x00,0x1e,
+0x00,0x7f,0x00,0x61,0x80,0xc1,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0x61,0xc0,0x7f,0xc0,0x1c,0xc0,0x00,0xc0,0x01,0xc0,0x01,0x80,0x67,0x80,0x7e,
+0x00,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x80,0x00,0x80,0x03,0x80,
+0x1f,0x00,0x7c,0x00,0xe0,0x00,0xe0,0x00,0x7c,0x00,0x1f,0x00,0x03,0x80,0x00,
+0x80,0xff,0x80,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0xff,0x80,
+0x80,0x00,0xe0,0x00,0x78,0x00,0x1f,0x00,0x03,0xc0,0x01,0xc0,0x0f,0x80,0x3c,
+0x00,0xf0,0x00,0xc0,0x00,0x3c,0x00,0x7f,0x00,0xc3,0x00,0xc3,0x00,0x03,0x80,
+0x03,0x00,0x03,0x00,0x06,0x00,0x0c,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x00,
+0x00,0x00,0x00,0x18,0x00,0x18,0x00,0x0f,0xc0,0x18,0x30,0x30,0x18,0x60,0x08,
+0x43,0xcc,0x46,0x64,0xc4,0x64,0xcc,0x64,0x8c,0x44,0x8c,0x44,0x8c,0x4c,0xcc,
+0xc8,0x47,0x70,0x40,0x00,0x20,0x00,0x38,0x00,0x0f,0xc0,0x06,0x00,0x06,0x00,
+0x0f,0x00,0x0f,0x00,0x0f,0x00,0x19,0x80,0x19,0x80,0x19,0x80,0x30,0xc0,0x30,
+0xc0,0x7f,0xc0,0x7f,0xe0,0x60,0x60,0xc0,0x70,0xc0,0x30,0xc0,0x30,0xfe,0x00,
+0xff,0x80,0xc1,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x80,0xff,0x00,0xff,
+0xc0,0xc0,0xe0,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0xe0,0xff,0xc0,0xff,0x80,
+0x0f,0x80,0x3f,0xc0,0x30,0x60,0x60,0x30,0x60,0x30,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xe0,0x30,0x60,0x30,0x70,0x60,0x39,0xe0,
+0x1f,0x80,0xfe,0x00,0xff,0x80,0xc1,0xc0,0xc0,0xe0,0xc0,0x60,0xc0,0x60,0xc0,
+0x70,0xc0,0x70,0xc0,0x70,0xc0,0x70,0xc0,0x60,0xc0,0x60,0xc0,0xe0,0xc0,0xc0,
+0xff,0x80,0xff,0x00,0xff,0x80,0xff,0x80,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xff,0x00,0xff,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xff,0x80,0xff,0x80,0xff,0xc0,0xff,0xc0,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xff,0x00,0xff,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x0f,0x80,0x3f,0xc0,0x30,0x60,0x60,
+0x30,0x60,0x30,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc3,0xf0,0xc3,0xf0,0xc0,0x30,
+0xe0,0x30,0x60,0x30,0x70,0x30,0x3c,0xf0,0x1f,0xc0,0xc0,0x30,0xc0,0x30,0xc0,
+0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xff,0xf0,0xff,0xf0,0xc0,0x30,
+0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xc0,0x30,0xfc,0xfc,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xfc,0xfc,0x01,0x80,
+0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,
+0x80,0x01,0x80,0x01,0x80,0x01,0x80,0xc1,0x80,0xc1,0x80,0x77,0x00,0x3e,0x00,
+0xc0,0x60,0xc0,0xc0,0xc1,0x80,0xc3,0x80,0xc7,0x00,0xc6,0x00,0xcc,0x00,0xf8,
+0x00,0xfc,0x00,0xcc,0x00,0xc6,0x00,0xc7,0x00,0xc3,0x80,0xc1,0xc0,0xc0,0xe0,
+0xc0,0x60,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,
+0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xff,0xc0,0xff,0xc0,0xe0,0x0c,0xe0,0x1c,0xe0,0x1c,0xf0,0x3c,0xf0,0x3c,0xd8,
+0x3c,0xd8,0x6c,0xd8,0x6c,0xcc,0xcc,0xcc,0xcc,0xc4,0x8c,0xc7,0x8c,0xc7,0x8c,
+0xc3,0x0c,0xc3,0x0c,0xc0,0x0c,0xc0,0x30,0xe0,0x30,0xe0,0x30,0xf0,0x30,0xf8,
+0x30,0xd8,0x30,0xcc,0x30,0xcc,0x30,0xc6,0x30,0xc7,0x30,0xc3,0x30,0xc1,0xb0,
+0xc1,0xf0,0xc0,0xf0,0xc0,0x70,0xc0,0x70,0x0f,0x80,0x3f,0xc0,0x30,0x60,0x60,
+0x30,0x60,0x30,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,
+0xe0,0x38,0x60,0x30,0x70,0x70,0x3f,0xe0,0x1f,0x80,0xfe,0x00,0xff,0x80,0xc0,
+0xc0,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0xc0,0xff,0xc0,0xff,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x0f,0x80,0x3f,
+0xc0,0x30,0x60,0x60,0x30,0x60,0x30,0xc0,0x18,0xc0,0x18,0xc0,0x18,0xc0,0x18,
+0xc0,0x18,0xc0,0x18,0xe0,0x38,0x60,0xb0,0x70,0x70,0x3f,0xf0,0x1f,0xb8,0x00,
+0x18,0xfe,0x00,0xff,0x80,0xc1,0xc0,0xc0,0xc0,0xc0,0xe0,0xc0,0xe0,0xc0,0xc0,
+0xc3,0x80,0xff,0x80,0xc1,0xc0,0xc0,0xc0,0xc0,0xe0,0xc0,0xe0,0xc0,0xe0,0xc0,
+0x60,0xc0,0x60,0x0f,0x00,0x3f,0xc0,0x70,0xe0,0x60,0x60,0x60,0x60,0x60,0x00,
+0x70,0x00,0x3e,0x00,0x0f,0x80,0x01,0xe0,0x00,0x60,0xc0,0x60,0xe0,0x60,0x60,
+0x60,0x79,0xc0,0x1f,0x80,0xff,0xf8,0xff,0xf8,0x07,0x00,0x07,0x00,0x07,0x00,
+0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x07,0x00,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x60,
+0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,0x60,0xc0,
+0x60,0xc0,0x60,0xe0,0xe0,0x7b,0xc0,0x3f,0x80,0xe0,0x1c,0x60,0x18,0x60,0x18,
+0x70,0x38,0x30,0x30,0x30,0x30,0x18,0x60,0x18,0x60,0x18,0x60,0x0c,0xc0,0x0c,
+0xc0,0x0d,0xc0,0x07,0x80,0x07,0x80,0x07,0x00,0x03,0x00,0xc0,0x0c,0xc2,0x0c,
+0xc7,0x0c,0xc7,0x18,0xc7,0x18,0xc5,0x98,0x4d,0x98,0x6d,0x90,0x6c,0xb0,0x68,
+0xf0,0x78,0xf0,0x38,0xf0,0x38,0x60,0x30,0x60,0x30,0x60,0x30,0x20,0xc0,0x30,
+0x60,0x60,0x70,0xe0,0x30,0xc0,0x39,0xc0,0x19,0x80,0x0f,0x00,0x0f,0x00,0x06,
+0x00,0x0f,0x00,0x1f,0x80,0x19,0x80,0x30,0xc0,0x70,0xe0,0x60,0x60,0xe0,0x70,
+0xc0,0x30,0xc0,0x70,0x60,0x60,0x60,0xe0,0x30,0xc0,0x31,0xc0,0x19,0x80,0x1f,
+0x80,0x0f,0x00,0x0e,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,
+0x06,0x00,0xff,0xe0,0xff,0xe0,0x00,0xc0,0x01,0xc0,0x01,0x80,0x03,0x00,0x07,
+0x00,0x06,0x00,0x0c,0x00,0x1c,0x00,0x18,0x00,0x30,0x00,0x70,0x00,0x60,0x00,
+0xff,0xe0,0xff,0xe0,0xf0,0xf0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xf0,0xf0,0xc0,0x00,0xc0,0x00,0x60,
+0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x01,
+0x80,0x01,0x80,0xf0,0xf0,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xf0,0xf0,0x10,0x38,0x38,0x2c,0x6c,0x64,
+0xc6,0xc6,0xff,0xc0,0xff,0xc0,0xc0,0x60,0x20,0x1e,0x00,0x3f,0x80,0x61,0x80,
+0x61,0xc0,0x01,0xc0,0x1f,0xc0,0x7f,0xc0,0xe1,0xc0,0xc1,0xc0,0xc1,0xc0,0x7f,
+0xc0,0x7c,0xc0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xde,0x00,
+0xff,0x00,0xe3,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,
+0x80,0xe1,0x80,0xff,0x00,0xbe,0x00,0x3f,0x00,0x7f,0x80,0x60,0xc0,0xe0,0xc0,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xe0,0xc0,0x60,0xc0,0x7f,0x80,0x1f,
+0x00,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x1c,0xc0,0x3f,0xc0,
+0x61,0xc0,0xe0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x61,
+0xc0,0x7f,0xc0,0x3e,0xc0,0x1e,0x00,0x3f,0x00,0x61,0x80,0xe1,0x80,0xc0,0xc0,
+0xff,0xc0,0xff,0xc0,0xc0,0x00,0xe0,0x00,0x60,0x00,0x79,0x80,0x1f,0x80,0x0e,
+0x1e,0x38,0x30,0x30,0xfc,0xfc,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x1c,0xc0,0x3f,0xc0,0x71,0xc0,0x60,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xe0,0xc0,0x61,0xc0,0x7f,0xc0,0x3e,0xc0,0x00,0xc0,0x00,0xc0,0x61,
+0x80,0x7f,0x80,0x1e,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,
+0xde,0x00,0xff,0x00,0xc3,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,
+0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0x18,0x18,0x00,0x00,0x00,0x78,
+0x78,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xff,0xff,0x18,0x18,0x00,0x00,
+0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x38,0xf0,0xe0,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc3,0x80,
+0xc7,0x00,0xc6,0x00,0xcc,0x00,0xdc,0x00,0xf8,0x00,0xf8,0x00,0xcc,0x00,0xce,
+0x00,0xc6,0x00,0xc3,0x00,0xc3,0x80,0x78,0x78,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xff,0xff,0x9c,0x70,0xfe,0xf8,0xc7,0x98,
+0xc7,0x1c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,0x0c,0xc3,
+0x0c,0xc3,0x0c,0x9e,0x00,0xff,0x00,0xc3,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,
+0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0x1e,0x00,0x3f,
+0x80,0x61,0xc0,0xe0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xe0,0xc0,
+0x61,0xc0,0x7b,0x80,0x1f,0x00,0x9e,0x00,0xbf,0x00,0xc3,0x80,0xc1,0x80,0xc1,
+0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xc1,0x80,0xf7,0x00,0xfe,0x00,
+0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0x1c,0xc0,0x3f,0xc0,0x61,0xc0,0xe0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x61,0xc0,0x73,0xc0,
+0x3e,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x00,0xc0,0x9e,0xfe,0xe0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x1e,0x00,0x7f,0x00,0x61,0x80,0x61,0x80,
+0x60,0x00,0x7c,0x00,0x1f,0x00,0x03,0x80,0xc1,0x80,0xe1,0x80,0x73,0x80,0x3f,
+0x00,0x30,0x00,0x30,0x00,0xff,0x00,0xff,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x31,0x80,0x3f,0x80,0x1e,0x00,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xe1,0xc0,0xff,0xc0,0x7e,0xc0,0xc0,0xc0,0xc1,0x80,0xc1,0x80,0x61,
+0x80,0x63,0x00,0x63,0x00,0x32,0x00,0x36,0x00,0x16,0x00,0x1c,0x00,0x1c,0x00,
+0x0c,0x00,0xc6,0x0c,0xc6,0x0c,0xc7,0x18,0xcf,0x18,0x6d,0x18,0x6d,0x98,0x69,
+0xb0,0x38,0xb0,0x38,0xf0,0x30,0xe0,0x30,0x60,0x10,0x60,0xc1,0x80,0xe3,0x80,
+0x63,0x00,0x36,0x00,0x36,0x00,0x1c,0x00,0x1c,0x00,0x3e,0x00,0x36,0x00,0x63,
+0x00,0xe3,0x80,0xc1,0x80,0xe0,0xe0,0x60,0xc0,0x60,0xc0,0x71,0xc0,0x31,0x80,
+0x31,0x80,0x1b,0x80,0x1b,0x00,0x1b,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0c,
+0x00,0x0c,0x00,0x1c,0x00,0x78,0x00,0x70,0x00,0xff,0x80,0xff,0x80,0x03,0x00,
+0x07,0x00,0x0e,0x00,0x0c,0x00,0x18,0x00,0x38,0x00,0x30,0x00,0x60,0x00,0xff,
+0x80,0xff,0x80,0x0c,0x18,0x38,0x30,0x30,0x30,0x30,0x30,0x30,0xe0,0xc0,0x60,
+0x30,0x30,0x30,0x30,0x30,0x30,0x38,0x1c,0x04,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0x60,0x30,0x30,0x38,0x38,0x38,0x38,0x18,0x1c,0x0e,0x18,0x18,0x38,0x38,
+0x38,0x30,0x30,0x30,0x60,0x40,0x18,0x00,0x7e,0x18,0x67,0x30,0xc3,0xf0,0x00,
+0xc0,
   }
 };
@@ -0,0 +1,695 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Span kernels, see spans.h
+ *
+ * Each row kernel has a NEON or SSE2 body for the bulk of the span and
+ * finishes with the C loop, which is also the whole kernel on the other
+ * cpus. Both compute exactly the same values: a channel is blended as
+ *   (src * f + dst * (256 - f)) >> 8   with f = a + (a >> 7)
+ * 32 bits pixels in 8 bits per channel, RGB565 in 5/6 bits per channel.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "spans.h"
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+# include <arm_neon.h>
+# define SPAN_NEON
+#elif defined(__SSE2__)
+# include <emmintrin.h>
+# define SPAN_SSE2
+#endif
+
+static inline unsigned alpha_factor(unsigned a) {
+    return a + (a >> 7);
+}
+
+// alpha is the high byte for all the 32 bits formats, only R and B swap
+static inline int format_bgr(int format) {
+    return format == GGL_PIXEL_FORMAT_BGRA_8888;
+}
+
+static int format_bpp(int format) {
+    switch (format) {
+    case GGL_PIXEL_FORMAT_RGB_565:
+        return 2;
+    case GGL_PIXEL_FORMAT_RGBA_8888:
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        return 4;
+    }
+    return 0;
+}
+
+static inline uint32_t swap_rb32(uint32_t p) {
+    return (p & 0xff00ff00) | ((p >> 16) & 0xff) | ((p & 0xff) << 16);
+}
+
+static inline uint16_t pack565(unsigned r, unsigned g, unsigned b) {
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+static inline uint16_t rgb32_to_565(uint32_t p, int bgr) {
+    unsigned lo = p & 0xff, g = (p >> 8) & 0xff, hi = (p >> 16) & 0xff;
+    return bgr ? pack565(hi, g, lo) : pack565(lo, g, hi);
+}
+
+// two channels per multiply, 16 bits per channel can't overflow
+static inline uint32_t blend32(uint32_t s, uint32_t d, unsigned f) {
+    unsigned inv = 256 - f;
+    uint32_t rb = (((s & 0xff00ff) * f + (d & 0xff00ff) * inv) >> 8) & 0xff00ff;
+    uint32_t ag = (((s >> 8) & 0xff00ff) * f + ((d >> 8) & 0xff00ff) * inv) & 0xff00ff00;
+    return rb | ag;
+}
+
+static inline uint16_t blend565(uint16_t s, uint16_t d, unsigned f) {
+    unsigned inv = 256 - f;
+    unsigned r = ((s >> 11) * f + (d >> 11) * inv) >> 8;
+    unsigned g = (((s >> 5) & 63) * f + ((d >> 5) & 63) * inv) >> 8;
+    unsigned b = ((s & 31) * f + (d & 31) * inv) >> 8;
+    return (r << 11) | (g << 5) | b;
+}
+
+#if defined(SPAN_SSE2)
+
+static inline __m128i blend_epi16(__m128i s, __m128i d, __m128i f, __m128i inv) {
+    return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s, f),
+                                        _mm_mullo_epi16(d, inv)), 8);
+}
+
+static inline __m128i factor_epi16(__m128i a) {
+    return _mm_add_epi16(a, _mm_srli_epi16(a, 7));
+}
+
+// 4 pixels of 32 bits, flo for the pixels 0-1 and fhi for 2-3
+static inline __m128i blend4x32(__m128i s, __m128i d, __m128i flo, __m128i fhi) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i k256 = _mm_set1_epi16(256);
+    __m128i lo = blend_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero),
+                             flo, _mm_sub_epi16(k256, flo));
+    __m128i hi = blend_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero),
+                             fhi, _mm_sub_epi16(k256, fhi));
+    return _mm_packus_epi16(lo, hi);
+}
+
+// 8 pixels of RGB565, s is the source color split in channels
+static inline __m128i blend8x565(__m128i d, __m128i sr, __m128i sg, __m128i sb, __m128i f) {
+    const __m128i m6 = _mm_set1_epi16(63);
+    const __m128i m5 = _mm_set1_epi16(31);
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(256), f);
+    __m128i r = blend_epi16(sr, _mm_srli_epi16(d, 11), f, inv);
+    __m128i g = blend_epi16(sg, _mm_and_si128(_mm_srli_epi16(d, 5), m6), f, inv);
+    __m128i b = blend_epi16(sb, _mm_and_si128(d, m5), f, inv);
+    return _mm_or_si128(_mm_slli_epi16(r, 11), _mm_or_si128(_mm_slli_epi16(g, 5), b));
+}
+
+#elif defined(SPAN_NEON)
+
+static inline uint8x8_t blend_u8x8(uint8x8_t s, uint8x8_t d, uint16x8_t f) {
+    uint16x8_t inv = vsubq_u16(vdupq_n_u16(256), f);
+    return vshrn_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(s), f), vmovl_u8(d), inv), 8);
+}
+
+static inline uint16x8_t factor_u16(uint8x8_t a) {
+    uint16x8_t f = vmovl_u8(a);
+    return vaddq_u16(f, vshrq_n_u16(f, 7));
+}
+
+// 4 pixels of 32 bits, flo for the pixels 0-1 and fhi for 2-3
+static inline uint8x16_t blend4x32(uint8x16_t s, uint8x16_t d, uint16x8_t flo, uint16x8_t fhi) {
+    return vcombine_u8(blend_u8x8(vget_low_u8(s), vget_low_u8(d), flo),
+                       blend_u8x8(vget_high_u8(s), vget_high_u8(d), fhi));
+}
+
+static inline uint16x8_t blend_u16(uint16x8_t s, uint16x8_t d, uint16x8_t f, uint16x8_t inv) {
+    return vshrq_n_u16(vmlaq_u16(vmulq_u16(s, f), d, inv), 8);
+}
+
+// 8 pixels of RGB565, s is the source color split in channels
+static inline uint16x8_t blend8x565(uint16x8_t d, uint16x8_t sr, uint16x8_t sg, uint16x8_t sb,
+                                    uint16x8_t f) {
+    uint16x8_t inv = vsubq_u16(vdupq_n_u16(256), f);
+    uint16x8_t r = blend_u16(sr, vshrq_n_u16(d, 11), f, inv);
+    uint16x8_t g = blend_u16(sg, vandq_u16(vshrq_n_u16(d, 5), vdupq_n_u16(63)), f, inv);
+    uint16x8_t b = blend_u16(sb, vandq_u16(d, vdupq_n_u16(31)), f, inv);
+    return vorrq_u16(vshlq_n_u16(r, 11), vorrq_u16(vshlq_n_u16(g, 5), b));
+}
+
+// vtbl indexes replicating the bytes 0,1 / 2,3 / 3,7 over 4 lanes
+#define NEON_IDX_01 0x0101010100000000ULL
+#define NEON_IDX_23 0x0303030302020202ULL
+#define NEON_IDX_A  0x0707070703030303ULL
+
+#endif
+
+/*
+ * Row kernels
+ */
+
+static void fill32_row(uint32_t *d, int n, uint32_t p)
+{
+#if defined(SPAN_SSE2)
+    __m128i v = _mm_set1_epi32(p);
+    for (; n >= 4; n -= 4, d += 4)
+        _mm_storeu_si128((__m128i *) d, v);
+#elif defined(SPAN_NEON)
+    uint32x4_t v = vdupq_n_u32(p);
+    for (; n >= 4; n -= 4, d += 4)
+        vst1q_u32(d, v);
+#endif
+    while (n-- > 0)
+        *d++ = p;
+}
+
+static void fill16_row(uint16_t *d, int n, uint16_t p)
+{
+#if defined(SPAN_SSE2)
+    __m128i v = _mm_set1_epi16(p);
+    for (; n >= 8; n -= 8, d += 8)
+        _mm_storeu_si128((__m128i *) d, v);
+#elif defined(SPAN_NEON)
+    uint16x8_t v = vdupq_n_u16(p);
+    for (; n >= 8; n -= 8, d += 8)
+        vst1q_u16(d, v);
+#endif
+    while (n-- > 0)
+        *d++ = p;
+}
+
+static void blend32_row(uint32_t *d, int n, uint32_t p, unsigned f)
+{
+#if defined(SPAN_SSE2)
+    __m128i s = _mm_set1_epi32(p);
+    __m128i fv = _mm_set1_epi16(f);
+    for (; n >= 4; n -= 4, d += 4) {
+        __m128i dv = _mm_loadu_si128((__m128i *) d);
+        _mm_storeu_si128((__m128i *) d, blend4x32(s, dv, fv, fv));
+    }
+#elif defined(SPAN_NEON)
+    uint8x16_t s = vreinterpretq_u8_u32(vdupq_n_u32(p));
+    uint16x8_t fv = vdupq_n_u16(f);
+    for (; n >= 4; n -= 4, d += 4) {
+        uint8x16_t dv = vreinterpretq_u8_u32(vld1q_u32(d));
+        vst1q_u32(d, vreinterpretq_u32_u8(blend4x32(s, dv, fv, fv)));
+    }
+#endif
+    for (; n > 0; n--, d++)
+        *d = blend32(p, *d, f);
+}
+
+static void blend16_row(uint16_t *d, int n, uint16_t p, unsigned f)
+{
+#if defined(SPAN_SSE2)
+    __m128i sr = _mm_set1_epi16(p >> 11);
+    __m128i sg = _mm_set1_epi16((p >> 5) & 63);
+    __m128i sb = _mm_set1_epi16(p & 31);
+    __m128i fv = _mm_set1_epi16(f);
+    for (; n >= 8; n -= 8, d += 8) {
+        __m128i dv = _mm_loadu_si128((__m128i *) d);
+        _mm_storeu_si128((__m128i *) d, blend8x565(dv, sr, sg, sb, fv));
+    }
+#elif defined(SPAN_NEON)
+    uint16x8_t sr = vdupq_n_u16(p >> 11);
+    uint16x8_t sg = vdupq_n_u16((p >> 5) & 63);
+    uint16x8_t sb = vdupq_n_u16(p & 31);
+    uint16x8_t fv = vdupq_n_u16(f);
+    for (; n >= 8; n -= 8, d += 8)
+        vst1q_u16(d, blend8x565(vld1q_u16(d), sr, sg, sb, fv));
+#endif
+    for (; n > 0; n--, d++)
+        *d = blend565(p, *d, f);
+}
+
+// glyph coverage m, 0 and 255 are the common case
+static void mask32_row(uint32_t *d, const uint8_t *m, int n, uint32_t p)
+{
+#if defined(SPAN_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i s = _mm_set1_epi32(p);
+    for (; n >= 4; n -= 4, d += 4, m += 4) {
+        uint32_t mm;
+        __m128i mv;
+        memcpy(&mm, m, 4);
+        if (mm == 0)
+            continue;
+        if (mm == 0xffffffff) {
+            _mm_storeu_si128((__m128i *) d, s);
+            continue;
+        }
+        mv = _mm_cvtsi32_si128(mm);
+        mv = _mm_unpacklo_epi8(mv, mv);
+        mv = _mm_unpacklo_epi16(mv, mv);
+        _mm_storeu_si128((__m128i *) d,
+            blend4x32(s, _mm_loadu_si128((__m128i *) d),
+                      factor_epi16(_mm_unpacklo_epi8(mv, zero)),
+                      factor_epi16(_mm_unpackhi_epi8(mv, zero))));
+    }
+#elif defined(SPAN_NEON)
+    uint8x16_t s = vreinterpretq_u8_u32(vdupq_n_u32(p));
+    for (; n >= 4; n -= 4, d += 4, m += 4) {
+        uint32_t mm;
+        uint8x8_t mv;
+        memcpy(&mm, m, 4);
+        if (mm == 0)
+            continue;
+        if (mm == 0xffffffff) {
+            vst1q_u32(d, vreinterpretq_u32_u8(s));
+            continue;
+        }
+        mv = vcreate_u8(mm);
+        vst1q_u32(d, vreinterpretq_u32_u8(
+            blend4x32(s, vreinterpretq_u8_u32(vld1q_u32(d)),
+                      factor_u16(vtbl1_u8(mv, vcreate_u8(NEON_IDX_01))),
+                      factor_u16(vtbl1_u8(mv, vcreate_u8(NEON_IDX_23))))));
+    }
+#endif
+    for (; n > 0; n--, d++, m++) {
+        if (*m == 255)
+            *d = p;
+        else if (*m)
+            *d = blend32(p, *d, alpha_factor(*m));
+    }
+}
+
+static void mask16_row(uint16_t *d, const uint8_t *m, int n, uint16_t p)
+{
+#if defined(SPAN_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i s = _mm_set1_epi16(p);
+    __m128i sr = _mm_set1_epi16(p >> 11);
+    __m128i sg = _mm_set1_epi16((p >> 5) & 63);
+    __m128i sb = _mm_set1_epi16(p & 31);
+    for (; n >= 8; n -= 8, d += 8, m += 8) {
+        uint64_t mm;
+        __m128i f;
+        memcpy(&mm, m, 8);
+        if (mm == 0)
+            continue;
+        if (mm == ~0ULL) {
+            _mm_storeu_si128((__m128i *) d, s);
+            continue;
+        }
+        f = factor_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) m), zero));
+        _mm_storeu_si128((__m128i *) d,
+            blend8x565(_mm_loadu_si128((__m128i *) d), sr, sg, sb, f));
+    }
+#elif defined(SPAN_NEON)
+    uint16x8_t s = vdupq_n_u16(p);
+    uint16x8_t sr = vdupq_n_u16(p >> 11);
+    uint16x8_t sg = vdupq_n_u16((p >> 5) & 63);
+    uint16x8_t sb = vdupq_n_u16(p & 31);
+    for (; n >= 8; n -= 8, d += 8, m += 8) {
+        uint64_t mm;
+        memcpy(&mm, m, 8);
+        if (mm == 0)
+            continue;
+        if (mm == ~0ULL) {
+            vst1q_u16(d, s);
+            continue;
+        }
+        vst1q_u16(d, blend8x565(vld1q_u16(d), sr, sg, sb, factor_u16(vcreate_u8(mm))));
+    }
+#endif
+    for (; n > 0; n--, d++, m++) {
+        if (*m == 255)
+            *d = p;
+        else if (*m)
+            *d = blend565(p, *d, alpha_factor(*m));
+    }
+}
+
+// RGBA source over a destination of the same byte order
+static void over32_row(uint32_t *d, const uint32_t *s, int n)
+{
+#if defined(SPAN_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; n >= 4; n -= 4, d += 4, s += 4) {
+        __m128i sv = _mm_loadu_si128((const __m128i *) s);
+        __m128i alo = _mm_unpacklo_epi8(sv, zero);
+        __m128i ahi = _mm_unpackhi_epi8(sv, zero);
+        alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(alo, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+        ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(ahi, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+        _mm_storeu_si128((__m128i *) d,
+            blend4x32(sv, _mm_loadu_si128((__m128i *) d),
+                      factor_epi16(alo), factor_epi16(ahi)));
+    }
+#elif defined(SPAN_NEON)
+    for (; n >= 4; n -= 4, d += 4, s += 4) {
+        uint8x16_t sv = vreinterpretq_u8_u32(vld1q_u32(s));
+        vst1q_u32(d, vreinterpretq_u32_u8(
+            blend4x32(sv, vreinterpretq_u8_u32(vld1q_u32(d)),
+                      factor_u16(vtbl1_u8(vget_low_u8(sv), vcreate_u8(NEON_IDX_A))),
+                      factor_u16(vtbl1_u8(vget_high_u8(sv), vcreate_u8(NEON_IDX_A))))));
+    }
+#endif
+    for (; n > 0; n--, d++, s++) {
+        unsigned a = *s >> 24;
+        if (a == 255)
+            *d = *s;
+        else if (a)
+            *d = blend32(*s, *d, alpha_factor(a));
+    }
+}
+
+/*
+ * Blits with a format conversion, not used by the common formats pairs
+ * (RGBX/RGBA images into a RGBA/RGBX framebuffer), scalar only.
+ */
+
+static void copy32_swap_row(uint32_t *d, const uint32_t *s, int n)
+{
+    for (; n > 0; n--)
+        *d++ = swap_rb32(*s++);
+}
+
+static void copy565_row(uint16_t *d, const uint32_t *s, int n, int bgr)
+{
+    for (; n > 0; n--)
+        *d++ = rgb32_to_565(*s++, bgr);
+}
+
+// per pixel alpha if f < 0, else a constant factor (RGBX sources)
+static void over32_swap_row(uint32_t *d, const uint32_t *s, int n, int f)
+{
+    for (; n > 0; n--, d++, s++) {
+        unsigned a = f < 0 ? alpha_factor(*s >> 24) : (unsigned) f;
+        if (a)
+            *d = blend32(swap_rb32(*s), *d, a);
+    }
+}
+
+static void over32_const_row(uint32_t *d, const uint32_t *s, int n, unsigned f)
+{
+    for (; n > 0; n--, d++, s++)
+        *d = blend32(*s, *d, f);
+}
+
+static void over565_row(uint16_t *d, const uint32_t *s, int n, int bgr, int f)
+{
+    for (; n > 0; n--, d++, s++) {
+        unsigned a = f < 0 ? alpha_factor(*s >> 24) : (unsigned) f;
+        if (a >= 256)
+            *d = rgb32_to_565(*s, bgr);
+        else if (a)
+            *d = blend565(rgb32_to_565(*s, bgr), *d, a);
+    }
+}
+
+/*
+ * Rectangles
+ */
+
+int span_supported(int format)
+{
+    return format_bpp(format) != 0;
+}
+
+void span_set_color(struct span_color *c, int format,
+                    uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    c->r = r;
+    c->g = g;
+    c->b = b;
+    c->a = a;
+    c->format = format;
+
+    if (format == GGL_PIXEL_FORMAT_RGB_565)
+        c->pixel = pack565(r, g, b);
+    else if (format_bgr(format))
+        c->pixel = ((uint32_t) a << 24) | ((uint32_t) r << 16) |
+                   ((uint32_t) g << 8) | (uint32_t) b;
+    else
+        c->pixel = ((uint32_t) a << 24) | ((uint32_t) b << 16) |
+                   ((uint32_t) g << 8) | (uint32_t) r;
+}
+
+void span_fill_rect(GGLSurface *dst, int x, int y, int w, int h,
+                    const struct span_color *c)
+{
+    int bpp = format_bpp(dst->format);
+    size_t pitch = dst->stride * bpp;
+    uint8_t *row = (uint8_t *) dst->data + y * pitch + x * bpp;
+    unsigned f = alpha_factor(c->a);
+
+    if (w <= 0 || h <= 0 || c->a == 0)
+        return;
+
+    for (; h > 0; h--, row += pitch) {
+        if (bpp == 2) {
+            if (c->a == 255)
+                fill16_row((uint16_t *) row, w, c->pixel);
+            else
+                blend16_row((uint16_t *) row, w, c->pixel, f);
+        } else {
+            if (c->a == 255)
+                fill32_row((uint32_t *) row, w, c->pixel);
+            else
+                blend32_row((uint32_t *) row, w, c->pixel, f);
+        }
+    }
+}
+
+int span_blit_rect(GGLSurface *dst, int dx, int dy,
+                   const GGLSurface *src, int sx, int sy, int w, int h,
+                   const struct span_color *c)
+{
+    int bpp = format_bpp(dst->format);
+    size_t pitch = dst->stride * bpp;
+    uint8_t *drow = (uint8_t *) dst->data + dy * pitch + dx * bpp;
+    int src_bpp = src->format == GGL_PIXEL_FORMAT_A_8 ? 1 : 4;
+    size_t src_pitch = src->stride * src_bpp;
+    const uint8_t *srow = (const uint8_t *) src->data + sy * src_pitch + sx * src_bpp;
+    int src_bgr = format_bgr(src->format);
+    int swap = src_bgr != format_bgr(dst->format);
+    int f = -1;
+
+    switch (src->format) {
+    case GGL_PIXEL_FORMAT_A_8:
+    case GGL_PIXEL_FORMAT_RGBA_8888:
+    case GGL_PIXEL_FORMAT_BGRA_8888:
+        break;
+    case GGL_PIXEL_FORMAT_RGBX_8888:
+        // no alpha in the texture, the one of the color is used
+        if (c->a == 0)
+            return 0;
+        f = alpha_factor(c->a);
+        break;
+    default:
+        return -1;
+    }
+
+    if (w <= 0 || h <= 0)
+        return 0;
+
+    for (; h > 0; h--, drow += pitch, srow += src_pitch) {
+        const uint32_t *s = (const uint32_t *) srow;
+
+        if (src->format == GGL_PIXEL_FORMAT_A_8) {
+            // the alpha of the fragment is the one of the texture
+            if (bpp == 2)
+                mask16_row((uint16_t *) drow, srow, w, c->pixel);
+            else
+                mask32_row((uint32_t *) drow, srow, w, c->pixel | 0xff000000);
+        } else if (bpp == 2) {
+            if (f == 256)
+                copy565_row((uint16_t *) drow, s, w, src_bgr);
+            else
+                over565_row((uint16_t *) drow, s, w, src_bgr, f);
+        } else if (swap) {
+            if (f == 256)
+                copy32_swap_row((uint32_t *) drow, s, w);
+            else
+                over32_swap_row((uint32_t *) drow, s, w, f);
+        } else {
+            if (f == 256)
+                memcpy(drow, s, w * 4);
+            else if (f < 0)
+                over32_row((uint32_t *) drow, s, w);
+            else
+                over32_const_row((uint32_t *) drow, s, w, f);
+        }
+    }
+    return 0;
+}
+
+void span_copy_rect(GGLSurface *dst, int dx, int dy,
+                    const GGLSurface *src, int sx, int sy, int w, int h)
+{
+    int bpp = format_bpp(dst->format);
+    size_t pitch = dst->stride * bpp;
+    size_t src_pitch = src->stride * bpp;
+    uint8_t *drow = (uint8_t *) dst->data + dy * pitch + dx * bpp;
+    const uint8_t *srow = (const uint8_t *) src->data + sy * src_pitch + sx * bpp;
+
+    if (w <= 0 || h <= 0)
+        return;
+
+    // whole rows of the same stride are one copy
+    if (pitch == src_pitch && w == (int) dst->stride) {
+        memmove(drow, srow, pitch * h);
+        return;
+    }
+    // moved down within a surface, the last rows are copied first
+    if (dst->data == src->data && drow > srow) {
+        drow += (h - 1) * pitch;
+        srow += (h - 1) * src_pitch;
+        for (; h > 0; h--, drow -= pitch, srow -= src_pitch)
+            memmove(drow, srow, w * bpp);
+        return;
+    }
+    for (; h > 0; h--, drow += pitch, srow += src_pitch)
+        memmove(drow, srow, w * bpp);
+}
+
+/*
+ * Glyph span cache
+ */
+
+// runs of set bits of a packed glyph, only counted if runs is NULL
+static unsigned glyph_runs(const struct CGlyph *g, const uint8_t *bits,
+                           struct span_run *runs)
+{
+    unsigned pitch = (g->w + 7) / 8;
+    unsigned count = 0;
+    unsigned x, y;
+
+    for (y = 0; y < g->h; y++, bits += pitch) {
+        for (x = 0; x < g->w; ) {
+            unsigned start;
+            if (!(bits[x / 8] & (0x80 >> (x % 8)))) {
+                x++;
+                continue;
+            }
+            for (start = x; x < g->w && (bits[x / 8] & (0x80 >> (x % 8))); x++) {}
+            if (runs) {
+                runs[count].x = g->x + start;
+                runs[count].y = g->y + y;
+                runs[count].len = x - start;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+static void span_font_load(struct span_font *f, unsigned i)
+{
+    const struct CGlyph *g = &f->cfont->glyphs[i];
+    const uint8_t *bits = f->cfont->bits + g->offset;
+    unsigned count = glyph_runs(g, bits, NULL);
+
+    if (count) {
+        f->runs[i] = malloc(count * sizeof(struct span_run));
+        if (f->runs[i] == NULL)
+            return; // not drawn, tried again next time
+        glyph_runs(g, bits, f->runs[i]);
+    }
+    f->count[i] = count;
+    f->loaded[i] = 1;
+}
+
+void span_font_init(struct span_font *f, const struct CFont *cfont)
+{
+    memset(f, 0, sizeof(*f));
+    f->cfont = cfont;
+}
+
+void span_font_expand(struct span_font *f)
+{
+    unsigned i;
+
+    for (i = 0; i < CFONT_GLYPHS; i++) {
+        if (!f->loaded[i])
+            span_font_load(f, i);
+    }
+}
+
+void span_font_free(struct span_font *f)
+{
+    unsigned i;
+
+    for (i = 0; i < CFONT_GLYPHS; i++)
+        free(f->runs[i]);
+    memset(f, 0, sizeof(*f));
+}
+
+void span_text(GGLSurface *dst, struct span_font *f, int x, int y, const char *s,
+               int left, int top, int right, int bottom, const struct span_color *c)
+{
+    int bpp = format_bpp(dst->format);
+    size_t pitch = dst->stride * bpp;
+    uint8_t *base = (uint8_t *) dst->data;
+    int cwidth = f->cfont->cwidth;
+    int cheight = f->cfont->cheight;
+    // glyphs are opaque where covered
+    uint32_t p = bpp == 4 ? c->pixel | 0xff000000 : c->pixel;
+    const unsigned char *ch;
+
+    if (y >= bottom || y + cheight <= top)
+        return;
+
+    for (ch = (const unsigned char *) s; *ch && x < right; ch++, x += cwidth) {
+        unsigned off = *ch - 32;
+        int inside;
+        unsigned i;
+
+        if (off >= CFONT_GLYPHS || x + cwidth <= left)
+            continue;
+        if (!f->loaded[off])
+            span_font_load(f, off);
+
+        // only the glyphs on the edges of the clip rect need clipping
+        inside = x >= left && x + cwidth <= right && y >= top && y + cheight <= bottom;
+
+        for (i = 0; i < f->count[off]; i++) {
+            const struct span_run *r = &f->runs[off][i];
+            int ry = y + r->y;
+            int x1 = x + r->x;
+            int x2 = x1 + r->len;
+            uint8_t *row;
+
+            if (!inside) {
+                if (ry < top || ry >= bottom)
+                    continue;
+                if (x1 < left) x1 = left;
+                if (x2 > right) x2 = right;
+                if (x1 >= x2)
+                    continue;
+            }
+
+            row = base + ry * pitch + x1 * bpp;
+            if (bpp == 2)
+                fill16_row((uint16_t *) row, x2 - x1, p);
+            else
+                fill32_row((uint32_t *) row, x2 - x1, p);
+        }
+    }
+}
+
+const char *span_impl_name(void)
+{
+#if defined(SPAN_NEON)
+    return "neon";
+#elif defined(SPAN_SSE2)
+    return "sse2";
+#else
+    return "c";
+#endif
+}
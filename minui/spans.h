@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2012 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _MINUI_SPANS_H_
+#define _MINUI_SPANS_H_
+
+#include <stdint.h>
+#include <pixelflinger/pixelflinger.h>
+
+#include "minui.h"
+
+/*
+ * Native span kernels, used instead of pixelflinger for the primitives
+ * of the ui (rectangles, axis aligned lines, blits and glyphs) when the
+ * destination is one of the framebuffer formats:
+ *   RGB_565, RGBA_8888, RGBX_8888 and BGRA_8888.
+ *
+ * The blending matches the GGL_SRC_ALPHA / GGL_ONE_MINUS_SRC_ALPHA state
+ * set by gr_init(), with the GGL_REPLACE texture env:
+ *   - RGBX blits take the alpha of the current color,
+ *   - RGBA/BGRA blits the alpha of each source pixel,
+ *   - A_8 (glyphs) the color of the current color and the texture alpha.
+ * Alpha 255 is a plain store.
+ *
+ * Rectangles must be clipped by the caller.
+ */
+
+struct span_color {
+    uint32_t pixel;     // packed in the destination format
+    uint8_t r, g, b, a;
+    int format;
+};
+
+// returns 1 if the kernels can draw into surfaces of this format
+int span_supported(int format);
+
+// a color for the destination format, r g b a in 0..255
+void span_set_color(struct span_color *c, int format,
+                    uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+
+void span_fill_rect(GGLSurface *dst, int x, int y, int w, int h,
+                    const struct span_color *c);
+
+// src is RGBX_8888, RGBA_8888, BGRA_8888 or A_8, returns -1 otherwise
+int span_blit_rect(GGLSurface *dst, int dx, int dy,
+                   const GGLSurface *src, int sx, int sy, int w, int h,
+                   const struct span_color *c);
+
+// plain copy, src must be in the format of dst and opaque. src may be
+// dst, the rectangles overlapping (scrolling).
+void span_copy_rect(GGLSurface *dst, int dx, int dy,
+                    const GGLSurface *src, int sx, int sy, int w, int h);
+
+/*
+ * Glyph span cache: each glyph of a packed font as runs of covered pixels,
+ * so a glyph is drawn with a few row stores. Glyphs are expanded the first
+ * time they are drawn.
+ */
+struct span_run {
+    uint8_t x;
+    uint8_t y;
+    uint8_t len;
+};
+
+struct span_font {
+    const struct CFont *cfont;
+    struct span_run *runs[CFONT_GLYPHS];
+    uint16_t count[CFONT_GLYPHS];
+    uint8_t loaded[CFONT_GLYPHS];
+};
+
+void span_font_init(struct span_font *f, const struct CFont *cfont);
+void span_font_free(struct span_font *f);
+// expand all the glyphs now, span_text() can then be called from several
+// threads at once
+void span_font_expand(struct span_font *f);
+
+// draw a string, (x, y) is the top left corner of the first glyph,
+// [left, right) x [top, bottom) must be inside dst.
+void span_text(GGLSurface *dst, struct span_font *f, int x, int y, const char *s,
+               int left, int top, int right, int bottom, const struct span_color *c);
+
+// name of the kernels compiled in ("neon", "sse2" or "c")
+const char *span_impl_name(void);
+
+#endif /* _MINUI_SPANS_H_ */
@@ -16,12 +16,17 @@
 
 #include <linux/input.h>
 #include <pthread.h>
+#include <sched.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <linux/netlink.h>
+#include <sys/eventfd.h>
 #include <sys/reboot.h>
+#include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/timerfd.h>
 #include <time.h>
 #include <unistd.h>
 #include <sys/time.h>
@@ -47,23 +52,28 @@ static int SQUARE_LEFT=20;
 #define ROW_HEIGHT 100
 #define STATUSBAR_HEIGHT 40
 #define TABCONTROL_HEIGHT 90
+// the divider line below the tabs overflows by 2 rows
+#define TABCONTROL_LAYER_HEIGHT (TABCONTROL_HEIGHT+2)
 static char** tabitems;
 static int activeTab = 0;
 
+// for logs, no menu items
+#define TAB_LOG 2
+
 static int square_inner_top;
 static int square_inner_right;
 static int square_inner_bottom;
 static int square_inner_left;
 
-#define REDRAWTHREAD_SLOW_FPS 1  /* idle state */
 #define REDRAWTHREAD_FAST_FPS 60 /* max "fps", for slides */
-static int redraw_idle_timeout = 200; /* go to idle after N redraw loops */
+#define REDRAWTHREAD_MIN_FPS  20 /* slides on boards too slow for the max */
 static pthread_mutex_t gUpdateMutex = PTHREAD_MUTEX_INITIALIZER;
 
 /* Progress bar, background and other pngs */
 static gr_surface gBackgroundIcon[NUM_BACKGROUND_ICONS];
 
 #define PROGRESSBAR_INDETERMINATE_FPS 15
+#define PROGRESSBAR_FRAME_NS (1000000000ULL / PROGRESSBAR_INDETERMINATE_FPS)
 #define PROGRESSBAR_INDETERMINATE_STATES 1
 static gr_surface gProgressBarIndeterminate[PROGRESSBAR_INDETERMINATE_STATES];
 static gr_surface gProgressBarEmpty;
@@ -88,7 +98,8 @@ static enum ProgressBarType {
 
 // Progress bar scope of current operation
 static float gProgressScopeStart = 0, gProgressScopeSize = 0, gProgress = 0;
-static time_t gProgressScopeTime, gProgressScopeDuration;
+static time_t gProgressScopeDuration;
+static uint64_t gProgressScopeTime; // monotonic ns, also starts the animation
 
 // Set to 1 when both graphics pages are the same (except for the progress bar)
 static int gPagesIdentical = 0;
@@ -97,6 +108,7 @@ static int gPagesIdentical = 0;
 static char text[MAX_ROWS][MAX_COLS];
 static int text_cols = 0, text_rows = 0;
 static int text_col = 0, text_row = 0, text_top = 0;
+static unsigned text_lines = 0;   // lines before the one of text_row
 static int show_text = 0;
 
 // Progression % used for battery level
@@ -110,11 +122,26 @@ static int menu_show_start = 0;             // this is line which menu display i
 static char menu_headers[MAX_ROWS][MAX_COLS];
 static int menu_header_lines = 0;
 
-// Key event input queue
-static pthread_mutex_t key_queue_mutex = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t key_queue_cond = PTHREAD_COND_INITIALIZER;
-static struct ui_input_event key_queue[256];
-static int key_queue_len = 0;
+// Input event queue: a ring written by the event loop (input_callback)
+// and read by the thread waiting for input (ui_wait_input), without lock.
+// Head and tail only grow, the reader sleeping on key_queue_fd is woken
+// when the queue stops being empty. While the reader is late and the ring
+// is full, the loop keeps the next events in order in key_queue_spill,
+// and moves them to the ring once the reader made room and woke it.
+#define KEY_QUEUE_SIZE 256          // power of 2
+static struct ui_input_event key_queue[KEY_QUEUE_SIZE];
+static volatile unsigned key_queue_head = 0;  // next slot written
+static volatile unsigned key_queue_tail = 0;  // next slot read
+static int key_queue_fd = -1;                 // eventfd
+static struct ui_input_event *key_queue_spill = NULL;  // loop thread only
+static int key_queue_spill_len = 0;
+static int key_queue_spill_size = 0;
+static volatile int key_queue_spilling = 0;     // the reader wakes the loop
+static volatile unsigned key_queue_clears = 0;  // ui_clear_key_queue() calls
+static unsigned key_queue_spill_clears = 0;     // the last seen by the loop
+static unsigned key_queue_spilled = 0;
+static unsigned key_queue_dropped = 0;          // out of memory
+static unsigned key_queue_drags_merged = 0;     // read over by a newer drag
 static volatile char key_pressed[KEY_MAX + 1];
 static int evt_enabled = 0;
 
@@ -140,14 +167,103 @@ static int bounceback_targetpos = 0;
 
 static int show_menu_selection=0;
 
-// threads ids (reset to 0 to stop them)
-static pthread_t t_input = 0;
-static pthread_t t_redraw = 0;
-static pthread_t t_progress = 0;
+// event loop thread: input, redraw and progress (reset loop_running to stop it)
+static pthread_t t_loop = 0;
+static volatile int loop_running = 0;
+static int loop_wakefd = -1;      // eventfd, poked when the ui state changed
+static int frame_timerfd = -1;    // armed while a slide is animating
+static int progress_timerfd = -1; // armed while a progress bar is moving
+static int status_timerfd = -1;   // wall clock, next minute of the status bar clock
+static int idle_timerfd = -1;     // next step of the idle display policy
+static int uevent_fd = -1;        // power supply changes, for the usb and battery state
+static int frame_timer_fps = 0;
+static uint64_t progress_timer_due = 0;
+static uint64_t status_timer_due = 0;
+static uint64_t idle_timer_due = 0;
+
+// only used by the loop thread
+static int redraw_pending = 0;
+static int frame_due = 0;
+
+// protected by gUpdateMutex
+static int ui_ready = 0;
+static int redraw_enabled = 0;
+static int render_hud = 0;
+
+// Idle display: dimmed, then blanked without input. Nothing is drawn and
+// no timer but the idle one is armed while blanked. Protected by gUpdateMutex.
+enum { IDLE_ACTIVE, IDLE_DIMMED, IDLE_BLANKED, IDLE_STATES };
+static int idle_dim_timeout = 0;    // seconds, 0 never
+static int idle_blank_timeout = 0;  // seconds, 0 never
+static int idle_dim_brightness = 0;
+static int idle_state = IDLE_ACTIVE;
+static int idle_brightness = -1;    // of the backlight before it was dimmed
+static uint64_t idle_input_time;    // last input, monotonic ns
+static uint64_t idle_state_time;    // idle_state entered
+static uint64_t idle_time[IDLE_STATES];
+
+// What a frame shows, copied from the state above by ui_snapshot(). The
+// loop thread draws from this copy without gUpdateMutex: the writers of
+// the state only take it among themselves, and make ui_seq odd while they
+// write. Drawing holds render_mutex instead, for what must wait for the
+// frame being drawn (ui_stop_redraw, and the items of a menu).
+struct ui_view {
+  int show_menu;
+  int show_text;
+  int tab;
+  char **tabs;
+  gr_surface icon;
+  int hud;
+
+  struct UiMenuItem *menu;
+  int menu_items;
+  int menu_sel;
+  int selection;      // show_menu_selection
+  int menu_top;
+  int scrolling;
+  int pointerx, pointery;
+  int pointerx_start, pointery_start;
+
+  int progress_type;
+  float progress_start, progress_size, progress;
+  uint64_t progress_time;
+  float percent;
+
+  char text[MAX_ROWS][MAX_COLS];
+  int text_rows, text_row, text_top;
+  unsigned text_lines;
+};
+
+static volatile unsigned ui_seq = 0;
+static pthread_mutex_t render_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct ui_view view;  // only used by the loop thread
+
+// Static parts of the screen are drawn once into offscreen layers, which
+// are copied to the screen on each frame. A layer is only redrawn when
+// what it shows changed. Without layers (no memory), all is drawn directly.
+struct statusbar {
+  char clock[16];
+  char usb[16];
+  char battery[16];
+  char hud[32];
+};
+
+static gr_surface layer_background; // whole screen: background, icon and log shade
+static gr_surface layer_shaded;     // with the log shade, so that tabs switch without redraw
+static gr_surface layer_statusbar;  // statusbar over the background
+static gr_surface layer_tabs;       // tab strip and divider line
+
+static gr_surface layer_background_icon = NULL;
+static int layer_background_shade = -1;
+static gr_surface layer_shaded_icon = NULL;
+static struct statusbar layer_statusbar_state;
+static int layer_statusbar_shade = -1;
+static int layer_statusbar_valid = 0;
+static int layer_tabs_active = -1;
+static char **layer_tabs_items = NULL;
 
 // Clear the screen and draw the currently selected background icon (if any).
-// Should only be called with gUpdateMutex locked.
-static void draw_background_locked(gr_surface icon)
+static void draw_background(gr_surface icon)
 {
     gPagesIdentical = 0;
     gr_color(0, 0, 0, 255);
@@ -162,11 +278,215 @@ static void draw_background_locked(gr_surface icon)
     }
 }
 
+// Darken the background behind the logs.
+static void draw_log_shade(void)
+{
+  gr_color(50, 50, 50, 160);
+  gr_fill(0, 0, gr_fb_width(), gr_fb_height());
+}
+
+// microseconds as milliseconds, short enough for the status bar
+static void format_ms(char *buf, size_t len, unsigned us)
+{
+  if (us < 10000)
+    snprintf(buf, len, "%u.%u", us / 1000, us / 100 % 10);
+  else
+    snprintf(buf, len, "%u", us / 1000);
+}
+
+static void get_statusbar(struct statusbar *st)
+{
+  memset(st, 0, sizeof(*st));
+  ui_get_time(st->clock);
+  ui_get_usbstate(st->usb);
+#ifdef BOARD_WITH_CPCAP
+  sprintf(st->battery, "%d%%", battery_level());
+#endif
+  if (view.hud) {
+    char p50[8], p99[8];
+    format_ms(p50, sizeof(p50), gr_stats_percentile(GR_STAT_FRAME, 50));
+    format_ms(p99, sizeof(p99), gr_stats_percentile(GR_STAT_FRAME, 99));
+    snprintf(st->hud, sizeof(st->hud), "p50 %s p99 %s %ufps", p50, p99, gr_stats_fps());
+  }
+}
+
+static void draw_statusbar(const struct statusbar *st)
+{
+  int statusbar_right = 10;
+
+  // small font for status bar
+  gr_setfont(FONT_LOGS);
+
+  gr_color(0, 0, 0, 160);
+  gr_fill(0, 0, gr_fb_width(), STATUSBAR_HEIGHT);
+
+  // print version, or the frame times (ms) in its place
+  int yBar = gr_getfont_cheight()/2 + STATUSBAR_HEIGHT/2 - gr_getfont_cheightfix();
+  gr_color(0, 170, 255, 255);
+  if (st->hud[0]) {
+    gr_color(255, 205, 86, 255);
+    gr_text(0, yBar, st->hud);
+    gr_color(0, 170, 255, 255);
+  } else {
+    gr_text(0, yBar, "Bootmenu v" BOOTMENU_VERSION);
+  }
+
+  // draw clock
+  gr_text(gr_fb_width()/2 - 5*gr_getfont_cwidth()/2, yBar, st->clock);
+
+  gr_text(gr_fb_width()/4 * 3, yBar, st->usb);
+
+  // draw battery
+  if (st->battery[0])
+    gr_text(gr_fb_width() - strlen(st->battery)*gr_getfont_cwidth() - statusbar_right, yBar, st->battery);
+}
+
+static void draw_tabcontrol(void)
+{
+  int i, tableft=0;
+
+  gr_setfont(FONT_HEAD);
+  gr_color(0, 0, 0, 255);
+
+  gr_fill(0, STATUSBAR_HEIGHT, gr_fb_width(), STATUSBAR_HEIGHT+TABCONTROL_HEIGHT);
+  if(view.tabs!=NULL) {
+    for(i=0; view.tabs[i]; ++i) {
+      int active=0;
+      if (i==view.tab) active=1;
+      tableft = drawTab(tableft, view.tabs[i], active);
+    }
+  }
+
+  // draw divider-line
+  gr_color(0, 170, 255, 255);
+  gr_drawLine(0, STATUSBAR_HEIGHT+TABCONTROL_HEIGHT, gr_fb_width(), STATUSBAR_HEIGHT+TABCONTROL_HEIGHT, 4);
+}
+
+static void free_layers(void)
+{
+  gr_free_surface(layer_background);
+  gr_free_surface(layer_shaded);
+  gr_free_surface(layer_statusbar);
+  gr_free_surface(layer_tabs);
+  layer_background = layer_shaded = layer_statusbar = layer_tabs = NULL;
+}
+
+static void create_layers(void)
+{
+  layer_background = gr_create_surface(gr_fb_width(), gr_fb_height());
+  layer_statusbar = gr_create_surface(gr_fb_width(), STATUSBAR_HEIGHT);
+  layer_tabs = gr_create_surface(gr_fb_width(), TABCONTROL_LAYER_HEIGHT);
+
+  if (!layer_background || !layer_statusbar || !layer_tabs) {
+    LOGE("no memory for the layers, drawing directly\n");
+    free_layers();
+  } else {
+    // optional, the shade is drawn into layer_background without it
+    layer_shaded = gr_create_surface(gr_fb_width(), gr_fb_height());
+  }
+
+  layer_background_icon = NULL;
+  layer_background_shade = -1;
+  layer_shaded_icon = NULL;
+  layer_statusbar_valid = 0;
+  layer_tabs_active = -1;
+  layer_tabs_items = NULL;
+}
+
+// Redraw the layers whose contents changed, st is NULL if the statusbar
+// is hidden. Returns the background layer to show.
+static gr_surface update_layers(int shade, const struct statusbar *st)
+{
+  gr_surface background = layer_background;
+
+  if (shade && layer_shaded) {
+    background = layer_shaded;
+    if (layer_shaded_icon != view.icon) {
+      gr_set_target(layer_shaded, 0, 0);
+      draw_background(view.icon);
+      draw_log_shade();
+      gr_set_target(NULL, 0, 0);
+
+      layer_shaded_icon = view.icon;
+      layer_statusbar_valid = 0;
+    }
+  } else if (layer_background_icon != view.icon || layer_background_shade != shade) {
+    gr_set_target(layer_background, 0, 0);
+    draw_background(view.icon);
+    if (shade)
+      draw_log_shade();
+    gr_set_target(NULL, 0, 0);
+
+    layer_background_icon = view.icon;
+    layer_background_shade = shade;
+    layer_statusbar_valid = 0;
+  }
+
+  // the statusbar is translucent, it is blended once over the background
+  if (st && (!layer_statusbar_valid || layer_statusbar_shade != shade
+          || memcmp(st, &layer_statusbar_state, sizeof(*st)))) {
+    gr_set_target(layer_statusbar, 0, 0);
+    gr_blit(background, 0, 0, gr_fb_width(), STATUSBAR_HEIGHT, 0, 0);
+    draw_statusbar(st);
+    gr_set_target(NULL, 0, 0);
+
+    layer_statusbar_state = *st;
+    layer_statusbar_shade = shade;
+    layer_statusbar_valid = 1;
+  }
+
+  if (st && (layer_tabs_active != view.tab || layer_tabs_items != view.tabs)) {
+    gr_set_target(layer_tabs, 0, STATUSBAR_HEIGHT);
+    draw_tabcontrol();
+    gr_set_target(NULL, 0, 0);
+
+    layer_tabs_active = view.tab;
+    layer_tabs_items = view.tabs;
+  }
+
+  return background;
+}
+
+// Width of the fill of the progress bar, at a fraction of a scope.
+static int progress_fill_width(float start, float size, float fraction)
+{
+  float progress = start + fraction * size;
+  return (int) (progress * gr_get_width(gProgressBarEmpty));
+}
+
+// Monotonic time of the next visible change of the progress bar, 0 if it
+// doesn't move by itself: the next animation frame, or the next column of
+// fill of a timed progress.
+static uint64_t progress_next_change(void)
+{
+  uint64_t elapsed = gr_stats_now() - gProgressScopeTime;
+  double next;
+  int width;
+
+  if (gProgressBarType == PROGRESSBAR_TYPE_INDETERMINATE) {
+    if (PROGRESSBAR_INDETERMINATE_STATES < 2)
+      return 0;
+    return gProgressScopeTime + (elapsed / PROGRESSBAR_FRAME_NS + 1) * PROGRESSBAR_FRAME_NS;
+  }
+
+  width = gr_get_width(gProgressBarEmpty);
+  if (gProgressBarType != PROGRESSBAR_TYPE_NORMAL || gProgressScopeDuration <= 0
+   || gProgress >= 1.0 || gProgressScopeSize <= 0 || width <= 0)
+    return 0;
+
+  // fraction of the scope where the fill reaches the next column
+  next = progress_fill_width(gProgressScopeStart, gProgressScopeSize, gProgress) + 1.0;
+  next = (next / width - gProgressScopeStart) / gProgressScopeSize;
+  if (next > 1.0)
+    next = 1.0;
+  // 1ms later, not to wake up just before because of the rounding
+  return gProgressScopeTime + (uint64_t) (next * gProgressScopeDuration * 1000) * 1000000ULL + 1000000ULL;
+}
+
 // Draw the progress bar (if any) on the screen.  Does not flip pages.
-// Should only be called with gUpdateMutex locked.
-static void draw_progress_locked()
+static void draw_progress()
 {
-    if (gProgressBarType == PROGRESSBAR_TYPE_NONE) return;
+    if (view.progress_type == PROGRESSBAR_TYPE_NONE) return;
 
     int iconHeight = gr_get_height(gBackgroundIcon[BACKGROUND_ALT]);
     int width = gr_get_width(gProgressBarEmpty);
@@ -179,9 +499,8 @@ static void draw_progress_locked()
     gr_color(0, 0, 0, 255);
     gr_fill(dx, dy, width, height);
 
-    if (gProgressBarType == PROGRESSBAR_TYPE_NORMAL) {
-        float progress = gProgressScopeStart + gProgress * gProgressScopeSize;
-        int pos = (int) (progress * width);
+    if (view.progress_type == PROGRESSBAR_TYPE_NORMAL) {
+        int pos = progress_fill_width(view.progress_start, view.progress_size, view.progress);
 
         if (pos > 0) {
           gr_blit(gProgressBarFill, 0, 0, pos, height, dx, dy);
@@ -190,18 +509,19 @@ static void draw_progress_locked()
           gr_blit(gProgressBarEmpty, pos, 0, width-pos, height, dx+pos, dy);
         }
 
-        if (pos > 0 && show_percent && percent > 0.0) {
+        if (pos > 0 && show_percent && view.percent > 0.0) {
           char pct[8];
-          sprintf(pct, "%3.0f %%", percent * 100);
+          sprintf(pct, "%3.0f %%", view.percent * 100);
           gr_color(255, 255, 255, 255);
           gr_text(dx + 8, dy - 4, pct);
         }
     }
 
-    if (gProgressBarType == PROGRESSBAR_TYPE_INDETERMINATE) {
-        static int frame = 0;
+    if (view.progress_type == PROGRESSBAR_TYPE_INDETERMINATE) {
+        // from the time, whatever the count of frames drawn
+        int frame = (gr_stats_now() - view.progress_time) / PROGRESSBAR_FRAME_NS
+                    % PROGRESSBAR_INDETERMINATE_STATES;
         gr_blit(gProgressBarIndeterminate[frame], 0, 0, width, height, dx, dy);
-        frame = (frame + 1) % PROGRESSBAR_INDETERMINATE_STATES;
     }
 }
 
@@ -209,8 +529,8 @@ static void draw_menuitem_selection(int top, int height) {
   gr_fill(square_inner_left, top, square_inner_right, top+height);
 }
 
-static int get_menuitem_height(int item) {
-  switch(menu[item].type) {
+static int get_menuitem_height(struct UiMenuItem *items, int item) {
+  switch(items[item].type) {
     case MENUITEM_SMALL:
       return 80;
       break;
@@ -224,26 +544,56 @@ static int get_menuitem_height(int item) {
   return 0;
 }
 
+static int ui_get_menu_top() {
+  return STATUSBAR_HEIGHT+TABCONTROL_HEIGHT+menutop_diff;
+}
+
+static int ui_get_menu_height(struct UiMenuItem *items, int count) {
+  int i;
+  int height = 0;
+
+  for (i=0; i < count; ++i) {
+    height+=get_menuitem_height(items, i);
+  }
+
+  return height;
+}
+
+static int inside_menuitem(struct UiMenuItem *items, int top, int item, int x, int y) {
+  int i;
+
+  // get top-position
+  for(i=0; i<item; ++i) {
+    top += get_menuitem_height(items, i);
+  }
+
+  // the check itself
+  if(x >= square_inner_left && x <= square_inner_right && y >= top && y < (top + get_menuitem_height(items, item)) ) {
+    return 1;
+  }
+  return 0;
+}
+
 static int draw_menu_item(int top, int item) {
-  int height=get_menuitem_height(item);
+  int height=get_menuitem_height(view.menu, item);
   struct UiColor color_text;
   struct UiColor color_background;
 
-  switch(menu[item].type) {
+  switch(view.menu[item].type) {
 
     case MENUITEM_SMALL:
       color_text = gr_make_uicolor(255, 255, 255, 255);
       color_background = gr_make_uicolor(0, 0, 0, 255);
 
-      if(show_menu_selection==1 && menu_sel==item) {
+      if(view.selection==1 && view.menu_sel==item) {
         color_text = gr_make_uicolor(0, 0, 0, 255);
         color_background = gr_make_uicolor(255, 255, 255, 255);
         draw_menuitem_selection(top,height);
       }
 
-      if(ui_inside_menuitem(item, pointerx_start, pointery_start)==1 && enable_scrolling==0) {
+      if(inside_menuitem(view.menu, view.menu_top, item, view.pointerx_start, view.pointery_start)==1 && view.scrolling==0) {
         color_text = gr_make_uicolor(0, 0, 0, 255);
-        if(ui_inside_menuitem(item, pointerx, pointery)==1) {
+        if(inside_menuitem(view.menu, view.menu_top, item, view.pointerx, view.pointery)==1) {
           color_background = gr_make_uicolor(255, 183, 0, 255);
         }
         else {
@@ -281,7 +631,7 @@ static int draw_menu_item(int top, int item) {
         // draw text
         gr_setfont(FONT_ITEM);
         gr_set_uicolor(color_text);
-        gr_text_cut(square_inner_left, top+height-height/2+gr_getfont_cheight()/2-gr_getfont_cheightfix(), menu[item].title,
+        gr_text_cut(square_inner_left, top+height-height/2+gr_getfont_cheight()/2-gr_getfont_cheightfix(), view.menu[item].title,
                     square_inner_left, square_inner_right, square_inner_top, bgbottom);
 
         // draw bottom_line
@@ -308,76 +658,177 @@ static void draw_log_line(int row, const char* t) {
   }
 }
 
+// Log pane of the logs tab: the last lines, one per row from the top.
+// Only the rows on screen are drawn. When lines were added since the
+// frame on screen, the rows still shown are scrolled by copying their
+// pixels, and only the new lines are drawn (see gr_frame_list_scroll).
+struct log_state {
+  int shown;
+  int rows;
+  unsigned first;   // line on the top row
+  unsigned lines;   // text_lines, the last line may not be complete
+  int width;        // of the longest row
+};
+
+static struct log_state log_drawn;    // on screen
+static struct log_state log_pending;  // drawn in the current frame
+
+static void draw_log_pane(void)
+{
+  int ln_h = gr_getfont_cheight();
+  int base = STATUSBAR_HEIGHT+TABCONTROL_HEIGHT + 22;  // baseline of the top row
+  int top = base - ln_h + 2;
+  int rows = (gr_fb_height() - (STATUSBAR_HEIGHT+TABCONTROL_HEIGHT) - 24) / ln_h;
+  unsigned first, line, end;
+  int j, len, width = 0;
+
+  if (rows > view.text_rows) rows = view.text_rows;
+  if (rows <= 0) return;
+  first = view.text_lines + 1 > (unsigned) rows ? view.text_lines + 1 - rows : 0;
+
+  gr_frame_list_begin();
+
+  // opaque, the shaded background must not move with the rows
+  gr_color(31, 31, 31, 255);
+  gr_fill(0, top, gr_fb_width(), top + rows*ln_h);
+
+  gr_color(192, 192, 192, 255);
+  for (j = 0, line = first; j < rows && line <= view.text_lines; ++j, ++line) {
+    const char *t = view.text[(view.text_row + view.text_rows - (view.text_lines - line)) % view.text_rows];
+    if (t[0] != '\0')
+      len = gr_text(2, base + ln_h*j, t);
+    else
+      len = 0;
+    if (len > width) width = len;
+  }
+
+  gr_frame_list_end();
+
+  log_pending.shown = 1;
+  log_pending.rows = rows;
+  log_pending.first = first;
+  log_pending.lines = view.text_lines;
+  log_pending.width = width < gr_fb_width() ? width : gr_fb_width();
+
+  // the lines which were complete and are still shown, only as wide as
+  // the rows on screen: the pane is the same on their right
+  if (log_drawn.shown && log_drawn.rows == rows && first > log_drawn.first) {
+    end = log_drawn.first + rows;
+    if (end > log_drawn.lines)
+      end = log_drawn.lines;
+    if (end > first && log_drawn.width > 0)
+      gr_frame_list_scroll(0, top, log_drawn.width, top + (end - first)*ln_h,
+                           -(int) (first - log_drawn.first)*ln_h);
+  }
+}
+
 static void draw_text_line(int row, const char* t) {
   if (t[0] != '\0') {
     gr_text(0, (row+1)*gr_getfont_cwidth()-1, t);
   }
 }
 
-static int ui_get_menu_top() {
-  return STATUSBAR_HEIGHT+TABCONTROL_HEIGHT+menutop_diff;
-}
+// What the menu list shows, apart from its position. When only the
+// position changed since the frame on screen, the list is scrolled by
+// copying its pixels (see gr_frame_list_scroll) instead of redrawn.
+struct list_state {
+  struct UiMenuItem *items;
+  int count;
+  unsigned titles;  // hash of the types and titles
+  int selected;     // highlighted item, -1 if none
+  int pressed;      // item touched, -1 if none
+  int hovered;      // pointer still on it
+  int top;
+};
+
+static struct list_state list_drawn = { .top = -1 }; // on screen, top -1 if no list
+static struct list_state list_pending;  // drawn in the current frame
 
-static int ui_get_menu_height() {
+static void get_list_state(struct list_state *st)
+{
+  const char *p;
   int i;
-  int height = 0;
 
-  for (i=0; i < menu_items; ++i) {
-    height+=get_menuitem_height(i);
+  memset(st, 0, sizeof(*st));
+  st->items = view.menu;
+  st->count = view.menu_items;
+  st->selected = view.selection == 1 ? view.menu_sel : -1;
+  st->pressed = -1;
+  st->top = view.menu_top;
+
+  for (i = 0; i < view.menu_items; ++i) {
+    st->titles = st->titles * 31 + view.menu[i].type;
+    for (p = view.menu[i].title; p && *p; p++)
+      st->titles = st->titles * 31 + (unsigned char) *p;
+    if (st->pressed < 0 && view.scrolling == 0
+     && inside_menuitem(view.menu, view.menu_top, i, view.pointerx_start, view.pointery_start) == 1) {
+      st->pressed = i;
+      st->hovered = inside_menuitem(view.menu, view.menu_top, i, view.pointerx, view.pointery);
+    }
   }
+}
 
-  return height;
+// Called after the list is drawn: scroll the rows of the viewport which
+// show the list in both frames, the display list repaints the others.
+static void scroll_list(void)
+{
+  struct list_state moved = list_drawn;
+  int dy, y1, y2;
+
+  get_list_state(&list_pending);
+  dy = list_pending.top - list_drawn.top;
+  if (list_drawn.top < 0 || dy == 0)
+    return;
+  moved.top = list_pending.top;
+  if (memcmp(&moved, &list_pending, sizeof(moved)))
+    return;
+
+  y1 = square_inner_top + (dy > 0 ? dy : 0);
+  if (y1 < list_pending.top)
+    y1 = list_pending.top;
+  y2 = square_inner_bottom + (dy < 0 ? dy : 0);
+  if (y2 > list_pending.top + ui_get_menu_height(view.menu, view.menu_items))
+    y2 = list_pending.top + ui_get_menu_height(view.menu, view.menu_items);
+  // the bottom line of an item cut by the viewport is not drawn
+  y2 -= 2;
+  if (y1 < y2)
+    gr_frame_list_scroll(square_inner_left, y1, square_inner_right, y2, dy);
 }
 
 // Redraw everything on the screen.  Does not flip pages.
-// Should only be called with gUpdateMutex locked.
-static void draw_screen_locked(void)
+static void draw_screen(void)
 {
-  if (show_menu != 1) return;
+  if (view.show_menu != 1) return;
 
   int i;
-  int marginTop = ui_get_menu_top();
-  struct timeval bouncediff, tvNow;
-  gettimeofday(&tvNow, NULL);
-
-
-  if (enable_bounceback == 1) {
-    timeval_subtract(&bouncediff, &tvNow, &bounceback_start_time);
-    int t0 = BOUNCEBACK_TIME*1000;
-    int t1 = t0- (bouncediff.tv_sec*1000000+bouncediff.tv_usec);
-    int way = abs(bounceback_start-bounceback_targetpos);
-    //int pway = round((double)way/t0*t1);
-    int pway = way/t0*t1;
-
-    if(pway<=0) {
-      enable_bounceback=0;
-      menutop_diff=bounceback_targetpos;
-    }
-    else {
-      if(bounceback_start>bounceback_targetpos) {
-        menutop_diff=bounceback_targetpos+pway;
-      }
-      else {
-        menutop_diff=bounceback_targetpos-pway;
-      }
-    }
+  int marginTop = view.menu_top;
+  int shade = view.show_text && view.tab == TAB_LOG;
+  struct statusbar st;
+
+  if (view.show_text) {
+    get_statusbar(&st);
+    // switching back to a tab only draws what changed since it was left
+    gr_frame_page(view.tab);
   }
 
-  draw_background_locked(gCurrentIcon);
-  draw_progress_locked();
+  if (layer_background) {
+    gr_surface background = update_layers(shade, view.show_text ? &st : NULL);
+    gr_blit(background, 0, 0, gr_fb_width(), gr_fb_height(), 0, 0);
+  } else {
+    draw_background(view.icon);
+  }
+  draw_progress();
 
-  if (show_text) {
+  if (view.show_text) {
     i = 0;
 
-    // for logs, no menu items (define to move later)
-    #define TAB_LOG 2
-
-    if (activeTab != TAB_LOG) {
+    if (view.tab != TAB_LOG) {
       // draw menu
       gr_setfont(FONT_ITEM);
+      gr_frame_list_begin();
 
-      for (; i < menu_items; ++i) {
-        if (i == menu_sel) {
+      for (; i < view.menu_items; ++i) {
+        if (i == view.menu_sel) {
           // draw item
           gr_color(0, 0, 0, 255);
           marginTop = draw_menu_item(marginTop, i);
@@ -386,100 +837,47 @@ static void draw_screen_locked(void)
           marginTop = draw_menu_item(marginTop, i);
         }
       }
+      gr_frame_list_end();
+      scroll_list();
       ++i;
 
-    } else {
+    } else if (!layer_background) {
 
       //log background
-      gr_color(50, 50, 50, 160);
-      gr_fill(0, 0, gr_fb_width(), gr_fb_height());
+      draw_log_shade();
 
     }
 
-    // small font for status bar
-    gr_setfont(FONT_LOGS);
-
-    // draw statusbar
-    int statusbar_right = 10;
-    gr_color(0, 0, 0, 160);
-    gr_fill(0, 0, gr_fb_width(), STATUSBAR_HEIGHT);
-
-    // print version
-    int yBar = gr_getfont_cheight()/2 + STATUSBAR_HEIGHT/2 - gr_getfont_cheightfix();
-    gr_color(0, 170, 255, 255);
-    gr_text(0, yBar, "Bootmenu v" BOOTMENU_VERSION);
-
-    // draw clock
-    char str[16]="";
-    ui_get_time(str);
-    gr_text(gr_fb_width()/2 - 5*gr_getfont_cwidth()/2, yBar, str);
-
-    ui_get_usbstate(str);
-    gr_text(gr_fb_width()/4 * 3, yBar, str);
-
-#ifdef BOARD_WITH_CPCAP
-    // draw battery
-    int level = battery_level();
-    sprintf(str, "%d%%", level);
-
-    gr_text(gr_fb_width() - strlen(str)*gr_getfont_cwidth() - statusbar_right, yBar, str);
-#endif
-
-    // draw tabcontrol
-    int tableft=0;
-
-    gr_setfont(FONT_HEAD);
-    gr_color(0, 0, 0, 255);
-
-    gr_fill(0, STATUSBAR_HEIGHT, gr_fb_width(), STATUSBAR_HEIGHT+TABCONTROL_HEIGHT);
-    if(tabitems!=NULL) {
-      for(i=0; tabitems[i]; ++i) {
-        int active=0;
-        if (i==activeTab) active=1;
-        tableft = drawTab(tableft, tabitems[i], active);
-      }
+    if (layer_background) {
+      gr_blit(layer_statusbar, 0, 0, gr_fb_width(), STATUSBAR_HEIGHT, 0, 0);
+      gr_blit(layer_tabs, 0, 0, gr_fb_width(), TABCONTROL_LAYER_HEIGHT, 0, STATUSBAR_HEIGHT);
+    } else {
+      draw_statusbar(&st);
+      draw_tabcontrol();
     }
 
-    // draw divider-line
-    gr_color(0, 170, 255, 255);
-    gr_drawLine(0, STATUSBAR_HEIGHT+TABCONTROL_HEIGHT, gr_fb_width(), STATUSBAR_HEIGHT+TABCONTROL_HEIGHT, 4);
-
     // draw logs
     gr_setfont(FONT_LOGS);
     gr_color(192, 192, 192, 255);
 
-    if (activeTab == TAB_LOG) {
-
-      int row;
-      int ln_h = gr_getfont_cheight();
-      int full_rows = (gr_fb_height() - (STATUSBAR_HEIGHT+TABCONTROL_HEIGHT) - 24) / ln_h;
+    if (view.tab == TAB_LOG) {
 
-      sprintf(str, "%d rows", full_rows);
-      gr_text(400, STATUSBAR_HEIGHT+TABCONTROL_HEIGHT + 22, str);
-
-      for (i=0; i < full_rows; ++i) {
-        row = (i+text_top) % full_rows;
-        if (row >= MAX_ROWS) break;
-        if (strlen(text[row]))
-          gr_text(2, STATUSBAR_HEIGHT+TABCONTROL_HEIGHT + 22 + ln_h*i, text[row]);
-        else {
-          sprintf(str, "%d (%d) empty", i, row);
-        }
-      }
+      draw_log_pane();
 
     } else {
 
-      // tailed log on the bottom
-      for (i=0; i < text_rows; ++i) {
-        draw_log_line(i, text[(i+text_top) % text_rows]);
+      // tailed log on the bottom, the rows on screen
+      for (i=0; i < view.text_rows; ++i) {
+        if (square_inner_bottom + i*gr_getfont_cheight() >= gr_fb_height()) break;
+        draw_log_line(i, view.text[(i+view.text_top) % view.text_rows]);
       }
 
     }
 
     // DEBUG: Pointer-location
     gr_color(255, 0, 0, 255);
-    if (pointerx != -1)
-      gr_fill(pointerx, pointery, pointerx+10, pointery+10);
+    if (view.pointerx != -1)
+      gr_fill(view.pointerx, view.pointery, view.pointerx+10, view.pointery+10);
   }
 }
 
@@ -518,203 +916,765 @@ static void recalcSquare()
   square_inner_left = SQUARE_LEFT+SQUARE_WIDTH;
 }
 
+// Writers of the state a frame shows, between ui_write_lock() and
+// ui_write_unlock(): they never wait for the frame being drawn.
+static void ui_write_lock(void)
+{
+  pthread_mutex_lock(&gUpdateMutex);
+  ui_seq++;
+  __sync_synchronize();
+}
+
+static void ui_write_unlock(void)
+{
+  __sync_synchronize();
+  ui_seq++;
+  pthread_mutex_unlock(&gUpdateMutex);
+}
+
+// Wait for the frame being drawn, if any, it may still use what was
+// just replaced (see struct ui_view).
+static void ui_wait_frame(void)
+{
+  pthread_mutex_lock(&render_mutex);
+  pthread_mutex_unlock(&render_mutex);
+}
+
+// Copy the state to draw, again if a writer changed it meanwhile.
+static void ui_snapshot(struct ui_view *v)
+{
+  unsigned seq;
+
+  do {
+    while ((seq = ui_seq) & 1)
+      sched_yield();
+    __sync_synchronize();
+
+    v->show_menu = show_menu;
+    v->show_text = show_text;
+    v->tab = activeTab;
+    v->tabs = tabitems;
+    v->icon = gCurrentIcon;
+    v->hud = render_hud;
+
+    v->menu = menu;
+    v->menu_items = menu_items;
+    v->menu_sel = menu_sel;
+    v->selection = show_menu_selection;
+    v->menu_top = ui_get_menu_top();
+    v->scrolling = enable_scrolling;
+    v->pointerx = pointerx;
+    v->pointery = pointery;
+    v->pointerx_start = pointerx_start;
+    v->pointery_start = pointery_start;
+
+    v->progress_type = gProgressBarType;
+    v->progress_start = gProgressScopeStart;
+    v->progress_size = gProgressScopeSize;
+    v->progress = gProgress;
+    v->progress_time = gProgressScopeTime;
+    v->percent = percent;
+
+    v->text_rows = text_rows;
+    v->text_row = text_row;
+    v->text_top = text_top;
+    v->text_lines = text_lines;
+    memcpy(v->text, text, sizeof(v->text));
+
+    __sync_synchronize();
+  } while (seq != ui_seq);
+}
+
+// Move the list towards its position after a release out of bounds.
+// Should only be called with ui_write_lock().
+static void step_bounceback_locked(void)
+{
+  struct timeval bouncediff, tvNow;
+  gettimeofday(&tvNow, NULL);
+
+  timeval_subtract(&bouncediff, &tvNow, &bounceback_start_time);
+  int t0 = BOUNCEBACK_TIME*1000;
+  int t1 = t0- (bouncediff.tv_sec*1000000+bouncediff.tv_usec);
+  int way = abs(bounceback_start-bounceback_targetpos);
+  //int pway = round((double)way/t0*t1);
+  int pway = way/t0*t1;
+
+  if(pway<=0) {
+    enable_bounceback=0;
+    menutop_diff=bounceback_targetpos;
+  }
+  else {
+    if(bounceback_start>bounceback_targetpos) {
+      menutop_diff=bounceback_targetpos+pway;
+    }
+    else {
+      menutop_diff=bounceback_targetpos-pway;
+    }
+  }
+}
+
 // Redraw everything on the screen and flip the screen (make it visible).
-// Should only be called with gUpdateMutex locked.
-static void update_screen_locked(void)
+// Only the areas which changed since the previous frame are repainted.
+// Returns -1 if the frame was skipped, the previous one not being on
+// screen yet. Only called by the loop thread, with render_mutex locked.
+static int update_screen(void)
 {
-  draw_screen_locked();
-  gr_flip();
+  int ret;
+
+  ui_snapshot(&view);
+  list_pending.top = -1;
+  log_pending.shown = 0;
+  gr_frame_begin();
+  draw_screen();
+  ret = gr_frame_end();
+  if (ret >= 0) {
+    list_drawn = list_pending;
+    log_drawn = log_pending;
+  }
+  return ret;
 }
 
-// Updates only the progress bar, if possible, otherwise redraws the screen.
+// Tell the loop thread the ui state changed, a frame will be drawn.
+static void ui_wake_loop(void)
+{
+  uint64_t one = 1;
+  if (loop_wakefd >= 0) {
+    write(loop_wakefd, &one, sizeof(one));
+  }
+}
+
+// Updates only the progress bar: the rest of the screen being the same,
+// the next frame only redraws and flips its rectangle (see displaylist.c).
 // Should only be called with gUpdateMutex locked.
 static void update_progress_locked(void)
 {
-  /*if (show_text || !gPagesIdentical) {
-      draw_screen_locked();    // Must redraw the whole screen
-      gPagesIdentical = 1;
-  } else {
-      draw_progress_locked();  // Draw only the progress bar
+  ui_wake_loop();
+}
+
+// Arm a timerfd to expire once at a time of its clock, or disarm it if 0.
+static void timer_set_deadline(int fd, uint64_t *cur_ns, uint64_t ns)
+{
+  struct itimerspec its;
+
+  if (fd < 0 || *cur_ns == ns)
+    return;
+
+  memset(&its, 0, sizeof(its));
+  its.it_value.tv_sec = ns / 1000000000ULL;
+  its.it_value.tv_nsec = ns % 1000000000ULL;
+  timerfd_settime(fd, TFD_TIMER_ABSTIME, &its, NULL);
+  *cur_ns = ns;
+}
+
+// Arm a periodic timerfd, or disarm it if fps is 0.
+static void timer_set_fps(int fd, int *cur_fps, int fps)
+{
+  struct itimerspec its;
+
+  if (fd < 0 || *cur_fps == fps)
+    return;
+
+  memset(&its, 0, sizeof(its));
+  if (fps > 0) {
+    long period = 1000000000L / fps;
+    its.it_interval.tv_sec = period / 1000000000L;
+    its.it_interval.tv_nsec = period % 1000000000L;
+    its.it_value = its.it_interval;
   }
-  gr_flip();*/
+  timerfd_settime(fd, 0, &its, NULL);
+  *cur_fps = fps;
 }
 
-// Keeps the progress bar updated, even when the process is otherwise busy.
-static void *progress_thread(void *cookie)
+static int backlight_get(void)
 {
-  bool bExitFlag = false;
-  while (!bExitFlag) {
-    usleep(1000000 / PROGRESSBAR_INDETERMINATE_FPS);
-    pthread_mutex_lock(&gUpdateMutex);
+  FILE *f = fopen(SYS_LCD_BACKLIGHT, "r");
+  int value = -1;
 
-    // update the progress bar animation, if active
-    // skip this if we have a text overlay (too expensive to update)
-    if (gProgressBarType == PROGRESSBAR_TYPE_INDETERMINATE && !show_text) {
-        update_progress_locked();
-    }
+  if (f != NULL) {
+    if (fscanf(f, "%d", &value) != 1)
+      value = -1;
+    fclose(f);
+  }
+  return value;
+}
 
-    // move the progress bar forward on timed intervals, if configured
-    int duration = gProgressScopeDuration;
-    if (gProgressBarType == PROGRESSBAR_TYPE_NORMAL && duration > 0) {
-        int elapsed = time(NULL) - gProgressScopeTime;
-        float progress = 1.0 * elapsed / duration;
-        if (progress > 1.0) progress = 1.0;
-        if (progress > gProgress) {
-            gProgress = progress;
-            update_progress_locked();
-        }
-    }
+static void backlight_set(int value)
+{
+  FILE *f = fopen(SYS_LCD_BACKLIGHT, "w");
 
-    bExitFlag = (t_progress == 0);
+  if (f != NULL) {
+    fprintf(f, "%d", value);
+    fclose(f);
+  }
+}
 
-    pthread_mutex_unlock(&gUpdateMutex);
+// Should only be called with gUpdateMutex locked.
+static void idle_set_state_locked(int state, uint64_t now)
+{
+  if (state == idle_state)
+    return;
+
+  idle_time[idle_state] += now - idle_state_time;
+  idle_state_time = now;
+
+  if (state == IDLE_ACTIVE) {
+    if (idle_state == IDLE_BLANKED)
+      gr_fb_blank(false);
+    if (idle_brightness >= 0)
+      backlight_set(idle_brightness);
+    idle_brightness = -1;
+    // drawn right away, the timers were stopped
+    ui_wake_loop();
+  } else {
+    if (idle_brightness < 0)
+      idle_brightness = backlight_get();
+    if (state == IDLE_DIMMED) {
+      if (idle_dim_brightness < idle_brightness)
+        backlight_set(idle_dim_brightness);
+    } else {
+      backlight_set(0);
+      gr_fb_blank(true);
+    }
   }
-  return NULL;
+  idle_state = state;
 }
 
-// Reads input events, handles special hot keys, and adds to the key queue.
-static void *input_thread(void *cookie)
-{
-  int rel_sum = 0;
-  int fake_key = 0;
-  int drag = 0;
-  bool bExitFlag = false;
-
-  while (!bExitFlag) {
-    // wait for the next key event
-    struct input_event ev;
-    struct ui_input_event uev;
-    int state = 0;
-
-    do {
-      ev_get(&ev, 0);
-      uev.time = ev.time;
-      uev.type = ev.type;
-      uev.code = ev.code;
-      uev.value = ev.value;
-      uev.utype = UINPUTEVENT_TYPE_KEY;
-      uev.posx = -1;
-      uev.posy = -1;
-
-      if (ev.type == EV_SYN) {
-          continue;
-      } else if (ev.type == EV_REL) {
-          if (ev.code == REL_Y) {
-              // accumulate the up or down motion reported by
-              // the trackball.  When it exceeds a threshold
-              // (positive or negative), fake an up/down
-              // key event.
-              rel_sum += ev.value;
-              if (rel_sum > 3) {
-                  fake_key = 1;
-                  ev.type = EV_KEY;
-                  ev.code = KEY_DOWN;
-                  ev.value = 1;
-                  rel_sum = 0;
-              } else if (rel_sum < -3) {
-                  fake_key = 1;
-                  ev.type = EV_KEY;
-                  ev.code = KEY_UP;
-                  ev.value = 1;
-                  rel_sum = 0;
-              }
-          }
+// Time of the next step of the idle policy, 0 if none.
+// Should only be called with gUpdateMutex locked.
+static uint64_t idle_next_change(void)
+{
+  uint64_t dim = 0, blank = 0;
+
+  if (idle_dim_timeout > 0 && idle_state < IDLE_DIMMED)
+    dim = idle_input_time + idle_dim_timeout * 1000000000ULL;
+  if (idle_blank_timeout > 0 && idle_state < IDLE_BLANKED)
+    blank = idle_input_time + idle_blank_timeout * 1000000000ULL;
+  if (dim == 0 || (blank != 0 && blank < dim))
+    return blank;
+  return dim;
+}
 
-      } else if (ev.type == EV_ABS) {
+// Rate of a slide: the refresh rate, or a fraction of it if the frames
+// of this board take longer than a period (90th percentile, with a margin).
+static int frame_rate_cap(void)
+{
+  unsigned us = gr_stats_percentile(GR_STAT_FRAME, 90) * 5 / 4;
+  int div = 1;
 
-        int x, y;
+  while (REDRAWTHREAD_FAST_FPS / (div + 1) >= REDRAWTHREAD_MIN_FPS
+      && us > 1000000U * div / REDRAWTHREAD_FAST_FPS)
+    div++;
+  return REDRAWTHREAD_FAST_FPS / div;
+}
 
-        uev.posx = x = ev.value >> 16;
-        uev.posy = y = ev.value & 0xFFFF;
+// Wall clock time of the next status bar change nothing notifies: the
+// minute of the clock, or the next second while the hud is shown.
+static uint64_t status_next_change(void)
+{
+  uint64_t period = render_hud ? 1 : 60;
+  struct timespec ts;
 
-        if (ev.code == 0) {
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return ((uint64_t) ts.tv_sec / period + 1) * period * 1000000000ULL;
+}
 
-          if (state == 0) {
-            uev.utype = UINPUTEVENT_TYPE_TOUCH_RELEASE;
-          }
-          state = 0;
-          drag = 0;
+// Only the timers of running animations are armed, the loop sleeps otherwise.
+// Should only be called with gUpdateMutex locked.
+static void update_timers_locked(void)
+{
+  int awake = redraw_enabled && idle_state != IDLE_BLANKED;
+  int fps;
 
-        } else {
+  // the rate is kept for the whole slide
+  fps = 0;
+  if (awake && (enable_scrolling || enable_bounceback))
+    fps = frame_timer_fps ? frame_timer_fps : frame_rate_cap();
+  timer_set_fps(frame_timerfd, &frame_timer_fps, fps);
 
-          if (!drag) {
-            uev.utype = UINPUTEVENT_TYPE_TOUCH_START;
-            drag=1;
-          } else if (state == 0) {
-              uev.utype = UINPUTEVENT_TYPE_TOUCH_DRAG;
-          }
-        }
+  timer_set_deadline(progress_timerfd, &progress_timer_due,
+                     awake ? progress_next_change() : 0);
 
+  timer_set_deadline(status_timerfd, &status_timer_due,
+                     awake ? status_next_change() : 0);
+
+  // scripts may use the screen while the ui does not draw
+  timer_set_deadline(idle_timerfd, &idle_timer_due,
+                     redraw_enabled ? idle_next_change() : 0);
+}
+
+// Consume the expirations of a timerfd or the eventfd counter.
+static uint64_t drain_fd(int fd)
+{
+  uint64_t count = 0;
+  read(fd, &count, sizeof(count));
+  return count;
+}
+
+static int frame_timer_callback(int fd, uint32_t epevents, void *data)
+{
+  uint64_t expirations = drain_fd(fd);
+
+  // the previous frame took longer than a period
+  if (expirations > 1)
+    gr_stats_skipped(expirations - 1);
+
+  redraw_pending = 1;
+  frame_due = 1;
+  return 0;
+}
+
+static int status_timer_callback(int fd, uint32_t epevents, void *data)
+{
+  drain_fd(fd);
+  pthread_mutex_lock(&gUpdateMutex);
+  status_timer_due = 0;
+  pthread_mutex_unlock(&gUpdateMutex);
+  redraw_pending = 1;
+  return 0;
+}
+
+// The usb and battery state of the status bar change with a uevent of
+// the power_supply subsystem.
+static int uevent_callback(int fd, uint32_t epevents, void *data)
+{
+  char buf[1024];
+  ssize_t n;
+  int i;
+
+  while ((n = recv(fd, buf, sizeof(buf) - 1, MSG_DONTWAIT)) > 0) {
+    buf[n] = '\0';
+    // nul separated "key=value" strings, after "action@devpath"
+    for (i = 0; i < n; i += strlen(buf + i) + 1) {
+      if (!strcmp(buf + i, "SUBSYSTEM=power_supply")) {
+        redraw_pending = 1;
+        break;
       }
-      else {
-        rel_sum = 0;
-      }
-    } while ((ev.type != EV_KEY && ev.type != EV_ABS) || ev.code > KEY_MAX);
-
-    pthread_mutex_lock(&key_queue_mutex);
-    if (!fake_key) {
-        // our "fake" keys only report a key-down event (no
-        // key-up), so don't record them in the key_pressed
-        // table.
-        key_pressed[ev.code] = ev.value;
-        redraw_idle_timeout = 50;
-    }
-    fake_key = 0;
-    const int queue_max = sizeof(key_queue) / sizeof(key_queue[0]);
-    if (ev.value > 0 && key_queue_len < queue_max) {
-        key_queue[key_queue_len++] = uev;
-        pthread_cond_signal(&key_queue_cond);
     }
-    pthread_mutex_unlock(&key_queue_mutex);
-
-    if (ev.type!= EV_ABS && ev.value > 0 && device_toggle_display(key_pressed, ev.code)) {
-        ui_setTab_next();
-        //pthread_mutex_lock(&gUpdateMutex);
-        //int tab = ui_get_activeTab();
-        // show_text = (tab != 2);
-        // update_screen_locked();
-        //pthread_mutex_unlock(&gUpdateMutex);
+  }
+  return 0;
+}
+
+static int uevent_open(void)
+{
+  struct sockaddr_nl addr;
+  int fd;
+
+  fd = socket(PF_NETLINK, SOCK_DGRAM, NETLINK_KOBJECT_UEVENT);
+  if (fd < 0)
+    return -1;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.nl_family = AF_NETLINK;
+  addr.nl_groups = 1;
+  if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+// Keeps the progress bar updated, even when the process is otherwise busy.
+// Only armed for the next visible change (see progress_next_change).
+static int progress_timer_callback(int fd, uint32_t epevents, void *data)
+{
+  drain_fd(fd);
+  ui_write_lock();
+  progress_timer_due = 0;
+
+  // next frame of the animation
+  if (gProgressBarType == PROGRESSBAR_TYPE_INDETERMINATE)
+      redraw_pending = 1;
+
+  // move the progress bar forward on timed intervals, if configured
+  int duration = gProgressScopeDuration;
+  if (gProgressBarType == PROGRESSBAR_TYPE_NORMAL && duration > 0) {
+      float progress = (gr_stats_now() - gProgressScopeTime) / (duration * 1e9);
+      if (progress > 1.0) progress = 1.0;
+      if (progress > gProgress) {
+          if (progress_fill_width(gProgressScopeStart, gProgressScopeSize, progress)
+           != progress_fill_width(gProgressScopeStart, gProgressScopeSize, gProgress))
+              redraw_pending = 1;
+          gProgress = progress;
+      }
+  }
+
+  ui_write_unlock();
+  return 0;
+}
+
+static int idle_timer_callback(int fd, uint32_t epevents, void *data)
+{
+  uint64_t now;
+
+  drain_fd(fd);
+  pthread_mutex_lock(&gUpdateMutex);
+  idle_timer_due = 0;
+  now = gr_stats_now();
+  if (idle_blank_timeout > 0 && now >= idle_input_time + idle_blank_timeout * 1000000000ULL)
+    idle_set_state_locked(IDLE_BLANKED, now);
+  else if (idle_dim_timeout > 0 && now >= idle_input_time + idle_dim_timeout * 1000000000ULL)
+    idle_set_state_locked(IDLE_DIMMED, now);
+  pthread_mutex_unlock(&gUpdateMutex);
+  return 0;
+}
+
+// Restart the idle timeouts, returns 1 if the screen was blanked.
+static int idle_input(void)
+{
+  int blanked;
+
+  pthread_mutex_lock(&gUpdateMutex);
+  idle_input_time = gr_stats_now();
+  blanked = idle_state == IDLE_BLANKED;
+  idle_set_state_locked(IDLE_ACTIVE, idle_input_time);
+  pthread_mutex_unlock(&gUpdateMutex);
+  return blanked;
+}
+
+// Move an event to the ring, 0 when the reader left no room for it.
+static int key_queue_put(const struct ui_input_event *uev)
+{
+  unsigned head = key_queue_head;
+  uint64_t one = 1;
+
+  if (head - key_queue_tail >= KEY_QUEUE_SIZE)
+    return 0;
+
+  key_queue[head % KEY_QUEUE_SIZE] = *uev;
+  __sync_synchronize();
+  key_queue_head = head + 1;
+  __sync_synchronize();
+
+  // the reader only sleeps after it found the queue empty
+  if (key_queue_tail == head && key_queue_fd >= 0)
+    write(key_queue_fd, &one, sizeof(one));
+  return 1;
+}
+
+// Move the spilled events the reader made room for to the ring.
+static void key_queue_flush(void)
+{
+  int n = 0;
+
+  // ui_clear_key_queue() also forgets the events not in the ring yet
+  if (key_queue_spill_clears != key_queue_clears) {
+    key_queue_spill_clears = key_queue_clears;
+    key_queue_spill_len = 0;
+  }
+
+  while (n < key_queue_spill_len && key_queue_put(&key_queue_spill[n]))
+    n++;
+  if (n > 0) {
+    key_queue_spill_len -= n;
+    memmove(key_queue_spill, key_queue_spill + n,
+            key_queue_spill_len * sizeof(*key_queue_spill));
+  }
+  key_queue_spilling = key_queue_spill_len > 0;
+  __sync_synchronize();
+}
+
+// Queue an event for ui_wait_input(), only called by the loop thread.
+static void key_queue_push(const struct ui_input_event *uev)
+{
+  struct ui_input_event *spill;
+  int size;
+
+  key_queue_flush();
+  if (key_queue_spill_len == 0 && key_queue_put(uev))
+    return;
+
+  // the reader is late: no key or release is lost, and the last drag
+  // kept is replaced by a newer one, only its position matters
+  if (uev->utype == UINPUTEVENT_TYPE_TOUCH_DRAG && key_queue_spill_len > 0 &&
+      key_queue_spill[key_queue_spill_len - 1].utype == UINPUTEVENT_TYPE_TOUCH_DRAG) {
+    key_queue_spill[key_queue_spill_len - 1] = *uev;
+    key_queue_drags_merged++;
+    return;
+  }
+
+  if (key_queue_spill_len == key_queue_spill_size) {
+    size = key_queue_spill_size ? key_queue_spill_size * 2 : KEY_QUEUE_SIZE;
+    spill = realloc(key_queue_spill, size * sizeof(*spill));
+    if (spill == NULL) {
+      key_queue_dropped++;
+      return;
     }
+    key_queue_spill = spill;
+    key_queue_spill_size = size;
+  }
+  key_queue_spill[key_queue_spill_len++] = *uev;
+  key_queue_spilled++;
+
+  key_queue_spilling = 1;
+  __sync_synchronize();
+  // the reader may have made room before it could see key_queue_spilling
+  key_queue_flush();
+}
+
+static int wake_callback(int fd, uint32_t epevents, void *data)
+{
+  drain_fd(fd);
+  key_queue_flush();
+  redraw_pending = 1;
+  return 0;
+}
+
+// Only the last of the drags of a batch read is queued, with the time of
+// its sample: the reader gets one position per frame at most.
+static struct ui_input_event drag_held;
+static int drag_holding = 0;
+
+static void input_queue(const struct ui_input_event *uev)
+{
+  if (uev->utype == UINPUTEVENT_TYPE_TOUCH_DRAG) {
+    drag_held = *uev;
+    drag_holding = 1;
+    return;
+  }
+  if (drag_holding) {
+    drag_holding = 0;
+    key_queue_push(&drag_held);
+  }
+  key_queue_push(uev);
+}
+
+// Handles special hot keys, and adds to the key queue.
+static int handle_input(struct input_event ev)
+{
+  static int rel_sum = 0;
+  static int fake_key = 0;
+  static int drag = 0;
+  static int waking = 0;  // the input which unblanked the screen is not used
+  struct ui_input_event uev;
+
+  if (ev.type != EV_SYN && idle_input())
+    waking = 1;
+
+  uev.time = ev.time;
+  uev.type = ev.type;
+  uev.code = ev.code;
+  uev.value = ev.value;
+  uev.utype = UINPUTEVENT_TYPE_KEY;
+  uev.posx = -1;
+  uev.posy = -1;
+
+  if (ev.type == EV_SYN) {
+      return 0;
+  } else if (ev.type == EV_REL) {
+      if (ev.code == REL_Y) {
+          // accumulate the up or down motion reported by
+          // the trackball.  When it exceeds a threshold
+          // (positive or negative), fake an up/down
+          // key event.
+          rel_sum += ev.value;
+          if (rel_sum > 3) {
+              fake_key = 1;
+              ev.type = EV_KEY;
+              ev.code = KEY_DOWN;
+              ev.value = 1;
+              rel_sum = 0;
+          } else if (rel_sum < -3) {
+              fake_key = 1;
+              ev.type = EV_KEY;
+              ev.code = KEY_UP;
+              ev.value = 1;
+              rel_sum = 0;
+          }
+      }
+
+  } else if (ev.type == EV_ABS) {
 
-    if (ev.value > 0 && device_reboot_now(key_pressed, ev.code)) {
-        reboot(RB_AUTOBOOT);
+    int x, y;
+
+    uev.posx = x = ev.value >> 16;
+    uev.posy = y = ev.value & 0xFFFF;
+
+    if (ev.code == 0) {
+      uev.utype = UINPUTEVENT_TYPE_TOUCH_RELEASE;
+      drag = 0;
+    } else if (!drag) {
+      uev.utype = UINPUTEVENT_TYPE_TOUCH_START;
+      drag = 1;
+    } else {
+      uev.utype = UINPUTEVENT_TYPE_TOUCH_DRAG;
     }
 
-    bExitFlag = (t_input == 0);
+  }
+  else {
+    rel_sum = 0;
+  }
 
-  } // thread loop
+  if ((ev.type != EV_KEY && ev.type != EV_ABS) || ev.code > KEY_MAX)
+    return 0;
 
-  return NULL;
+  if (waking) {
+    // until the key or the finger is released
+    if (ev.value == 0 || uev.utype == UINPUTEVENT_TYPE_TOUCH_RELEASE)
+      waking = 0;
+    key_pressed[ev.code] = ev.value;
+    return 0;
+  }
+
+  if (!fake_key) {
+      // our "fake" keys only report a key-down event (no
+      // key-up), so don't record them in the key_pressed
+      // table.
+      key_pressed[ev.code] = ev.value;
+      redraw_pending = 1;
+  }
+  fake_key = 0;
+  if (ev.value > 0)
+      input_queue(&uev);
+
+  if (ev.type!= EV_ABS && ev.value > 0 && device_toggle_display(key_pressed, ev.code)) {
+      ui_setTab_next();
+  }
+
+  if (ev.value > 0 && device_reboot_now(key_pressed, ev.code)) {
+      reboot(RB_AUTOBOOT);
+  }
+
+  return 0;
+}
+
+// Reads the events waiting on an input device.
+static int input_callback(int fd, uint32_t epevents, void *data)
+{
+  struct input_event ev;
+  int r;
+
+  while ((r = ev_get_input(fd, epevents, &ev)) >= 0) {
+    epevents = 0;
+    if (r == 0)
+      handle_input(ev);
+  }
+
+  if (drag_holding) {
+    drag_holding = 0;
+    key_queue_push(&drag_held);
+  }
+  return 0;
 }
 
 /**
- * Refresh the ui
+ * Event loop of the ui
  *
- * Note: use "idle" REDRAWTHREAD_SLOW_FPS when finger doesnt touch the screen.
+ * Sleeps in epoll until an input event, a state change (loop_wakefd), a
+ * power supply uevent or an armed timer. While a slide animates, frames
+ * are paced by the frame timer, otherwise a change is drawn as soon as it
+ * is noticed. A frame the panel could not show yet is skipped and drawn
+ * after the vblank. Idle, the loop only wakes for the minute of the clock.
  */
-static void *redraw_thread(void *cookie)
+static void *loop_thread(void *cookie)
 {
-  bool bNeedExit = false;
-  int sleep_time = 10000;
-  int counter = 0;
+  int timeout = -1;
+  int draw;
+
+  while (loop_running) {
+    if (ev_wait(timeout) == 0)
+      ev_dispatch();
+    timeout = -1;
 
-  while (!bNeedExit) {
-    usleep(sleep_time);
+    // a blanked screen is drawn once it wakes
     pthread_mutex_lock(&gUpdateMutex);
-    sleep_time = 1000000 / (redraw_idle_timeout > 0 ? REDRAWTHREAD_FAST_FPS : (REDRAWTHREAD_SLOW_FPS*5));
-    counter = (counter+1) % 5;
-    // skip 4/5 of the "slow" redraw work in idle state, to reduce the maximum wait on exit from idle
-    if ((redraw_idle_timeout || !counter)) {
-      update_screen_locked();
-      redraw_idle_timeout-=10;
-      if (redraw_idle_timeout < 0) redraw_idle_timeout = 0;
+    draw = redraw_pending && idle_state != IDLE_BLANKED && (frame_timer_fps == 0 || frame_due);
+    pthread_mutex_unlock(&gUpdateMutex);
+
+    if (draw) {
+      if (enable_bounceback) {
+        ui_write_lock();
+        if (enable_bounceback == 1)
+          step_bounceback_locked();
+        ui_write_unlock();
+      }
+
+      // the writers go on meanwhile, on their own copy
+      pthread_mutex_lock(&render_mutex);
+      if (redraw_enabled && update_screen() < 0) {
+        // retry once the previous frame reached the screen
+        timeout = gr_flip_delay();
+      } else {
+        redraw_pending = 0;
+        frame_due = 0;
+      }
+      pthread_mutex_unlock(&render_mutex);
     }
-    bNeedExit = (t_redraw == 0);
+
+    pthread_mutex_lock(&gUpdateMutex);
+    update_timers_locked();
     pthread_mutex_unlock(&gUpdateMutex);
   }
   return NULL;
 }
 
+static int loop_add_timer(int clock, ev_callback cb)
+{
+  int fd = timerfd_create(clock, TFD_NONBLOCK);
+  if (fd < 0) {
+    LOGE("timerfd_create failed\n");
+    return -1;
+  }
+  ev_add_fd(fd, cb, NULL);
+  return fd;
+}
+
+// Start the loop thread, the input devices must be opened already.
+static void loop_start(void)
+{
+  if (loop_running)
+    return;
+
+  loop_wakefd = eventfd(0, EFD_NONBLOCK);
+  if (loop_wakefd >= 0)
+    ev_add_fd(loop_wakefd, wake_callback, NULL);
+  frame_timerfd = loop_add_timer(CLOCK_MONOTONIC, frame_timer_callback);
+  progress_timerfd = loop_add_timer(CLOCK_MONOTONIC, progress_timer_callback);
+  status_timerfd = loop_add_timer(CLOCK_REALTIME, status_timer_callback);
+  idle_timerfd = loop_add_timer(CLOCK_MONOTONIC, idle_timer_callback);
+  uevent_fd = uevent_open();
+  if (uevent_fd >= 0)
+    ev_add_fd(uevent_fd, uevent_callback, NULL);
+  frame_timer_fps = 0;
+  progress_timer_due = status_timer_due = idle_timer_due = 0;
+  redraw_pending = 1;
+
+  pthread_mutex_lock(&gUpdateMutex);
+  idle_input_time = gr_stats_now();
+  pthread_mutex_unlock(&gUpdateMutex);
+
+  loop_running = 1;
+  if (pthread_create(&t_loop, NULL, loop_thread, NULL)) {
+    LOGE("Unable to start the event loop\n");
+    loop_running = 0;
+  }
+  ui_wake_loop();
+}
+
+static void loop_stop(void)
+{
+  if (!loop_running)
+    return;
+
+  loop_running = 0;
+  ui_wake_loop();
+  pthread_join(t_loop, NULL);
+  t_loop = 0;
+
+  if (loop_wakefd >= 0) close(loop_wakefd);
+  if (frame_timerfd >= 0) close(frame_timerfd);
+  if (progress_timerfd >= 0) close(progress_timerfd);
+  if (status_timerfd >= 0) close(status_timerfd);
+  if (idle_timerfd >= 0) close(idle_timerfd);
+  if (uevent_fd >= 0) close(uevent_fd);
+  loop_wakefd = frame_timerfd = progress_timerfd = status_timerfd = idle_timerfd = -1;
+  uevent_fd = -1;
+
+  // nothing would wake the screen anymore
+  pthread_mutex_lock(&gUpdateMutex);
+  idle_set_state_locked(IDLE_ACTIVE, gr_stats_now());
+  pthread_mutex_unlock(&gUpdateMutex);
+}
+
 int ui_create_bitmaps()
 {
   int i, result=0;
@@ -736,29 +1696,29 @@ int ui_create_bitmaps()
 void ui_init(void)
 {
   gr_init();
-  ev_init();
+  create_layers();
   recalcSquare();
 
   text_col = text_row = 0;
+  text_lines = 0;
   text_rows = gr_fb_height() / ROW_HEIGHT;
   if (text_rows > MAX_ROWS) text_rows = MAX_ROWS;
   text_top = 1;
 
+  idle_state_time = gr_stats_now();
+
   text_cols = gr_fb_width() / gr_getfont_cwidth();
   if (text_cols > MAX_COLS - 1) text_cols = MAX_COLS - 1;
 
   ui_create_bitmaps();
 
-  pthread_attr_t attr;
-  pthread_attr_init(&attr);
-  pthread_create(&t_progress, &attr, progress_thread, NULL);
-
-  pthread_attr_init(&attr);
-  pthread_create(&t_input, &attr, input_thread, NULL);
-  evt_enabled = 1;
+  pthread_mutex_lock(&gUpdateMutex);
+  ui_ready = 1;
+  redraw_enabled = 1;
+  pthread_mutex_unlock(&gUpdateMutex);
 
-  pthread_attr_init(&attr);
-  pthread_create(&t_redraw, &attr, redraw_thread, NULL);
+  evt_init();
+  ui_wake_loop();
 }
 
 void ui_free_bitmaps(void)
@@ -776,43 +1736,65 @@ void ui_free_bitmaps(void)
 
 void evt_init(void)
 {
-  ev_init();
+  if (evt_enabled)
+    return;
 
-  if (!evt_enabled && t_input == 0) {
-    pthread_create(&t_input, NULL, input_thread, NULL);
+  if (key_queue_fd < 0) {
+    key_queue_fd = eventfd(0, 0);
+    if (key_queue_fd < 0)
+      LOGE("eventfd failed, polling the input queue\n");
   }
+
+  if (ev_init(input_callback, NULL) < 0)
+    return;
+
+  loop_start();
   evt_enabled = 1;
 }
 
 void evt_exit(void)
 {
-  if (evt_enabled) {
+  uint64_t one = 1;
 
-    if (t_input != 0) {
-      pthread_detach(t_input);
-      t_input = 0;
-      usleep(1000);
-    }
+  if (evt_enabled) {
+    loop_stop();
     ev_exit();
-
   }
   evt_enabled = 0;
+
+  // release ui_wait_input()
+  if (key_queue_fd >= 0)
+    write(key_queue_fd, &one, sizeof(one));
+
+  if (key_queue_spilled || key_queue_dropped)
+    LOGI("input queue full: %u events kept aside, %u dropped, %u drags merged\n",
+         key_queue_spilled, key_queue_dropped, key_queue_drags_merged);
 }
 
+// No frame is drawn once this returns (the loop draws under render_mutex),
+// input is still handled.
 void ui_stop_redraw(void)
 {
-  if (t_redraw) {
-    pthread_detach(t_redraw);
-    t_redraw = 0;
-    usleep(1000);
-  }
+  pthread_mutex_lock(&gUpdateMutex);
+  redraw_enabled = 0;
+  idle_set_state_locked(IDLE_ACTIVE, gr_stats_now());
+  pthread_mutex_unlock(&gUpdateMutex);
+  ui_wait_frame();
+  ui_wake_loop();
 }
 
 void ui_resume_redraw(void)
 {
-  if (t_redraw) return;
-
-  pthread_create(&t_redraw, NULL, redraw_thread, NULL);
+  pthread_mutex_lock(&gUpdateMutex);
+  if (ui_ready && !redraw_enabled) {
+    // scripts may have used the framebuffer meanwhile
+    pthread_mutex_lock(&render_mutex);
+    gr_frame_invalidate();
+    redraw_enabled = 1;
+    pthread_mutex_unlock(&render_mutex);
+  }
+  pthread_mutex_unlock(&gUpdateMutex);
+  ui_wake_loop();
 }
 
 void ui_final(void)
@@ -822,6 +1804,11 @@ void ui_final(void)
   ui_show_text(0);
   ui_stop_redraw();
 
+  pthread_mutex_lock(&gUpdateMutex);
+  ui_ready = 0;
+  pthread_mutex_unlock(&gUpdateMutex);
+
+  free_layers();
   gr_exit();
 
   //ui_free_bitmaps();
@@ -829,62 +1816,68 @@ void ui_final(void)
 
 void ui_set_background(int icon)
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   gCurrentIcon = gBackgroundIcon[icon];
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
 }
 
 void ui_show_indeterminate_progress()
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   if (gProgressBarType != PROGRESSBAR_TYPE_INDETERMINATE) {
     gProgressBarType = PROGRESSBAR_TYPE_INDETERMINATE;
+    gProgressScopeTime = gr_stats_now();
     update_progress_locked();
   }
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
 }
 
 void ui_show_progress(float portion, int seconds)
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   gProgressBarType = PROGRESSBAR_TYPE_NORMAL;
   gProgressScopeStart += gProgressScopeSize;
   gProgressScopeSize = portion;
-  gProgressScopeTime = time(NULL);
+  gProgressScopeTime = gr_stats_now();
   gProgressScopeDuration = seconds;
   gProgress = 0;
   percent = gProgressScopeStart;
   update_progress_locked();
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
 }
 
 void ui_set_progress(float fraction)
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   if (fraction < 0.0) fraction = 0.0;
   if (fraction > 1.0) fraction = 1.0;
-  percent = gProgressScopeStart + (fraction * gProgressScopeSize);
   if (gProgressBarType == PROGRESSBAR_TYPE_NORMAL && fraction > gProgress) {
     // Skip updates that aren't visibly different.
-    int width = gr_get_width(gProgressBarIndeterminate[0]);
-    float scale = width * gProgressScopeSize;
-    if ((int) (gProgress * scale) != (int) (fraction * scale)) {
-      gProgress = fraction;
+    int shown = (int) (percent * 100 + 0.5);
+    percent = gProgressScopeStart + (fraction * gProgressScopeSize);
+    if (progress_fill_width(gProgressScopeStart, gProgressScopeSize, gProgress)
+     != progress_fill_width(gProgressScopeStart, gProgressScopeSize, fraction)
+     || (show_percent && shown != (int) (percent * 100 + 0.5))) {
       update_progress_locked();
     }
+    gProgress = fraction;
+  } else {
+    percent = gProgressScopeStart + (fraction * gProgressScopeSize);
   }
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
 }
 
 void ui_reset_progress()
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   gProgressBarType = PROGRESSBAR_TYPE_NONE;
   gProgressScopeStart = gProgressScopeSize = 0;
   gProgressScopeTime = gProgressScopeDuration = 0;
   gProgress = 0;
   percent = 0.0;
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
 }
 
 void ui_print_str(char *str) {
@@ -900,7 +1893,7 @@ void ui_print_str(char *str) {
     text_cols = MAX_COLS-1;
 
   // This can get called before ui_init(), so be careful.
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   if (text_rows > 0 && text_cols > 0) {
     char *ptr;
     for (ptr = buf; *ptr != '\0'; ++ptr) {
@@ -908,13 +1901,15 @@ void ui_print_str(char *str) {
         text[text_row][text_col] = '\0';
         text_col = 0;
         text_row = (text_row + 1) % text_rows;
+        text_lines++;
         if (text_row == text_top) text_top = (text_top + 1) % text_rows;
       }
       if (*ptr != '\n') text[text_row][text_col++] = *ptr;
     }
     text[text_row][text_col] = '\0';
   }
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
 }
 
 void ui_print(const char *fmt, ...)
@@ -930,7 +1925,7 @@ void ui_print(const char *fmt, ...)
 
 void ui_start_menu(char** headers, char** tabs, struct UiMenuItem* items, int initial_selection) {
   int i;
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
 
   if (text_rows > 0 && text_cols > 0) {
 
@@ -955,12 +1950,15 @@ void ui_start_menu(char** headers, char** tabs, struct UiMenuItem* items, int in
     menutop_diff=0;
   }
 
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  // the items of the previous menu are not drawn anymore
+  ui_wait_frame();
+  ui_wake_loop();
 }
 
 int ui_menu_select(int sel) {
   int old_sel;
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   if (show_menu > 0) {
     old_sel = menu_sel;
     menu_sel = sel;
@@ -975,33 +1973,35 @@ int ui_menu_select(int sel) {
     }
     sel = menu_sel;
   }
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
   fprintf(stdout, "selection: %d\n", sel);fflush(stdout);
   return sel;
 }
 
 void ui_end_menu() {
   int i;
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   if (show_menu > 0) {
       show_menu = 0;
   }
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  // the caller may free the items
+  ui_wait_frame();
+  ui_wake_loop();
 }
 
 int ui_text_visible()
 {
-  pthread_mutex_lock(&gUpdateMutex);
-  int visible = show_text;
-  pthread_mutex_unlock(&gUpdateMutex);
-  return visible;
+  return show_text;
 }
 
 void ui_show_text(int visible)
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   show_text = visible;
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
 }
 
 int ui_wait_key()
@@ -1015,22 +2015,39 @@ int ui_wait_key()
 
 int ui_wait_input(struct ui_input_event* pkey)
 {
-  int ret = 0;
-  pthread_mutex_lock(&key_queue_mutex);
+  unsigned tail = key_queue_tail;
+  uint64_t count;
 
-  while (key_queue_len == 0 && evt_enabled) {
-    pthread_cond_wait(&key_queue_cond, &key_queue_mutex);
+  for (;;) {
+    __sync_synchronize();
+    if (key_queue_head != tail)
+      break;
+    if (!evt_enabled)
+      return -1;
+    if (key_queue_fd >= 0)
+      read(key_queue_fd, &count, sizeof(count));
+    else
+      usleep(10000);
   }
-
-  if (key_queue_len > 0) {
-    memcpy(pkey, &key_queue[0], sizeof(struct ui_input_event));
-    memcpy(&key_queue[0], &key_queue[1], sizeof(struct ui_input_event) * --key_queue_len);
-  } else {
-    ret = -1;
+  __sync_synchronize();
+
+  // a drag followed by another one is already out of date
+  while (key_queue[tail % KEY_QUEUE_SIZE].utype == UINPUTEVENT_TYPE_TOUCH_DRAG &&
+         key_queue_head - tail > 1 &&
+         key_queue[(tail + 1) % KEY_QUEUE_SIZE].utype == UINPUTEVENT_TYPE_TOUCH_DRAG) {
+    tail++;
+    key_queue_drags_merged++;
   }
 
-  pthread_mutex_unlock(&key_queue_mutex);
-  return ret;
+  *pkey = key_queue[tail % KEY_QUEUE_SIZE];
+  __sync_synchronize();
+  key_queue_tail = tail + 1;
+  __sync_synchronize();
+
+  // the loop waits for room to queue the events it kept aside
+  if (key_queue_spilling)
+    ui_wake_loop();
+  return 0;
 }
 
 int ui_key_pressed(int key)
@@ -1039,10 +2056,14 @@ int ui_key_pressed(int key)
   return key_pressed[key];
 }
 
+// From the thread reading the queue, like ui_wait_input().
 void ui_clear_key_queue() {
-  pthread_mutex_lock(&key_queue_mutex);
-  key_queue_len = 0;
-  pthread_mutex_unlock(&key_queue_mutex);
+  __sync_synchronize();
+  key_queue_clears++;
+  key_queue_tail = key_queue_head;
+  __sync_synchronize();
+  if (key_queue_spilling)
+    ui_wake_loop();
 }
 
 void ui_get_time(char* result)
@@ -1067,9 +2088,10 @@ void ui_get_usbstate(char* result)
 
 void ui_set_activeTab(int i)
 {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   activeTab=i;
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
 }
 
 int ui_get_activeTab(void)
@@ -1077,9 +2099,77 @@ int ui_get_activeTab(void)
   return activeTab;
 }
 
+void ui_show_render_stats(int visible)
+{
+  ui_write_lock();
+  render_hud = visible;
+  ui_write_unlock();
+  ui_wake_loop();
+}
+
+int ui_render_stats_visible(void)
+{
+  return render_hud;
+}
+
+int ui_dump_render_stats(const char *path)
+{
+  uint64_t t[IDLE_STATES], now;
+  FILE *f;
+  int i;
+
+  if (gr_stats_dump(path) < 0)
+    return -1;
+
+  pthread_mutex_lock(&gUpdateMutex);
+  now = gr_stats_now();
+  for (i = 0; i < IDLE_STATES; i++)
+    t[i] = idle_time[i];
+  t[idle_state] += now - idle_state_time;
+  pthread_mutex_unlock(&gUpdateMutex);
+
+  f = fopen(path, "a");
+  if (f == NULL)
+    return -1;
+  fprintf(f, "\ndisplay seconds active %llu dimmed %llu blanked %llu\n",
+          t[IDLE_ACTIVE] / 1000000000ULL, t[IDLE_DIMMED] / 1000000000ULL,
+          t[IDLE_BLANKED] / 1000000000ULL);
+  fclose(f);
+  return 0;
+}
+
+void ui_set_idle_timeouts(int dim, int blank, int dim_brightness)
+{
+  pthread_mutex_lock(&gUpdateMutex);
+  idle_dim_timeout = dim;
+  idle_blank_timeout = blank;
+  idle_dim_brightness = dim_brightness;
+  pthread_mutex_unlock(&gUpdateMutex);
+  ui_wake_loop();
+}
+
+int ui_save_screenshot(const char *path)
+{
+  return gr_capture_snapshot(path);
+}
+
+int ui_stream_screen(int on)
+{
+  if (!on) {
+    gr_capture_stop();
+    return 0;
+  }
+  return gr_capture_start(GR_CAPTURE_SOCKET);
+}
+
+int ui_screen_streamed(void)
+{
+  return gr_capture_started();
+}
+
 int ui_setTab_next() {
   int cnt;
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
 
   // count tabs
   for(cnt=0; tabitems[cnt]; cnt++){}
@@ -1087,7 +2177,8 @@ int ui_setTab_next() {
   // set next tab as active tab
   activeTab = (activeTab + 1) % cnt;
 
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
   return activeTab;
 }
 
@@ -1097,19 +2188,7 @@ struct UiMenuItem buildMenuItem(int type, char *title, char *description) {
 }
 
 int ui_inside_menuitem(int item, int x, int y) {
-  int i;
-  int top = ui_get_menu_top();
-
-  // get top-position
-  for(i=0; i<item; ++i) {
-    top += get_menuitem_height(i);
-  }
-
-  // the check itself
-  if(x >= square_inner_left && x <= square_inner_right && y >= top && y < (top + get_menuitem_height(item)) ) {
-    return 1;
-  }
-  return 0;
+  return inside_menuitem(menu, ui_get_menu_top(), item, x, y);
 }
 
 /* Return 1 if the difference is negative, otherwise 0.  */
@@ -1128,12 +2207,10 @@ struct ui_touchresult ui_handle_touch(struct ui_input_event uev) {
   struct ui_touchresult ret = {TOUCHRESULT_TYPE_EMPTY,-1};
   struct timeval tvNow, tvDiff;
 
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   switch(uev.utype) {
     case UINPUTEVENT_TYPE_TOUCH_START:
 
-      redraw_idle_timeout = 100;
-
       if(enable_scrolling==1) break;
 
       // save start-time
@@ -1153,8 +2230,6 @@ struct ui_touchresult ui_handle_touch(struct ui_input_event uev) {
 
     case UINPUTEVENT_TYPE_TOUCH_DRAG:
 
-      redraw_idle_timeout = 100;
-
       // calculate difference to start-time
       gettimeofday(&tvNow, NULL);
       timeval_subtract(&tvDiff, &tvNow, &tvTouchStart);
@@ -1180,7 +2255,6 @@ struct ui_touchresult ui_handle_touch(struct ui_input_event uev) {
           ret.type = TOUCHRESULT_TYPE_ONCLICK_LIST;
           ret.item = i;
           vibrate(VIBRATOR_HARD_MS); /* big vibration on release */
-          redraw_idle_timeout = 50;
           break;
         }
       }
@@ -1194,32 +2268,31 @@ struct ui_touchresult ui_handle_touch(struct ui_input_event uev) {
           bounceback_targetpos=0;
           enable_bounceback=1;
         }
-        else if(menutop_diff  <0 && (square_inner_top+ui_get_menu_height()) < square_inner_bottom) {
+        else if(menutop_diff  <0 && (square_inner_top+ui_get_menu_height(menu, menu_items)) < square_inner_bottom) {
           bounceback_targetpos=0;
           enable_bounceback=1;
         }
-        else if(menutop_diff < 0 && (square_inner_top+menutop_diff+ui_get_menu_height()) < square_inner_bottom) {
-          bounceback_targetpos=-(square_inner_top+ui_get_menu_height()-square_inner_bottom);
+        else if(menutop_diff < 0 && (square_inner_top+menutop_diff+ui_get_menu_height(menu, menu_items)) < square_inner_bottom) {
+          bounceback_targetpos=-(square_inner_top+ui_get_menu_height(menu, menu_items)-square_inner_bottom);
           enable_bounceback=1;
         }
       }
 
-      // idle later on bounce back
-      if (enable_bounceback) redraw_idle_timeout += 50;
-
       pointerx_start = pointerx = -1;
       pointery_start = pointery = -1;
       enable_scrolling=0;
       break;
   }
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
   return ret;
 }
 
 void enableMenuSelection(int i) {
-  pthread_mutex_lock(&gUpdateMutex);
+  ui_write_lock();
   show_menu_selection=i;
-  pthread_mutex_unlock(&gUpdateMutex);
+  ui_write_unlock();
+  ui_wake_loop();
 }
 
 int is_menuSelection_enabled() {